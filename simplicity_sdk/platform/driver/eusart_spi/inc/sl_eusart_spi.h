@@ -0,0 +1,303 @@
+/***************************************************************************//**
+ * @file
+ * @brief EUSART SPI driver API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_EUSART_SPI_H
+#define SL_EUSART_SPI_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "sl_status.h"
+#include "sl_enum.h"
+#include "sl_device_peripheral.h"
+#include "sl_device_gpio.h"
+#include "sl_hal_eusart.h"
+#include "dmadrv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* *INDENT-OFF* */
+// *****************************************************************************
+/// @addtogroup eusart_spi EUSART SPI - Serial Peripheral Interface over EUSART
+/// @brief EUSART SPI driver
+///
+/// @li @ref eusart_spi_intro
+///
+///@n @section eusart_spi_intro Introduction
+///  This is a DMA driven SPI leader driver for the EUSART peripheral.
+///  Each transfer runs a TX and an RX DMA channel together, so every byte
+///  sent is matched by a byte received. Transfers of any length can be queued
+///  and are executed back to back from the DMA interrupt. Continuous traffic
+///  can also be streamed through two pairs of buffers used alternately.
+///
+/// @{
+// *****************************************************************************
+/* *INDENT-ON* */
+
+/*******************************************************************************
+ ********************************   ENUMS   ************************************
+ ******************************************************************************/
+
+/// EUSART SPI driver state enum
+SL_ENUM(sl_eusart_spi_state_t) {
+  SL_EUSART_SPI_STATE_IDLE = 0,         ///< No transfer in progress
+  SL_EUSART_SPI_STATE_TRANSFER = 1,     ///< Queued transfers in progress
+  SL_EUSART_SPI_STATE_STREAM = 2,       ///< Double-buffered stream in progress
+};
+
+/*******************************************************************************
+ *******************************   TYPEDEFS   **********************************
+ ******************************************************************************/
+
+typedef struct sl_eusart_spi_handle_t sl_eusart_spi_handle_t;       ///< Forward declaration of EUSART SPI handle type
+typedef struct sl_eusart_spi_transfer_t sl_eusart_spi_transfer_t;   ///< Forward declaration of EUSART SPI transfer type
+
+/***************************************************************************//**
+ * @brief Transfer Callback
+ * @note  Invoked from interrupt context once a queued transfer has ended. The
+ *        next queued transfer is already started when the callback runs.
+ * @param[in] handle       Pointer to the EUSART SPI driver handle.
+ * @param[in] transfer     Pointer to the transfer that ended.
+ * @param[in] status       SL_STATUS_OK on success, SL_STATUS_ABORT if the
+ *                         transfer was aborted, SL_STATUS_FAIL if the DMA
+ *                         could not be started.
+ * @param[in] user_data    User-defined data of the transfer.
+ ******************************************************************************/
+typedef void (*sl_eusart_spi_transfer_callback_t)(sl_eusart_spi_handle_t *handle,
+                                                  sl_eusart_spi_transfer_t *transfer,
+                                                  sl_status_t status,
+                                                  void *user_data);
+
+/***************************************************************************//**
+ * @brief Stream Callback
+ * @note  Invoked from interrupt context each time one of the two stream
+ *        buffers has been sent and received. The DMA carries on with the
+ *        other buffer while the callback refills or consumes this one.
+ * @param[in] handle        Pointer to the EUSART SPI driver handle.
+ * @param[in] buffer_index  Index (0 or 1) of the buffer that is done.
+ * @param[in] user_data     User-defined data of the stream.
+ * @return    true to continue streaming, false to stop the stream.
+ ******************************************************************************/
+typedef bool (*sl_eusart_spi_stream_callback_t)(sl_eusart_spi_handle_t *handle,
+                                                uint32_t buffer_index,
+                                                void *user_data);
+
+/*******************************************************************************
+ *******************************   STRUCTS   ***********************************
+ ******************************************************************************/
+
+/**
+ * @struct sl_eusart_spi_init_params_t
+ * @brief Initialization parameters for an EUSART SPI driver instance.
+ *        This structure is passed to @ref sl_eusart_spi_init().
+ * @note  Frames are 8 bits wide. When `cs_control` is true, the driver drives
+ *        `cs_gpio` as an active low chip select around each transfer.
+ */
+typedef struct {
+  sl_peripheral_t                 eusart_peripheral;      ///< EUSART Peripheral Instance
+  uint32_t                        bitrate;                ///< SPI bit rate in bits per second
+  sl_hal_eusart_clock_mode_t      clock_mode;             ///< Clock polarity/phase mode
+  bool                            msb_first;              ///< true to send the most significant bit first
+  sl_gpio_t                       sclk_gpio;              ///< SCLK GPIO Port and Pin
+  sl_gpio_t                       mosi_gpio;              ///< MOSI GPIO Port and Pin (EUSART TX)
+  sl_gpio_t                       miso_gpio;              ///< MISO GPIO Port and Pin (EUSART RX)
+  sl_gpio_t                       cs_gpio;                ///< Chip select GPIO Port and Pin
+  bool                            cs_control;             ///< true if the driver manages the chip select
+} sl_eusart_spi_init_params_t;
+
+/**
+ * @struct sl_eusart_spi_transfer_t
+ * @brief Full-duplex transfer queued with @ref sl_eusart_spi_enqueue_transfer().
+ *        When tx_buffer is NULL, 0xFF bytes are sent. When rx_buffer is NULL,
+ *        the received bytes are discarded.
+ * @note  The transfer structure and its buffers are owned by the driver from
+ *        the moment the transfer is enqueued until its callback is invoked.
+ *        The `next` member is reserved for the driver.
+ */
+typedef struct sl_eusart_spi_transfer_t {
+  const uint8_t                      *tx_buffer;          ///< Data to send, can be NULL
+  uint8_t                            *rx_buffer;          ///< Buffer for received data, can be NULL
+  uint32_t                           len;                 ///< Number of bytes to exchange
+  bool                               keep_cs_asserted;    ///< true to chain the next transfer under the same chip select
+  sl_eusart_spi_transfer_callback_t  callback;            ///< Transfer callback, can be NULL
+  void                               *user_data;          ///< User defined data passed to the callback
+  struct sl_eusart_spi_transfer_t    *next;               ///< Next transfer in the queue (driver internal)
+} sl_eusart_spi_transfer_t;
+
+/**
+ * @struct sl_eusart_spi_handle_t
+ * @brief Represents an EUSART SPI instance handle.
+ * @warning
+ *       This structure is defined in the public header for driver implementation
+ *       purposes only. Applications must NOT access, modify, or rely upon any
+ *       members of this structure directly.
+ */
+typedef struct sl_eusart_spi_handle_t {
+  // Peripheral and configuration
+  sl_peripheral_t                 eusart_peripheral;      ///< EUSART Peripheral Instance
+  EUSART_TypeDef                  *eusart;                ///< EUSART register block
+  sl_gpio_t                       sclk_gpio;              ///< SCLK GPIO Port and Pin
+  sl_gpio_t                       mosi_gpio;              ///< MOSI GPIO Port and Pin
+  sl_gpio_t                       miso_gpio;              ///< MISO GPIO Port and Pin
+  sl_gpio_t                       cs_gpio;                ///< Chip select GPIO Port and Pin
+  bool                            cs_control;             ///< Driver managed chip select
+  bool                            cs_asserted;            ///< Chip select currently asserted
+
+  // DMA configuration
+  unsigned int                    dma_tx_channel;         ///< DMA Channel assigned for Tx operations
+  unsigned int                    dma_rx_channel;         ///< DMA Channel assigned for Rx operations
+  DMADRV_PeripheralSignal_t       dma_tx_signal;          ///< DMA trigger for Tx operations
+  DMADRV_PeripheralSignal_t       dma_rx_signal;          ///< DMA trigger for Rx operations
+
+  // Transfer queue
+  volatile sl_eusart_spi_state_t  state;                  ///< Current driver state
+  sl_eusart_spi_transfer_t        *queue;                 ///< Pending transfers, in submission order
+  sl_eusart_spi_transfer_t        *active_transfer;       ///< Transfer currently on the bus
+  uint32_t                        offset;                 ///< Bytes exchanged in the active transfer
+  uint32_t                        chunk_len;              ///< Bytes in the DMA chunk in progress
+
+  // Stream
+  sl_eusart_spi_stream_callback_t stream_callback;        ///< Stream callback
+  void                            *stream_user_data;      ///< Stream user defined data
+} sl_eusart_spi_handle_t;
+
+/*******************************************************************************
+ *****************************   PROTOTYPES   **********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Initializes an EUSART instance as an SPI leader.
+ * @details Configures the pins, the EUSART through sl_hal_eusart_init_spi()
+ *          and allocates the TX and RX DMA channels.
+ * @param[out] handle        A pointer to the EUSART SPI instance handle.
+ * @param[in]  init_params   A pointer to initialization parameters.
+ * @return
+ *   - SL_STATUS_OK on success.
+ *   - SL_STATUS_NULL_POINTER if arguments are NULL.
+ *   - SL_STATUS_INVALID_PARAMETER for invalid config.
+ *   - SL_STATUS_NOT_SUPPORTED if the peripheral has no SPI or DMA support.
+ *   - SL_STATUS_FAIL if clock frequency retrieval fails.
+ *   - SL_STATUS_ALLOCATION_FAILED if DMA allocation fails.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_init(sl_eusart_spi_handle_t *handle,
+                               const sl_eusart_spi_init_params_t *init_params);
+
+/***************************************************************************//**
+ * Deinitializes the EUSART SPI instance.
+ * @details Aborts the transfers in progress, frees the DMA channels and
+ *          resets the EUSART and its pins.
+ * @param[in] handle   Pointer to the EUSART SPI instance handle.
+ * @return
+ *   - SL_STATUS_OK on success.
+ *   - SL_STATUS_NULL_POINTER if handle is NULL.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_deinit(sl_eusart_spi_handle_t *handle);
+
+/***************************************************************************//**
+ * Queue a full-duplex transfer (non-blocking).
+ * @details Adds the transfer to the queue and starts it right away if the bus
+ *          is free. Transfers longer than a single DMA transfer are split
+ *          internally. Queued transfers are executed back to back from the
+ *          DMA interrupt, and a transfer with `keep_cs_asserted` set is
+ *          chained to the next one without releasing the chip select.
+ * @param[in] handle     Pointer to the EUSART SPI instance handle.
+ * @param[in] transfer   Pointer to the transfer to queue.
+ * @return
+ *   - SL_STATUS_OK if the transfer was queued or started.
+ *   - SL_STATUS_NULL_POINTER if arguments are NULL.
+ *   - SL_STATUS_INVALID_PARAMETER if the length is 0.
+ *   - SL_STATUS_BUSY if a stream is in progress or the transfer is already queued.
+ *   - SL_STATUS_FAIL if the DMA could not be started.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_enqueue_transfer(sl_eusart_spi_handle_t *handle,
+                                           sl_eusart_spi_transfer_t *transfer);
+
+/***************************************************************************//**
+ * Start a double-buffered full-duplex stream (non-blocking).
+ * @details Exchanges buffer 0 then buffer 1 then buffer 0 again, and so on,
+ *          without gap between buffers. The callback is invoked each time
+ *          a buffer is done. The chip select stays asserted until the stream
+ *          is stopped.
+ * @note  The TX buffers must both be NULL or both be non-NULL, likewise for
+ *        the RX buffers. NULL TX buffers send 0xFF bytes and NULL RX buffers
+ *        discard the received bytes.
+ * @param[in] handle       Pointer to the EUSART SPI instance handle.
+ * @param[in] tx_buffer0   First buffer of data to send, can be NULL.
+ * @param[in] tx_buffer1   Second buffer of data to send, can be NULL.
+ * @param[out] rx_buffer0  First buffer for received data, can be NULL.
+ * @param[out] rx_buffer1  Second buffer for received data, can be NULL.
+ * @param[in] len          Length of each buffer, up to one DMA transfer.
+ * @param[in] callback     Stream callback.
+ * @param[in] user_data    User-defined data passed to the callback.
+ * @return
+ *   - SL_STATUS_OK if the stream was started.
+ *   - SL_STATUS_NULL_POINTER if handle or callback is NULL.
+ *   - SL_STATUS_INVALID_PARAMETER if buffers or length are invalid.
+ *   - SL_STATUS_BUSY if transfers or a stream are in progress.
+ *   - SL_STATUS_FAIL if the DMA could not be started.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_start_stream(sl_eusart_spi_handle_t *handle,
+                                       const uint8_t *tx_buffer0,
+                                       const uint8_t *tx_buffer1,
+                                       uint8_t *rx_buffer0,
+                                       uint8_t *rx_buffer1,
+                                       uint32_t len,
+                                       sl_eusart_spi_stream_callback_t callback,
+                                       void *user_data);
+
+/***************************************************************************//**
+ * Stop the stream in progress.
+ * @param[in] handle   Pointer to the EUSART SPI instance handle.
+ * @return
+ *   - SL_STATUS_OK if the stream was stopped.
+ *   - SL_STATUS_NULL_POINTER if handle is NULL.
+ *   - SL_STATUS_INVALID_STATE if no stream is in progress.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_stop_stream(sl_eusart_spi_handle_t *handle);
+
+/***************************************************************************//**
+ * Abort the transfers in progress.
+ * @details Stops the active transfer and drops the pending ones. Their
+ *          callbacks are invoked with SL_STATUS_ABORT.
+ * @param[in] handle   Pointer to the EUSART SPI instance handle.
+ * @return
+ *   - SL_STATUS_OK on success.
+ *   - SL_STATUS_NULL_POINTER if handle is NULL.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_abort(sl_eusart_spi_handle_t *handle);
+
+/** @} (end addtogroup eusart_spi) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SL_EUSART_SPI_H */
@@ -0,0 +1,684 @@
+/***************************************************************************//**
+ * @file
+ * @brief EUSART SPI driver API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_core.h"
+#include "sl_clock_manager.h"
+#include "sl_hal_gpio.h"
+#include "sl_hal_eusart.h"
+#include "sl_eusart_spi.h"
+
+/*******************************************************************************
+*******************************   DEFINES   ***********************************
+*******************************************************************************/
+/// Value of a DMA signal that does not exist on the device.
+#define EUSART_SPI_DMA_SIGNAL_INVALID  0xFFFFFFFFUL
+
+/// Largest synchronous clock divider supported by the EUSART.
+#define EUSART_SPI_MAX_CLOCK_DIV       (_EUSART_CFG2_SDIV_MASK >> _EUSART_CFG2_SDIV_SHIFT)
+
+/*******************************************************************************
+*****************************   LOCAL VARIABLES   *****************************
+*******************************************************************************/
+/// Byte sent when a transfer has no TX buffer.
+static uint8_t tx_dummy = 0xFF;
+
+/// Byte overwritten when a transfer has no RX buffer.
+static uint8_t rx_dummy;
+
+/*******************************************************************************
+ ***************************   LOCAL FUNCTIONS   *******************************
+ ******************************************************************************/
+static void eusart_spi_assert_cs(sl_eusart_spi_handle_t *handle);
+static void eusart_spi_deassert_cs(sl_eusart_spi_handle_t *handle);
+static void eusart_spi_stop_dma(sl_eusart_spi_handle_t *handle);
+static sl_status_t eusart_spi_start_chunk(sl_eusart_spi_handle_t *handle);
+static sl_status_t eusart_spi_start_transfer(sl_eusart_spi_handle_t *handle,
+                                             sl_eusart_spi_transfer_t *transfer);
+static void eusart_spi_start_next_transfer(sl_eusart_spi_handle_t *handle);
+static bool eusart_spi_transfer_rx_done(unsigned int channel,
+                                        unsigned int sequence_no,
+                                        void *user_param);
+static bool eusart_spi_stream_rx_done(unsigned int channel,
+                                      unsigned int sequence_no,
+                                      void *user_param);
+
+/*******************************************************************************
+**************************   GLOBAL FUNCTIONS   *******************************
+*******************************************************************************/
+
+/***************************************************************************//**
+ * Initializes an EUSART instance as an SPI leader.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_init(sl_eusart_spi_handle_t *handle,
+                               const sl_eusart_spi_init_params_t *init_params)
+{
+  CORE_DECLARE_IRQ_STATE;
+  EUSART_TypeDef *eusart;
+  sl_dma_signal_t tx_signal, rx_signal;
+  sl_clock_branch_t clock_branch;
+  uint32_t ref_freq;
+  int8_t eusart_num;
+  bool sclk_idle_high;
+  sl_hal_eusart_spi_init_t spi_init = SL_HAL_EUSART_SPI_MASTER_INIT_DEFAULT_HF;
+  sl_hal_eusart_spi_advanced_init_t spi_advanced_init = SL_HAL_EUSART_SPI_ADVANCED_INIT_DEFAULT;
+
+  // Parameter validation
+  if (handle == NULL || init_params == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  // Validate EUSART peripheral instance
+  eusart = sl_device_peripheral_eusart_get_base_addr(init_params->eusart_peripheral);
+  if (!SL_HAL_EUSART_REF_VALID(eusart)) {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+  eusart_num = EUSART_NUM(eusart);
+  // Validate the DMA signals of the instance
+  tx_signal = sl_device_peripheral_get_eusart_txfl_dma_signal(init_params->eusart_peripheral);
+  rx_signal = sl_device_peripheral_get_eusart_rxfl_dma_signal(init_params->eusart_peripheral);
+  if (tx_signal == NULL || rx_signal == NULL
+      || *tx_signal == EUSART_SPI_DMA_SIGNAL_INVALID || *rx_signal == EUSART_SPI_DMA_SIGNAL_INVALID) {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+  // Validate the bit rate against the EUSART clock
+  clock_branch = sl_device_peripheral_get_clock_branch(init_params->eusart_peripheral);
+  if (sl_clock_manager_get_clock_branch_frequency(clock_branch, &ref_freq) != SL_STATUS_OK) {
+    return SL_STATUS_FAIL;
+  }
+  if (init_params->bitrate == 0
+      || init_params->bitrate > ref_freq
+      || (ref_freq / init_params->bitrate - 1UL) > EUSART_SPI_MAX_CLOCK_DIV) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  // DMA Configuration
+  DMADRV_Init();
+  if (DMADRV_AllocateChannel(&handle->dma_tx_channel, NULL) != ECODE_EMDRV_DMADRV_OK) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_ALLOCATION_FAILED;
+  }
+  if (DMADRV_AllocateChannel(&handle->dma_rx_channel, NULL) != ECODE_EMDRV_DMADRV_OK) {
+    DMADRV_FreeChannel(handle->dma_tx_channel);
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_ALLOCATION_FAILED;
+  }
+  handle->dma_tx_signal = (DMADRV_PeripheralSignal_t)*tx_signal;
+  handle->dma_rx_signal = (DMADRV_PeripheralSignal_t)*rx_signal;
+
+  // Fill EUSART SPI handle structure with initialization parameters
+  handle->eusart_peripheral = init_params->eusart_peripheral;
+  handle->eusart = eusart;
+  handle->sclk_gpio = init_params->sclk_gpio;
+  handle->mosi_gpio = init_params->mosi_gpio;
+  handle->miso_gpio = init_params->miso_gpio;
+  handle->cs_gpio = init_params->cs_gpio;
+  handle->cs_control = init_params->cs_control;
+  handle->cs_asserted = false;
+  handle->state = SL_EUSART_SPI_STATE_IDLE;
+  handle->queue = NULL;
+  handle->active_transfer = NULL;
+  handle->offset = 0;
+  handle->chunk_len = 0;
+  handle->stream_callback = NULL;
+  handle->stream_user_data = NULL;
+
+  // Enable clocks
+  sl_clock_manager_enable_bus_clock(sl_device_peripheral_get_bus_clock(init_params->eusart_peripheral));
+  sl_clock_manager_enable_bus_clock(SL_BUS_CLOCK_GPIO);
+
+  // GPIO Configuration, SCLK idles at the level selected by the clock polarity
+  sclk_idle_high = (init_params->clock_mode == SL_HAL_EUSART_CLOCK_MODE_2)
+                   || (init_params->clock_mode == SL_HAL_EUSART_CLOCK_MODE_3);
+  sl_hal_gpio_set_pin_mode(&handle->sclk_gpio, SL_GPIO_MODE_PUSH_PULL, sclk_idle_high);
+  sl_hal_gpio_set_pin_mode(&handle->mosi_gpio, SL_GPIO_MODE_PUSH_PULL, 1);
+  sl_hal_gpio_set_pin_mode(&handle->miso_gpio, SL_GPIO_MODE_INPUT, 0);
+  if (handle->cs_control) {
+    sl_hal_gpio_set_pin_mode(&handle->cs_gpio, SL_GPIO_MODE_PUSH_PULL, 1);
+  }
+
+  // GPIO Routing, the chip select is driven as a GPIO so that it can span several DMA transfers
+  GPIO->EUSARTROUTE[eusart_num].TXROUTE = (uint32_t)((handle->mosi_gpio.port << _GPIO_EUSART_TXROUTE_PORT_SHIFT)
+                                                     | (handle->mosi_gpio.pin << _GPIO_EUSART_TXROUTE_PIN_SHIFT));
+  GPIO->EUSARTROUTE[eusart_num].RXROUTE = (uint32_t)((handle->miso_gpio.port << _GPIO_EUSART_RXROUTE_PORT_SHIFT)
+                                                     | (handle->miso_gpio.pin << _GPIO_EUSART_RXROUTE_PIN_SHIFT));
+  GPIO->EUSARTROUTE[eusart_num].SCLKROUTE = (uint32_t)((handle->sclk_gpio.port << _GPIO_EUSART_SCLKROUTE_PORT_SHIFT)
+                                                       | (handle->sclk_gpio.pin << _GPIO_EUSART_SCLKROUTE_PIN_SHIFT));
+  GPIO->EUSARTROUTE[eusart_num].ROUTEEN = GPIO_EUSART_ROUTEEN_TXPEN | GPIO_EUSART_ROUTEEN_RXPEN | GPIO_EUSART_ROUTEEN_SCLKPEN;
+
+  // EUSART Configuration
+  spi_advanced_init.auto_cs_enable = false;
+  spi_advanced_init.msb_first = init_params->msb_first;
+  spi_advanced_init.default_tx_data = tx_dummy;
+  spi_init.clock_div = sl_hal_eusart_spi_calculate_clock_div(ref_freq, init_params->bitrate);
+  spi_init.clock_mode = init_params->clock_mode;
+  spi_init.advanced_config = &spi_advanced_init;
+
+  sl_hal_eusart_init_spi(eusart, &spi_init);
+  sl_hal_eusart_enable(eusart);
+  sl_hal_eusart_enable_rx(eusart);
+  sl_hal_eusart_enable_tx(eusart);
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Deinitializes the EUSART SPI instance.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_deinit(sl_eusart_spi_handle_t *handle)
+{
+  CORE_DECLARE_IRQ_STATE;
+  int8_t eusart_num;
+
+  // Validate handle
+  if (handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  // Abort the transfers in progress, their callbacks are invoked here
+  sl_eusart_spi_abort(handle);
+
+  CORE_ENTER_ATOMIC();
+
+  eusart_num = EUSART_NUM(handle->eusart);
+
+  // De-Allocate DMA channels
+  DMADRV_FreeChannel(handle->dma_tx_channel);
+  DMADRV_FreeChannel(handle->dma_rx_channel);
+
+  // Reset and disable the EUSART peripheral
+  sl_hal_eusart_reset(handle->eusart);
+
+  // Reset GPIO configuration
+  GPIO->EUSARTROUTE[eusart_num].ROUTEEN = _GPIO_EUSART_ROUTEEN_RESETVALUE;
+  GPIO->EUSARTROUTE[eusart_num].TXROUTE = _GPIO_EUSART_TXROUTE_RESETVALUE;
+  GPIO->EUSARTROUTE[eusart_num].RXROUTE = _GPIO_EUSART_RXROUTE_RESETVALUE;
+  GPIO->EUSARTROUTE[eusart_num].SCLKROUTE = _GPIO_EUSART_SCLKROUTE_RESETVALUE;
+
+  sl_hal_gpio_set_pin_mode(&handle->sclk_gpio, SL_GPIO_MODE_DISABLED, 0);
+  sl_hal_gpio_set_pin_mode(&handle->mosi_gpio, SL_GPIO_MODE_DISABLED, 0);
+  sl_hal_gpio_set_pin_mode(&handle->miso_gpio, SL_GPIO_MODE_DISABLED, 0);
+  if (handle->cs_control) {
+    sl_hal_gpio_set_pin_mode(&handle->cs_gpio, SL_GPIO_MODE_DISABLED, 0);
+  }
+
+  // Disable the clock for the EUSART peripheral
+  sl_clock_manager_disable_bus_clock(sl_device_peripheral_get_bus_clock(handle->eusart_peripheral));
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Queue a full-duplex transfer (non-blocking).
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_enqueue_transfer(sl_eusart_spi_handle_t *handle,
+                                           sl_eusart_spi_transfer_t *transfer)
+{
+  CORE_DECLARE_IRQ_STATE;
+  sl_status_t status = SL_STATUS_OK;
+  sl_eusart_spi_transfer_t **link;
+
+  // Validate input parameters
+  if (handle == NULL || transfer == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if (transfer->len == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  if (handle->state == SL_EUSART_SPI_STATE_STREAM) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
+  // A transfer can only be queued once
+  for (link = &handle->queue; *link != NULL; link = &(*link)->next) {
+    if (*link == transfer) {
+      CORE_EXIT_ATOMIC();
+      return SL_STATUS_BUSY;
+    }
+  }
+  if (transfer == handle->active_transfer) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
+  transfer->next = NULL;
+  if (handle->active_transfer == NULL) {
+    // Bus is free, start the transfer right away
+    status = eusart_spi_start_transfer(handle, transfer);
+  } else {
+    // Append after the last pending transfer
+    *link = transfer;
+  }
+
+  CORE_EXIT_ATOMIC();
+  return status;
+}
+
+/***************************************************************************//**
+ * Start a double-buffered full-duplex stream (non-blocking).
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_start_stream(sl_eusart_spi_handle_t *handle,
+                                       const uint8_t *tx_buffer0,
+                                       const uint8_t *tx_buffer1,
+                                       uint8_t *rx_buffer0,
+                                       uint8_t *rx_buffer1,
+                                       uint32_t len,
+                                       sl_eusart_spi_stream_callback_t callback,
+                                       void *user_data)
+{
+  CORE_DECLARE_IRQ_STATE;
+  Ecode_t ecode;
+  bool tx_inc = (tx_buffer0 != NULL);
+  bool rx_inc = (rx_buffer0 != NULL);
+
+  // Validate input parameters
+  if (handle == NULL || callback == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if ((tx_buffer0 == NULL) != (tx_buffer1 == NULL)
+      || (rx_buffer0 == NULL) != (rx_buffer1 == NULL)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  // Each buffer is exchanged by a single DMA transfer
+  if (len == 0 || len > (uint32_t)DMADRV_MAX_XFER_COUNT) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  if (handle->state != SL_EUSART_SPI_STATE_IDLE) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
+  handle->stream_callback = callback;
+  handle->stream_user_data = user_data;
+  handle->state = SL_EUSART_SPI_STATE_STREAM;
+  eusart_spi_assert_cs(handle);
+
+  // RX is armed first so that no received byte is missed
+  ecode = DMADRV_PeripheralMemoryPingPong(handle->dma_rx_channel,
+                                          handle->dma_rx_signal,
+                                          rx_inc ? (void *)rx_buffer0 : (void *)&rx_dummy,
+                                          rx_inc ? (void *)rx_buffer1 : (void *)&rx_dummy,
+                                          (void *)&handle->eusart->RXDATA,
+                                          rx_inc,
+                                          (int)len,
+                                          dmadrvDataSize1,
+                                          eusart_spi_stream_rx_done,
+                                          handle);
+  if (ecode == ECODE_EMDRV_DMADRV_OK) {
+    ecode = DMADRV_MemoryPeripheralPingPong(handle->dma_tx_channel,
+                                            handle->dma_tx_signal,
+                                            (void *)&handle->eusart->TXDATA,
+                                            tx_inc ? (void *)tx_buffer0 : (void *)&tx_dummy,
+                                            tx_inc ? (void *)tx_buffer1 : (void *)&tx_dummy,
+                                            tx_inc,
+                                            (int)len,
+                                            dmadrvDataSize1,
+                                            NULL,
+                                            NULL);
+  }
+  if (ecode != ECODE_EMDRV_DMADRV_OK) {
+    eusart_spi_stop_dma(handle);
+    handle->state = SL_EUSART_SPI_STATE_IDLE;
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_FAIL;
+  }
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Stop the stream in progress.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_stop_stream(sl_eusart_spi_handle_t *handle)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  // Validate input parameters
+  if (handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  if (handle->state != SL_EUSART_SPI_STATE_STREAM) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  eusart_spi_stop_dma(handle);
+  handle->state = SL_EUSART_SPI_STATE_IDLE;
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Abort the transfers in progress.
+ ******************************************************************************/
+sl_status_t sl_eusart_spi_abort(sl_eusart_spi_handle_t *handle)
+{
+  CORE_DECLARE_IRQ_STATE;
+  sl_eusart_spi_transfer_t *transfer;
+  sl_eusart_spi_transfer_t *next;
+
+  // Validate input parameters
+  if (handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  if (handle->state != SL_EUSART_SPI_STATE_IDLE) {
+    eusart_spi_stop_dma(handle);
+  }
+
+  // Detach the active transfer and the pending ones, in execution order
+  transfer = handle->active_transfer;
+  if (transfer != NULL) {
+    transfer->next = handle->queue;
+  } else {
+    transfer = handle->queue;
+  }
+  handle->active_transfer = NULL;
+  handle->queue = NULL;
+  handle->state = SL_EUSART_SPI_STATE_IDLE;
+
+  // Release a chip select left asserted by a chained transfer
+  eusart_spi_deassert_cs(handle);
+
+  CORE_EXIT_ATOMIC();
+
+  for (; transfer != NULL; transfer = next) {
+    next = transfer->next;
+    transfer->next = NULL;
+    if (transfer->callback != NULL) {
+      transfer->callback(handle, transfer, SL_STATUS_ABORT, transfer->user_data);
+    }
+  }
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ ***************************   LOCAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Assert the chip select if it is managed by the driver.
+ *
+ * @param[in] handle Pointer to the EUSART SPI handle structure.
+ ******************************************************************************/
+static void eusart_spi_assert_cs(sl_eusart_spi_handle_t *handle)
+{
+  if (handle->cs_control && !handle->cs_asserted) {
+    sl_hal_gpio_clear_pin(&handle->cs_gpio);
+    handle->cs_asserted = true;
+  }
+}
+
+/***************************************************************************//**
+ * Deassert the chip select if it is managed by the driver.
+ *
+ * @param[in] handle Pointer to the EUSART SPI handle structure.
+ ******************************************************************************/
+static void eusart_spi_deassert_cs(sl_eusart_spi_handle_t *handle)
+{
+  if (handle->cs_control && handle->cs_asserted) {
+    sl_hal_gpio_set_pin(&handle->cs_gpio);
+    handle->cs_asserted = false;
+  }
+}
+
+/***************************************************************************//**
+ * Stop both DMA channels and drop the frames left in the EUSART FIFOs.
+ *
+ * @details
+ *   The receiver and transmitter are disabled while the FIFOs are cleared and
+ *   enabled again afterwards. The chip select is released.
+ *
+ * @param[in] handle Pointer to the EUSART SPI handle structure.
+ ******************************************************************************/
+static void eusart_spi_stop_dma(sl_eusart_spi_handle_t *handle)
+{
+  DMADRV_StopTransfer(handle->dma_tx_channel);
+  DMADRV_StopTransfer(handle->dma_rx_channel);
+
+  sl_hal_eusart_disable_tx(handle->eusart);
+  sl_hal_eusart_disable_rx(handle->eusart);
+  sl_hal_eusart_wait_sync(handle->eusart, EUSART_SYNCBUSY_RXDIS | EUSART_SYNCBUSY_TXDIS);
+  sl_hal_eusart_clear_tx(handle->eusart);
+  sl_hal_eusart_clear_rx(handle->eusart);
+  sl_hal_eusart_enable_rx(handle->eusart);
+  sl_hal_eusart_enable_tx(handle->eusart);
+
+  eusart_spi_deassert_cs(handle);
+}
+
+/***************************************************************************//**
+ * Start the DMA transfers for the next chunk of the active transfer.
+ *
+ * @details
+ *   A chunk is at most one DMA transfer long. The RX channel signals the end
+ *   of the chunk, which is always after the TX channel is done.
+ *
+ * @param[in] handle Pointer to the EUSART SPI handle structure.
+ *
+ * @return SL_STATUS_OK if both channels were started, SL_STATUS_FAIL otherwise.
+ ******************************************************************************/
+static sl_status_t eusart_spi_start_chunk(sl_eusart_spi_handle_t *handle)
+{
+  sl_eusart_spi_transfer_t *transfer = handle->active_transfer;
+  uint32_t remaining = transfer->len - handle->offset;
+  bool tx_inc = (transfer->tx_buffer != NULL);
+  bool rx_inc = (transfer->rx_buffer != NULL);
+  void *tx = tx_inc ? (void *)(transfer->tx_buffer + handle->offset) : (void *)&tx_dummy;
+  void *rx = rx_inc ? (void *)(transfer->rx_buffer + handle->offset) : (void *)&rx_dummy;
+
+  handle->chunk_len = (remaining > (uint32_t)DMADRV_MAX_XFER_COUNT) ? (uint32_t)DMADRV_MAX_XFER_COUNT : remaining;
+
+  // RX is armed first so that no received byte is missed
+  if (DMADRV_PeripheralMemory(handle->dma_rx_channel,
+                              handle->dma_rx_signal,
+                              rx,
+                              (void *)&handle->eusart->RXDATA,
+                              rx_inc,
+                              (int)handle->chunk_len,
+                              dmadrvDataSize1,
+                              eusart_spi_transfer_rx_done,
+                              handle) != ECODE_EMDRV_DMADRV_OK) {
+    return SL_STATUS_FAIL;
+  }
+  if (DMADRV_MemoryPeripheral(handle->dma_tx_channel,
+                              handle->dma_tx_signal,
+                              (void *)&handle->eusart->TXDATA,
+                              tx,
+                              tx_inc,
+                              (int)handle->chunk_len,
+                              dmadrvDataSize1,
+                              NULL,
+                              NULL) != ECODE_EMDRV_DMADRV_OK) {
+    DMADRV_StopTransfer(handle->dma_rx_channel);
+    return SL_STATUS_FAIL;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Start a transfer on the bus.
+ *
+ * @param[in] handle   Pointer to the EUSART SPI handle structure.
+ * @param[in] transfer Pointer to the transfer to start.
+ *
+ * @return SL_STATUS_OK if the transfer was started, SL_STATUS_FAIL otherwise.
+ ******************************************************************************/
+static sl_status_t eusart_spi_start_transfer(sl_eusart_spi_handle_t *handle,
+                                             sl_eusart_spi_transfer_t *transfer)
+{
+  handle->active_transfer = transfer;
+  handle->offset = 0;
+  handle->state = SL_EUSART_SPI_STATE_TRANSFER;
+  eusart_spi_assert_cs(handle);
+
+  if (eusart_spi_start_chunk(handle) != SL_STATUS_OK) {
+    eusart_spi_deassert_cs(handle);
+    handle->active_transfer = NULL;
+    handle->state = SL_EUSART_SPI_STATE_IDLE;
+    return SL_STATUS_FAIL;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Start the first pending transfer of the queue.
+ *
+ * @details
+ *   Transfers that cannot be started are ended with SL_STATUS_FAIL and the
+ *   next pending transfer is tried, until one is on the bus or the queue is
+ *   empty.
+ *
+ * @param[in] handle Pointer to the EUSART SPI handle structure.
+ ******************************************************************************/
+static void eusart_spi_start_next_transfer(sl_eusart_spi_handle_t *handle)
+{
+  sl_eusart_spi_transfer_t *transfer;
+
+  // A callback below can enqueue a transfer, which then starts right away
+  while (handle->active_transfer == NULL && (transfer = handle->queue) != NULL) {
+    handle->queue = transfer->next;
+    transfer->next = NULL;
+    if (eusart_spi_start_transfer(handle, transfer) == SL_STATUS_OK) {
+      return;
+    }
+    if (transfer->callback != NULL) {
+      transfer->callback(handle, transfer, SL_STATUS_FAIL, transfer->user_data);
+    }
+  }
+}
+
+/***************************************************************************//**
+ * RX DMA completion callback of a queued transfer chunk.
+ *
+ * @details
+ *   Starts the next chunk, or ends the transfer and starts the next pending
+ *   one before invoking the callback of the ended transfer, so that the bus
+ *   is not left idle while the callback runs.
+ *
+ * @param[in] channel     DMA channel.
+ * @param[in] sequence_no Number of completions of the DMA transfer.
+ * @param[in] user_param  Pointer to the EUSART SPI handle structure.
+ *
+ * @return Always true.
+ ******************************************************************************/
+static bool eusart_spi_transfer_rx_done(unsigned int channel,
+                                        unsigned int sequence_no,
+                                        void *user_param)
+{
+  sl_eusart_spi_handle_t *handle = (sl_eusart_spi_handle_t *)user_param;
+  sl_eusart_spi_transfer_t *transfer = handle->active_transfer;
+  sl_status_t status = SL_STATUS_OK;
+
+  (void)channel;
+  (void)sequence_no;
+
+  // The transfer was aborted
+  if (transfer == NULL) {
+    return true;
+  }
+
+  handle->offset += handle->chunk_len;
+  if (handle->offset < transfer->len) {
+    if (eusart_spi_start_chunk(handle) == SL_STATUS_OK) {
+      return true;
+    }
+    status = SL_STATUS_FAIL;
+  }
+
+  if (status != SL_STATUS_OK || !transfer->keep_cs_asserted) {
+    eusart_spi_deassert_cs(handle);
+  }
+  handle->active_transfer = NULL;
+  handle->state = SL_EUSART_SPI_STATE_IDLE;
+  eusart_spi_start_next_transfer(handle);
+
+  if (transfer->callback != NULL) {
+    transfer->callback(handle, transfer, status, transfer->user_data);
+  }
+
+  return true;
+}
+
+/***************************************************************************//**
+ * RX DMA completion callback of a stream buffer.
+ *
+ * @param[in] channel     DMA channel.
+ * @param[in] sequence_no Number of completions of the DMA transfer, starting at 1.
+ * @param[in] user_param  Pointer to the EUSART SPI handle structure.
+ *
+ * @return true to keep the ping-pong transfer running, false otherwise.
+ ******************************************************************************/
+static bool eusart_spi_stream_rx_done(unsigned int channel,
+                                      unsigned int sequence_no,
+                                      void *user_param)
+{
+  sl_eusart_spi_handle_t *handle = (sl_eusart_spi_handle_t *)user_param;
+  bool keep_streaming;
+
+  (void)channel;
+
+  if (handle->state != SL_EUSART_SPI_STATE_STREAM) {
+    return false;
+  }
+
+  keep_streaming = handle->stream_callback(handle, (sequence_no - 1U) & 1U, handle->stream_user_data);
+
+  // The callback can also stop the stream through the API
+  if (handle->state != SL_EUSART_SPI_STATE_STREAM) {
+    return false;
+  }
+  if (!keep_streaming) {
+    eusart_spi_stop_dma(handle);
+    handle->state = SL_EUSART_SPI_STATE_IDLE;
+    return false;
+  }
+
+  return true;
+}
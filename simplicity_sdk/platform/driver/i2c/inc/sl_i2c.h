@@ -122,6 +122,7 @@ SL_ENUM(sl_i2c_transaction_state_t) {
  ******************************************************************************/
 
 typedef struct sl_i2c_handle_t sl_i2c_handle_t;  ///< Forward declaration of I2C handle type
+typedef struct sl_i2c_job_t sl_i2c_job_t;        ///< Forward declaration of I2C job type
 
 /***************************************************************************//**
  * @brief Transfer Complete Callback
@@ -153,6 +154,19 @@ typedef sl_status_t (*sl_i2c_transfer_complete_callback_t)(sl_i2c_handle_t *i2c_
  ******************************************************************************/
 typedef sl_status_t (*sl_i2c_event_callback_t)(sl_i2c_handle_t *i2c_handle, sl_i2c_event_t event, void *user_data);
 
+/***************************************************************************//**
+ * @brief I2C Job Callback
+ * @note  Invoked from interrupt context once a queued job has ended. The next
+ *        queued job is already started on the bus when the callback runs, so
+ *        the job structure and its buffers can be reused right away.
+ * @param[in] i2c_handle   Pointer to the I2C driver handle.
+ * @param[in] job          Pointer to the job that ended.
+ * @param[in] event        SL_I2C_EVENT_COMPLETED on success, otherwise the
+ *                         error event that ended the job.
+ * @param[in] user_data    User-defined data of the job.
+ ******************************************************************************/
+typedef void (*sl_i2c_job_callback_t)(sl_i2c_handle_t *i2c_handle, sl_i2c_job_t *job, sl_i2c_event_t event, void *user_data);
+
 /*******************************************************************************
  *******************************   STRUCTS   ***********************************
  ******************************************************************************/
@@ -192,6 +206,28 @@ typedef struct {
   sl_gpio_t sda_gpio;                             ///< SDA GPIO Port and Pin (Serial Data Line)
 } sl_i2c_init_params_t;
 
+/**
+ * @struct sl_i2c_job_t
+ * @brief Leader mode transaction queued with @ref sl_i2c_leader_enqueue_job().
+ *        The job is a write when only tx_len is non-zero, a read when only
+ *        rx_len is non-zero and a write followed by a read with a repeated
+ *        start when both are non-zero.
+ * @note  The job structure and its buffers are owned by the driver from the
+ *        moment the job is enqueued until its callback is invoked or the job
+ *        is canceled. The `next` member is reserved for the driver.
+ */
+typedef struct sl_i2c_job_t {
+  uint16_t                        address;                ///< Follower device address (7-bit or 10-bit)
+  const uint8_t                   *tx_buffer;             ///< Data to send, NULL if tx_len is 0
+  uint32_t                        tx_len;                 ///< Number of bytes to send
+  uint8_t                         *rx_buffer;             ///< Buffer for received data, NULL if rx_len is 0
+  uint32_t                        rx_len;                 ///< Number of bytes to receive
+  uint8_t                         priority;               ///< Queue priority, higher values are executed first
+  sl_i2c_job_callback_t           callback;               ///< Job callback, can be NULL
+  void                            *user_data;             ///< User defined data passed to the callback
+  struct sl_i2c_job_t             *next;                  ///< Next job in the queue (driver internal)
+} sl_i2c_job_t;
+
 /**
  * @struct sl_i2c_handle_t
  * @brief Represents an I2C instance handle.
@@ -234,6 +270,11 @@ typedef struct sl_i2c_handle_t {
   sl_i2c_transfer_complete_callback_t transfer_complete_callback;  ///< Transfer complete callback
   sl_i2c_event_callback_t             event_callback;              ///< Event callback
   void*                               user_data;                   ///< User defined data
+
+  // Leader mode job queue
+  sl_i2c_job_t                        *job_queue;                  ///< Pending jobs, highest priority first
+  sl_i2c_job_t                        *active_job;                 ///< Job currently on the bus
+  bool                                leader_transfer_active;      ///< Non-blocking transfer started outside the queue owns the bus
 } sl_i2c_handle_t;
 
 /*******************************************************************************
@@ -356,6 +397,7 @@ sl_status_t sl_i2c_configure_dma(sl_i2c_handle_t *i2c_handle,
  *   - SL_STATUS_OK on success.
  *   - SL_STATUS_NULL_POINTER if arguments are NULL.
  *   - SL_STATUS_INVALID_MODE if not in leader mode.
+ *   - SL_STATUS_BUSY if queued jobs are pending.
  *   - SL_STATUS_INVALID_PARAMETER if length/address invalid.
  *   - SL_STATUS_TIMEOUT if operation timed out.
  *   - SL_STATUS_NOT_FOUND if address NACK received.
@@ -384,6 +426,7 @@ sl_status_t sl_i2c_leader_send_blocking(sl_i2c_handle_t *i2c_handle,
  *   - SL_STATUS_OK on success.
  *   - SL_STATUS_NULL_POINTER if arguments are NULL.
  *   - SL_STATUS_INVALID_MODE if not in leader mode.
+ *   - SL_STATUS_BUSY if queued jobs are pending.
  *   - SL_STATUS_INVALID_PARAMETER if length/address invalid.
  *   - SL_STATUS_TIMEOUT if operation timed out.
  *   - SL_STATUS_NOT_FOUND if address NACK received.
@@ -414,6 +457,7 @@ sl_status_t sl_i2c_leader_receive_blocking(sl_i2c_handle_t *i2c_handle,
  *   - SL_STATUS_OK on success.
  *   - SL_STATUS_NULL_POINTER if arguments are NULL.
  *   - SL_STATUS_INVALID_MODE if not in leader mode.
+ *   - SL_STATUS_BUSY if queued jobs are pending.
  *   - SL_STATUS_INVALID_PARAMETER if lengths/address invalid.
  *   - SL_STATUS_TIMEOUT if operation timed out.
  *   - SL_STATUS_NOT_FOUND if address NACK received.
@@ -444,6 +488,7 @@ sl_status_t sl_i2c_leader_transfer_blocking(sl_i2c_handle_t *i2c_handle,
  *   - SL_STATUS_OK if transfer initiated successfully.
  *   - SL_STATUS_NULL_POINTER if arguments are NULL.
  *   - SL_STATUS_INVALID_MODE if not in leader mode.
+ *   - SL_STATUS_BUSY if queued jobs are pending.
  *   - SL_STATUS_INVALID_PARAMETER if length/address invalid.
  *   - Other error codes for DMA/IRQ setup failures.
  ******************************************************************************/
@@ -469,6 +514,7 @@ sl_status_t sl_i2c_leader_send_non_blocking(sl_i2c_handle_t *i2c_handle,
  *   - SL_STATUS_OK if transfer initiated successfully.
  *   - SL_STATUS_NULL_POINTER if arguments are NULL.
  *   - SL_STATUS_INVALID_MODE if not in leader mode.
+ *   - SL_STATUS_BUSY if queued jobs are pending.
  *   - SL_STATUS_INVALID_PARAMETER if length/address invalid.
  *   - Other error codes for DMA/IRQ setup failures.
  ******************************************************************************/
@@ -497,6 +543,7 @@ sl_status_t sl_i2c_leader_receive_non_blocking(sl_i2c_handle_t *i2c_handle,
  *   - SL_STATUS_OK if transfer initiated successfully.
  *   - SL_STATUS_NULL_POINTER if arguments are NULL.
  *   - SL_STATUS_INVALID_MODE if not in leader mode.
+ *   - SL_STATUS_BUSY if queued jobs are pending.
  *   - SL_STATUS_INVALID_PARAMETER if lengths/address invalid.
  *   - Other error codes for DMA/IRQ setup failures.
  ******************************************************************************/
@@ -644,6 +691,49 @@ sl_status_t sl_i2c_set_transfer_complete_callback(sl_i2c_handle_t *i2c_handle,
 sl_status_t sl_i2c_set_event_callback(sl_i2c_handle_t *i2c_handle,
                                       sl_i2c_event_callback_t callback);
 
+/***************************************************************************//**
+ * Leader Mode: Queue a transaction for a follower device (non-blocking).
+ * @details Adds the job to the transaction queue of the I2C instance and
+ *          starts it right away if the bus is free. Queued jobs are executed
+ *          back to back: when a job ends, the next one is started from the
+ *          I2C interrupt before the callback of the ended job is invoked,
+ *          which keeps the bus idle time between jobs to a minimum.
+ *          Jobs are ordered by decreasing priority, and jobs of equal
+ *          priority are executed in submission order. A job on the bus is
+ *          never preempted.
+ * @note  While jobs are queued, the other leader mode transfer APIs return
+ *        SL_STATUS_BUSY. Likewise, jobs cannot be queued until a non-blocking
+ *        transfer started with those APIs has released the bus. The transfer
+ *        complete and event callbacks of the handle are not invoked for queued
+ *        jobs.
+ * @param[in] i2c_handle   Pointer to the I2C instance handle.
+ * @param[in] job          Pointer to the job to queue.
+ * @return
+ *   - SL_STATUS_OK if the job was queued or started.
+ *   - SL_STATUS_NULL_POINTER if arguments or the job buffers are NULL.
+ *   - SL_STATUS_INVALID_MODE if not in leader mode.
+ *   - SL_STATUS_INVALID_PARAMETER if lengths/address invalid.
+ *   - SL_STATUS_BUSY if the job is already queued or a non-blocking
+ *     transfer started with the other leader mode APIs is in progress.
+ *   - Other error codes for DMA/IRQ setup failures.
+ ******************************************************************************/
+sl_status_t sl_i2c_leader_enqueue_job(sl_i2c_handle_t *i2c_handle,
+                                      sl_i2c_job_t *job);
+
+/***************************************************************************//**
+ * Leader Mode: Remove a pending job from the transaction queue.
+ * @details The callback of a canceled job is not invoked.
+ * @param[in] i2c_handle   Pointer to the I2C instance handle.
+ * @param[in] job          Pointer to the job to cancel.
+ * @return
+ *   - SL_STATUS_OK if the job was removed from the queue.
+ *   - SL_STATUS_NULL_POINTER if arguments are NULL.
+ *   - SL_STATUS_BUSY if the job is already on the bus.
+ *   - SL_STATUS_NOT_FOUND if the job is not queued.
+ ******************************************************************************/
+sl_status_t sl_i2c_leader_cancel_job(sl_i2c_handle_t *i2c_handle,
+                                     sl_i2c_job_t *job);
+
 /** @} (end addtogroup i2c driver) */
 
 #ifdef __cplusplus
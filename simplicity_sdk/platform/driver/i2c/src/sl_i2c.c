@@ -123,6 +123,10 @@ static sl_status_t i2c_setup_follower_non_blocking_dma_transfer(sl_i2c_handle_t
                                                                 uint32_t tx_len,
                                                                 uint8_t *rx_buffer,
                                                                 uint32_t rx_len);
+static sl_status_t i2c_leader_start_job(sl_i2c_handle_t *i2c_handle,
+                                        sl_i2c_job_t *job);
+static void i2c_leader_start_next_job(sl_i2c_handle_t *i2c_handle);
+static void i2c_leader_job_done(sl_i2c_handle_t *i2c_handle);
 static void i2c_common_irq_handler(uint8_t i2c_instance);
 
 /*******************************************************************************
@@ -200,6 +204,9 @@ sl_status_t sl_i2c_init(sl_i2c_handle_t *i2c_handle,
   i2c_handle->frequency_mode = init_params->frequency_mode;
   i2c_handle->scl_gpio = init_params->scl_gpio;
   i2c_handle->sda_gpio = init_params->sda_gpio;
+  i2c_handle->job_queue = NULL;
+  i2c_handle->active_job = NULL;
+  i2c_handle->leader_transfer_active = false;
 
   // DMA Configuration
   DMADRV_Init();
@@ -269,6 +276,11 @@ sl_status_t sl_i2c_deinit(sl_i2c_handle_t *i2c_handle)
   i2c_bus_clk = sl_device_peripheral_get_bus_clock(i2c_handle->i2c_peripheral);
   sl_clock_manager_disable_bus_clock(i2c_bus_clk);
 
+  // Drop the queued jobs, their callbacks are not invoked
+  i2c_handle->job_queue = NULL;
+  i2c_handle->active_job = NULL;
+  i2c_handle->leader_transfer_active = false;
+
   // Clear the initialization flag
   i2c_handle_contexts[i2c_instance_num] = NULL;
 
@@ -460,6 +472,12 @@ sl_status_t sl_i2c_leader_send_blocking(sl_i2c_handle_t *i2c_handle,
 
   CORE_ENTER_ATOMIC();
 
+  // Queued jobs own the bus until the queue is drained
+  if (i2c_handle->active_job != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize transaction parameters
   i2c_handle->follower_address = address;
   i2c_handle->tx_offset = 0;
@@ -505,6 +523,12 @@ sl_status_t sl_i2c_leader_receive_blocking(sl_i2c_handle_t *i2c_handle,
 
   CORE_ENTER_ATOMIC();
 
+  // Queued jobs own the bus until the queue is drained
+  if (i2c_handle->active_job != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize transaction parameters
   i2c_handle->follower_address = address;
   i2c_handle->rx_offset = 0;
@@ -552,6 +576,12 @@ sl_status_t sl_i2c_leader_transfer_blocking(sl_i2c_handle_t *i2c_handle,
 
   CORE_ENTER_ATOMIC();
 
+  // Queued jobs own the bus until the queue is drained
+  if (i2c_handle->active_job != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize transaction parameters
   i2c_handle->follower_address = address;
   i2c_handle->tx_offset = 0;
@@ -595,6 +625,12 @@ sl_status_t sl_i2c_leader_send_non_blocking(sl_i2c_handle_t *i2c_handle,
 
   CORE_ENTER_ATOMIC();
 
+  // Queued jobs own the bus until the queue is drained
+  if (i2c_handle->active_job != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize transaction parameters
   i2c_handle->follower_address = address;
   i2c_handle->transfer_direction = SL_I2C_WRITE;
@@ -602,6 +638,7 @@ sl_status_t sl_i2c_leader_send_non_blocking(sl_i2c_handle_t *i2c_handle,
   i2c_handle->user_data = user_data;
 
   status = i2c_setup_leader_non_blocking_dma_transfer(i2c_handle, tx_buffer, tx_len, NULL, 0);
+  i2c_handle->leader_transfer_active = (status == SL_STATUS_OK);
 
   CORE_EXIT_ATOMIC();
 
@@ -635,6 +672,12 @@ sl_status_t sl_i2c_leader_receive_non_blocking(sl_i2c_handle_t *i2c_handle,
 
   CORE_ENTER_ATOMIC();
 
+  // Queued jobs own the bus until the queue is drained
+  if (i2c_handle->active_job != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize transaction parameters
   i2c_handle->follower_address = address;
   i2c_handle->transfer_direction = SL_I2C_READ;
@@ -642,6 +685,7 @@ sl_status_t sl_i2c_leader_receive_non_blocking(sl_i2c_handle_t *i2c_handle,
   i2c_handle->user_data = user_data;
 
   status = i2c_setup_leader_non_blocking_dma_transfer(i2c_handle, NULL, 0, rx_buffer, rx_len);
+  i2c_handle->leader_transfer_active = (status == SL_STATUS_OK);
 
   CORE_EXIT_ATOMIC();
 
@@ -677,6 +721,12 @@ sl_status_t sl_i2c_leader_transfer_non_blocking(sl_i2c_handle_t *i2c_handle,
 
   CORE_ENTER_ATOMIC();
 
+  // Queued jobs own the bus until the queue is drained
+  if (i2c_handle->active_job != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize i2c instance structure
   i2c_handle->follower_address = address;
   i2c_handle->transfer_direction = SL_I2C_WRITE_READ;
@@ -684,6 +734,7 @@ sl_status_t sl_i2c_leader_transfer_non_blocking(sl_i2c_handle_t *i2c_handle,
   i2c_handle->user_data = user_data;
 
   status = i2c_setup_leader_non_blocking_dma_transfer(i2c_handle, tx_buffer, tx_len, rx_buffer, rx_len);
+  i2c_handle->leader_transfer_active = (status == SL_STATUS_OK);
 
   CORE_EXIT_ATOMIC();
 
@@ -885,6 +936,109 @@ sl_status_t sl_i2c_set_event_callback(sl_i2c_handle_t *i2c_handle,
   return SL_STATUS_OK;
 }
 
+/***************************************************************************//**
+ * Leader Mode: Queue a transaction for a follower device (non-blocking).
+ ******************************************************************************/
+sl_status_t sl_i2c_leader_enqueue_job(sl_i2c_handle_t *i2c_handle,
+                                      sl_i2c_job_t *job)
+{
+  CORE_DECLARE_IRQ_STATE;
+  sl_status_t status = SL_STATUS_OK;
+  sl_i2c_job_t **link;
+
+  // Validate input parameters
+  if (i2c_handle == NULL || job == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if ((job->tx_len > 0 && job->tx_buffer == NULL)
+      || (job->rx_len > 0 && job->rx_buffer == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  // Only allow leader mode for this API
+  if (i2c_handle->operating_mode != SL_I2C_LEADER_MODE) {
+    return SL_STATUS_INVALID_MODE;
+  }
+  // Validate the job length and follower address range
+  if ((job->tx_len == 0 && job->rx_len == 0) || job->address > 0x3FF) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  // A job can only be queued once
+  for (link = &i2c_handle->job_queue; *link != NULL; link = &(*link)->next) {
+    if (*link == job) {
+      break;
+    }
+  }
+  if (job == i2c_handle->active_job || *link != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
+  // A non-blocking transfer started with the other APIs owns the bus
+  if (i2c_handle->leader_transfer_active) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
+  if (i2c_handle->active_job == NULL) {
+    // Bus is free, start the job right away
+    job->next = NULL;
+    i2c_handle->active_job = job;
+    status = i2c_leader_start_job(i2c_handle, job);
+    if (status != SL_STATUS_OK) {
+      i2c_handle->active_job = NULL;
+    }
+  } else {
+    // Insert after the jobs of higher or equal priority
+    for (link = &i2c_handle->job_queue; *link != NULL; link = &(*link)->next) {
+      if ((*link)->priority < job->priority) {
+        break;
+      }
+    }
+    job->next = *link;
+    *link = job;
+  }
+
+  CORE_EXIT_ATOMIC();
+  return status;
+}
+
+/***************************************************************************//**
+ * Leader Mode: Remove a pending job from the transaction queue.
+ ******************************************************************************/
+sl_status_t sl_i2c_leader_cancel_job(sl_i2c_handle_t *i2c_handle,
+                                     sl_i2c_job_t *job)
+{
+  CORE_DECLARE_IRQ_STATE;
+  sl_status_t status = SL_STATUS_NOT_FOUND;
+  sl_i2c_job_t **link;
+
+  // Validate input parameters
+  if (i2c_handle == NULL || job == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  if (job == i2c_handle->active_job) {
+    status = SL_STATUS_BUSY;
+  } else {
+    for (link = &i2c_handle->job_queue; *link != NULL; link = &(*link)->next) {
+      if (*link == job) {
+        *link = job->next;
+        job->next = NULL;
+        status = SL_STATUS_OK;
+        break;
+      }
+    }
+  }
+
+  CORE_EXIT_ATOMIC();
+  return status;
+}
+
 /*******************************************************************************
  **************************   INTERNAL FUNCTIONS   *****************************
  ******************************************************************************/
@@ -999,6 +1153,7 @@ void sli_i2c_leader_dispatch_interrupt(sl_i2c_handle_t *i2c_handle)
     sl_hal_i2c_disable_interrupts(i2c_base_addr, _I2C_IEN_MASK);
     stop_active_dma_transfers(i2c_handle);
     i2c_base_addr->CTRL = _I2C_CTRL_RESETVALUE;
+    i2c_handle->state = SL_I2C_STATE_IDLE;
     if (i2c_handle->event == SL_I2C_EVENT_IN_PROGRESS) {
       i2c_handle->event = SL_I2C_EVENT_COMPLETED;
     }
@@ -1007,6 +1162,7 @@ void sli_i2c_leader_dispatch_interrupt(sl_i2c_handle_t *i2c_handle)
     sl_hal_i2c_disable_interrupts(i2c_base_addr, _I2C_IEN_MASK);
     stop_active_dma_transfers(i2c_handle);
     i2c_base_addr->CMD = I2C_CMD_ABORT;
+    i2c_handle->state = SL_I2C_STATE_IDLE;
     if (pending_irq & I2C_IF_ARBLOST) {
       i2c_handle->event = SL_I2C_EVENT_ARBITRATION_LOST;
     } else if (pending_irq & I2C_IF_BUSERR) {
@@ -1123,6 +1279,12 @@ sl_status_t sli_i2c_leader_write_no_stop_blocking(sl_i2c_handle_t *i2c_handle,
 
   CORE_ENTER_ATOMIC();
 
+  // Queued jobs own the bus until the queue is drained
+  if (i2c_handle->active_job != NULL) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_BUSY;
+  }
+
   // Initialize transaction parameters
   i2c_handle->follower_address = address;
   i2c_handle->tx_offset = 0;
@@ -2112,6 +2274,93 @@ static sl_status_t i2c_setup_follower_non_blocking_dma_transfer(sl_i2c_handle_t
   return SL_STATUS_OK;
 }
 
+/***************************************************************************//**
+ * Start a queued job on the bus.
+ *
+ * @details
+ *   Loads the job parameters into the handle and sets up the leader mode DMA
+ *   transfer. The transfer direction is derived from the job lengths.
+ *
+ * @param[in] i2c_handle Pointer to the I2C handle structure.
+ * @param[in] job        Pointer to the job to start.
+ *
+ * @return Status code of the DMA transfer setup.
+ ******************************************************************************/
+static sl_status_t i2c_leader_start_job(sl_i2c_handle_t *i2c_handle,
+                                        sl_i2c_job_t *job)
+{
+  i2c_handle->follower_address = job->address;
+  i2c_handle->user_data = job->user_data;
+  if (job->tx_len > 0 && job->rx_len > 0) {
+    i2c_handle->transfer_direction = SL_I2C_WRITE_READ;
+  } else if (job->tx_len > 0) {
+    i2c_handle->transfer_direction = SL_I2C_WRITE;
+  } else {
+    i2c_handle->transfer_direction = SL_I2C_READ;
+  }
+
+  return i2c_setup_leader_non_blocking_dma_transfer(i2c_handle,
+                                                    job->tx_buffer,
+                                                    job->tx_len,
+                                                    job->rx_buffer,
+                                                    job->rx_len);
+}
+
+/***************************************************************************//**
+ * Start the first pending job of the queue.
+ *
+ * @details
+ *   Jobs that cannot be started are ended with SL_I2C_EVENT_SW_FAULT and the
+ *   next pending job is tried, until one is on the bus or the queue is empty.
+ *
+ * @param[in] i2c_handle Pointer to the I2C handle structure.
+ ******************************************************************************/
+static void i2c_leader_start_next_job(sl_i2c_handle_t *i2c_handle)
+{
+  sl_i2c_job_t *job;
+
+  // A callback below can enqueue a job, which then starts right away
+  while (i2c_handle->active_job == NULL && (job = i2c_handle->job_queue) != NULL) {
+    i2c_handle->job_queue = job->next;
+    job->next = NULL;
+    i2c_handle->active_job = job;
+    if (i2c_leader_start_job(i2c_handle, job) == SL_STATUS_OK) {
+      return;
+    }
+    i2c_handle->active_job = NULL;
+    if (job->callback != NULL) {
+      job->callback(i2c_handle, job, SL_I2C_EVENT_SW_FAULT, job->user_data);
+    }
+  }
+}
+
+/***************************************************************************//**
+ * End the active job once the bus is released.
+ *
+ * @details
+ *   Starts the next pending job before invoking the callback of the ended
+ *   job, so that the bus is not left idle while the callback runs.
+ *
+ * @param[in] i2c_handle Pointer to the I2C handle structure.
+ ******************************************************************************/
+static void i2c_leader_job_done(sl_i2c_handle_t *i2c_handle)
+{
+  sl_i2c_job_t *job = i2c_handle->active_job;
+  sl_i2c_event_t event = i2c_handle->event;
+
+  // A STOP without ACK from the follower ends the job without completing it
+  if (event == SL_I2C_EVENT_IN_PROGRESS || event == SL_I2C_EVENT_IDLE) {
+    event = SL_I2C_EVENT_STOP;
+  }
+
+  i2c_handle->active_job = NULL;
+  i2c_leader_start_next_job(i2c_handle);
+
+  if (job->callback != NULL) {
+    job->callback(i2c_handle, job, event, job->user_data);
+  }
+}
+
 /***************************************************************************//**
  * Function called by IRQ handlers to process I2C interrupts.
  *
@@ -2130,6 +2379,19 @@ static void i2c_common_irq_handler(uint8_t i2c_instance)
     sli_i2c_follower_dispatch_interrupt(i2c_handle);
   }
 
+  // Queued jobs are reported through their own callback once the bus is released
+  if (i2c_handle->active_job != NULL) {
+    if (i2c_handle->state == SL_I2C_STATE_IDLE) {
+      i2c_leader_job_done(i2c_handle);
+    }
+    return;
+  }
+
+  // The bus is released on STOP or abort, including after a NACK
+  if (i2c_handle->state == SL_I2C_STATE_IDLE) {
+    i2c_handle->leader_transfer_active = false;
+  }
+
   if (i2c_handle->event == SL_I2C_EVENT_COMPLETED) {
     if (i2c_handle->transfer_complete_callback) {
       i2c_handle->transfer_complete_callback(i2c_handle, i2c_handle->user_data);
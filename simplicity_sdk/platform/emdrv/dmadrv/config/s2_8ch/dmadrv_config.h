@@ -21,6 +21,34 @@
 // <i> Default: 0
 #define EMDRV_DMADRV_DMA_CH_PRIORITY 0
 
+// <o EMDRV_DMADRV_QUEUE_DEPTH> Number of queued transfers per channel
+// <0=> Disabled
+// <2=> 2
+// <4=> 4
+// <8=> 8
+// <16=> 16
+// <32=> 32
+// <i> Number of transfers that can be queued on a channel with
+// <i> DMADRV_MemoryPeripheralEnqueue() and DMADRV_PeripheralMemoryEnqueue().
+// <i> Each queued transfer uses one LDMA descriptor per channel. Must be 0,
+// <i> which disables transfer queues, or between 2 and 32.
+// <i> Default: 0
+#define EMDRV_DMADRV_QUEUE_DEPTH 0
+
+// <o EMDRV_DMADRV_RING_MAX_SEGMENTS> Number of descriptors per ring buffer <0-16>
+// <i> Maximum number of LDMA descriptors used by a ring buffer receive
+// <i> started with DMADRV_PeripheralMemoryRing(). A ring buffer is split in
+// <i> segments of one notification threshold each. 0 disables ring buffers.
+// <i> Default: 0
+#define EMDRV_DMADRV_RING_MAX_SEGMENTS 0
+
+// <q EMDRV_DMADRV_STATS_ENABLE> Enable per-channel interrupt statistics
+// <i> Count the completions of each channel and the CPU cycles spent in the
+// <i> DMA interrupt handler and in the callbacks, readable with
+// <i> DMADRV_GetChannelStats(). Uses the DWT cycle counter.
+// <i> Default: 0
+#define EMDRV_DMADRV_STATS_ENABLE 0
+
 // <<< end of configuration section >>>
 
 #endif // DMADRV_CONFIG_H
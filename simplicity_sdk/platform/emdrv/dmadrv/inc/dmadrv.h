@@ -34,6 +34,7 @@
 #include "em_device.h"
 
 #include "ecode.h"
+#include "sl_enum.h"
 
 #include "dmadrv_signals.h"
 
@@ -51,6 +52,26 @@
 #include "dmadrv_config.h"
 #include "sl_code_classification.h"
 
+#if !defined(EMDRV_DMADRV_QUEUE_DEPTH)
+#define EMDRV_DMADRV_QUEUE_DEPTH 0
+#endif
+
+#if (EMDRV_DMADRV_QUEUE_DEPTH == 1) || (EMDRV_DMADRV_QUEUE_DEPTH > 32)
+#error "EMDRV_DMADRV_QUEUE_DEPTH must be 0 or between 2 and 32"
+#endif
+
+#if !defined(EMDRV_DMADRV_RING_MAX_SEGMENTS)
+#define EMDRV_DMADRV_RING_MAX_SEGMENTS 0
+#endif
+
+#if (EMDRV_DMADRV_RING_MAX_SEGMENTS > 16)
+#error "EMDRV_DMADRV_RING_MAX_SEGMENTS must be between 0 and 16"
+#endif
+
+#if !defined(EMDRV_DMADRV_STATS_ENABLE)
+#define EMDRV_DMADRV_STATS_ENABLE 0
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -73,6 +94,8 @@ extern "C" {
 #define ECODE_EMDRV_DMADRV_IN_USE              (ECODE_EMDRV_DMADRV_BASE | 0x00000005)   ///< DMA is in use.
 #define ECODE_EMDRV_DMADRV_ALREADY_FREED       (ECODE_EMDRV_DMADRV_BASE | 0x00000006)   ///< A DMA channel was free.
 #define ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED    (ECODE_EMDRV_DMADRV_BASE | 0x00000007)   ///< A channel is not reserved.
+#define ECODE_EMDRV_DMADRV_QUEUE_FULL          (ECODE_EMDRV_DMADRV_BASE | 0x00000008)   ///< The transfer queue of a channel is full.
+#define ECODE_EMDRV_DMADRV_RING_OVERRUN        (ECODE_EMDRV_DMADRV_BASE | 0x00000009)   ///< Unread ring buffer data was overwritten.
 
 /** @} (end addtogroup error codes) */
 /***************************************************************************//**
@@ -100,6 +123,51 @@ typedef bool (*DMADRV_Callback_t)(unsigned int channel,
                                   unsigned int sequenceNo,
                                   void *userParam);
 
+#if (EMDRV_DMADRV_RING_MAX_SEGMENTS > 0) || defined(DOXYGEN)
+/// Ring buffer receive notifications.
+SL_ENUM(DMADRV_RingEvent_t) {
+  dmadrvRingEventThreshold = 0, ///< A threshold worth of items was received.
+  dmadrvRingEventIdle      = 1, ///< No item was received since the last idle check.
+  dmadrvRingEventOverrun   = 2  ///< Unread items were overwritten.
+};
+
+/***************************************************************************//**
+ * @brief
+ *  DMADRV ring buffer notification callback function.
+ *
+ * @details
+ *  The callback function is called from the DMA interrupt handler for
+ *  threshold and overrun events, and from @ref DMADRV_RingCheckIdle() for
+ *  idle events.
+ *
+ * @param[in] channel
+ *  The DMA channel number.
+ *
+ * @param[in] event
+ *  The notified event.
+ *
+ * @param[in] available
+ *  The number of items available for reading.
+ *
+ * @param[in] userParam
+ *  Optional user parameter supplied on DMA invocation.
+ ******************************************************************************/
+typedef void (*DMADRV_RingCallback_t)(unsigned int       channel,
+                                      DMADRV_RingEvent_t event,
+                                      int                available,
+                                      void               *userParam);
+#endif
+
+#if (EMDRV_DMADRV_STATS_ENABLE == 1) || defined(DOXYGEN)
+/// DMADRV per-channel interrupt statistics, in CPU cycles.
+typedef struct {
+  uint32_t completions;     ///< Completion interrupts handled for the channel.
+  uint64_t isrCycles;       ///< Cycles spent handling the channel, callbacks included.
+  uint32_t maxIsrCycles;    ///< Longest handling of one completion interrupt.
+  uint64_t callbackCycles;  ///< Cycles spent in the callbacks of the channel.
+} DMADRV_ChannelStats_t;
+#endif
+
 Ecode_t DMADRV_AllocateChannel(unsigned int *channelId,
                                void         *capabilities);
 Ecode_t DMADRV_AllocateChannelById(unsigned int channelId,
@@ -147,6 +215,59 @@ Ecode_t DMADRV_PeripheralMemoryPingPong(unsigned int              channelId,
                                         DMADRV_Callback_t         callback,
                                         void                      *cbUserParam);
 
+#if (EMDRV_DMADRV_QUEUE_DEPTH > 0)
+Ecode_t DMADRV_MemoryPeripheralEnqueue(unsigned int              channelId,
+                                       DMADRV_PeripheralSignal_t peripheralSignal,
+                                       void                      *dst,
+                                       void                      *src,
+                                       bool                      srcInc,
+                                       int                       len,
+                                       DMADRV_DataSize_t         size,
+                                       DMADRV_Callback_t         callback,
+                                       void                      *cbUserParam);
+Ecode_t DMADRV_PeripheralMemoryEnqueue(unsigned int              channelId,
+                                       DMADRV_PeripheralSignal_t peripheralSignal,
+                                       void                      *dst,
+                                       void                      *src,
+                                       bool                      dstInc,
+                                       int                       len,
+                                       DMADRV_DataSize_t         size,
+                                       DMADRV_Callback_t         callback,
+                                       void                      *cbUserParam);
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_DMADRV, SL_CODE_CLASS_TIME_CRITICAL)
+Ecode_t DMADRV_QueuedCount(unsigned int channelId,
+                           int          *count);
+#endif
+
+#if (EMDRV_DMADRV_RING_MAX_SEGMENTS > 0)
+Ecode_t DMADRV_PeripheralMemoryRing(unsigned int              channelId,
+                                    DMADRV_PeripheralSignal_t peripheralSignal,
+                                    void                      *dst,
+                                    void                      *src,
+                                    int                       len,
+                                    DMADRV_DataSize_t         size,
+                                    int                       threshold,
+                                    DMADRV_RingCallback_t     callback,
+                                    void                      *cbUserParam);
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_DMADRV, SL_CODE_CLASS_TIME_CRITICAL)
+Ecode_t DMADRV_RingWriteIndex(unsigned int channelId,
+                              int          *index);
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_DMADRV, SL_CODE_CLASS_TIME_CRITICAL)
+Ecode_t DMADRV_RingAvailable(unsigned int channelId,
+                             int          *readIndex,
+                             int          *available);
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_DMADRV, SL_CODE_CLASS_TIME_CRITICAL)
+Ecode_t DMADRV_RingConsume(unsigned int channelId,
+                           int          count);
+Ecode_t DMADRV_RingCheckIdle(unsigned int channelId);
+#endif
+
+#if (EMDRV_DMADRV_STATS_ENABLE == 1)
+Ecode_t DMADRV_GetChannelStats(unsigned int          channelId,
+                               DMADRV_ChannelStats_t *stats);
+Ecode_t DMADRV_ResetChannelStats(unsigned int channelId);
+#endif
+
 #if defined(EMDRV_DMADRV_LDMA)
 Ecode_t DMADRV_LdmaStartTransfer(int                channelId,
                                  LDMA_TransferCfg_t *transfer,
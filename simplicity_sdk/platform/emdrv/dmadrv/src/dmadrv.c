@@ -53,7 +53,9 @@ typedef enum {
 
 typedef enum {
   dmaModeBasic,
-  dmaModePingPong
+  dmaModePingPong,
+  dmaModeQueue,
+  dmaModeRing
 } DmaMode_t;
 
 typedef struct {
@@ -76,6 +78,24 @@ static ChTable_t chTable[EMDRV_DMADRV_DMA_CH_COUNT];
 static DMA_CB_TypeDef dmaCallBack[EMDRV_DMADRV_DMA_CH_COUNT];
 #endif
 
+#if (EMDRV_DMADRV_DMA_CH_COUNT < 32)
+#define DMADRV_CH_MASK ((1UL << EMDRV_DMADRV_DMA_CH_COUNT) - 1UL)
+#else
+#define DMADRV_CH_MASK 0xFFFFFFFFUL
+#endif
+
+#if (EMDRV_DMADRV_STATS_ENABLE == 1)
+static DMADRV_ChannelStats_t chStats[EMDRV_DMADRV_DMA_CH_COUNT];
+// Cycles spent in callbacks by the channel being handled.
+static uint32_t callbackCycles;
+
+#define STATS_CALLBACK_ENTER() uint32_t callbackStart = DWT->CYCCNT
+#define STATS_CALLBACK_EXIT()  callbackCycles += DWT->CYCCNT - callbackStart
+#else
+#define STATS_CALLBACK_ENTER()
+#define STATS_CALLBACK_EXIT()
+#endif
+
 #if defined(EMDRV_DMADRV_LDMA) || defined(EMDRV_DMADRV_LDMA_S3)
 #if defined(EMDRV_DMADRV_LDMA)
 const LDMA_TransferCfg_t xferCfgPeripheral = LDMA_TRANSFER_CFG_PERIPHERAL(0);
@@ -96,6 +116,53 @@ typedef struct {
 #endif
 
 static DmaXfer_t dmaXfer[EMDRV_DMADRV_DMA_CH_COUNT];
+
+#if (EMDRV_DMADRV_QUEUE_DEPTH > 0)
+// Queued transfers of a channel. The descriptors form a ring, each one
+// pointing to its successor. The link of a descriptor is only enabled once
+// its successor is queued.
+typedef struct {
+#if defined(EMDRV_DMADRV_LDMA)
+  LDMA_Descriptor_t         desc[EMDRV_DMADRV_QUEUE_DEPTH];
+#else
+  sl_hal_ldma_descriptor_t  desc[EMDRV_DMADRV_QUEUE_DEPTH];
+#endif
+  DMADRV_Callback_t         callback[EMDRV_DMADRV_QUEUE_DEPTH];
+  void                      *userParam[EMDRV_DMADRV_QUEUE_DEPTH];
+  DMADRV_PeripheralSignal_t peripheralSignal;
+  unsigned int              head;   // Oldest transfer not retired
+  unsigned int              count;  // Transfers not retired
+} DmaQueue_t;
+
+static DmaQueue_t dmaQueue[EMDRV_DMADRV_DMA_CH_COUNT];
+#endif
+
+#if (EMDRV_DMADRV_RING_MAX_SEGMENTS > 0)
+// Ring buffer receive of a channel. The buffer is split in segments of one
+// descriptor each, the last descriptor linking back to the first one. Write
+// and read positions count items from the start of the transfer and wrap
+// around at 2^32, a multiple of the power of two buffer length.
+typedef struct {
+#if defined(EMDRV_DMADRV_LDMA)
+  LDMA_Descriptor_t         desc[EMDRV_DMADRV_RING_MAX_SEGMENTS];
+#else
+  sl_hal_ldma_descriptor_t  desc[EMDRV_DMADRV_RING_MAX_SEGMENTS];
+#endif
+  DMADRV_RingCallback_t     callback;
+  void                      *userParam;
+  uint32_t                  address;        // Buffer address
+  uint32_t                  sizeShift;      // Log2 of the item size in bytes
+  uint32_t                  length;         // Buffer length in items
+  uint32_t                  segmentLength;  // Items per descriptor
+  uint32_t                  threshold;      // 0 if no threshold events
+  uint32_t                  segmentsDone;   // Completed segments
+  uint32_t                  readPosition;
+  uint32_t                  idlePosition;   // Write position at last idle check
+  bool                      overrun;
+} DmaRing_t;
+
+static DmaRing_t dmaRing[EMDRV_DMADRV_DMA_CH_COUNT];
+#endif
 #endif
 
 static Ecode_t StartTransfer(DmaMode_t                 mode,
@@ -111,6 +178,31 @@ static Ecode_t StartTransfer(DmaMode_t                 mode,
                              DMADRV_Callback_t         callback,
                              void                      *cbUserParam);
 
+#if (EMDRV_DMADRV_QUEUE_DEPTH > 0)
+static Ecode_t EnqueueTransfer(DmaDirection_t            direction,
+                               unsigned int              channelId,
+                               DMADRV_PeripheralSignal_t peripheralSignal,
+                               void                      *dst,
+                               void                      *src,
+                               bool                      bufInc,
+                               int                       len,
+                               DMADRV_DataSize_t         size,
+                               DMADRV_Callback_t         callback,
+                               void                      *cbUserParam);
+static void QueueIrqHandler(unsigned int channelId);
+#endif
+
+#if (EMDRV_DMADRV_RING_MAX_SEGMENTS > 0)
+static Ecode_t RingCheckChannel(unsigned int channelId);
+static uint32_t RingWritePosition(unsigned int channelId);
+static void RingIrqHandler(unsigned int channelId);
+#endif
+
+#if defined(EMDRV_DMADRV_LDMA) || defined(EMDRV_DMADRV_LDMA_S3)
+static void ChannelIrqHandler(unsigned int chnum);
+static void ResetChannelMode(unsigned int channelId);
+#endif
+
 #if defined(EMDRV_DMADRV_LDMA_S3)
 static void LDMA_IRQHandlerDefault(uint8_t chnum);
 #endif
@@ -272,6 +364,9 @@ Ecode_t DMADRV_FreeChannel(unsigned int channelId)
   CORE_ENTER_ATOMIC();
   if ( chTable[channelId].allocated ) {
     chTable[channelId].allocated = false;
+#if defined(EMDRV_DMADRV_LDMA) || defined(EMDRV_DMADRV_LDMA_S3)
+    ResetChannelMode(channelId);
+#endif
     CORE_EXIT_ATOMIC();
     return ECODE_EMDRV_DMADRV_OK;
   }
@@ -320,6 +415,15 @@ Ecode_t DMADRV_Init(void)
     chTable[i].allocated = false;
   }
 
+#if (EMDRV_DMADRV_STATS_ENABLE == 1)
+  for (int i = 0; i < EMDRV_DMADRV_DMA_CH_COUNT; i++ ) {
+    chStats[i] = (DMADRV_ChannelStats_t){ 0 };
+  }
+  /* Start the cycle counter. */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
 #if defined(EMDRV_DMADRV_UDMA)
   NVIC_SetPriority(DMA_IRQn, EMDRV_DMADRV_DMA_IRQ_PRIORITY);
   dmaInit.hprot        = 0;
@@ -395,6 +499,9 @@ Ecode_t DMADRV_LdmaStartTransfer(int                channelId,
     return ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED;
   }
 
+  CORE_ATOMIC_SECTION(
+    ResetChannelMode(channelId);
+    )
   ch->callback      = callback;
   ch->userParam     = cbUserParam;
   ch->callbackCount = 0;
@@ -424,6 +531,9 @@ Ecode_t DMADRV_LdmaStartTransfer(int                            channelId,
     return ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED;
   }
 
+  CORE_ATOMIC_SECTION(
+    ResetChannelMode(channelId);
+    )
   ch->callback      = callback;
   ch->userParam     = cbUserParam;
   ch->callbackCount = 0;
@@ -701,6 +811,553 @@ Ecode_t DMADRV_PeripheralMemoryPingPong(
                        cbUserParam);
 }
 
+#if (EMDRV_DMADRV_QUEUE_DEPTH > 0) || defined(DOXYGEN)
+/***************************************************************************//**
+ * @brief
+ *  Queue a memory to a peripheral DMA transfer.
+ *
+ * @details
+ *  The transfer starts right away if the channel is idle. Otherwise, its
+ *  descriptor is linked to the last queued transfer so that the LDMA moves
+ *  on to it without waiting for software. Each transfer has its own
+ *  completion callback, called in queue order.
+ *
+ * @note
+ *  All the transfers queued on a channel must use the same
+ *  @a peripheralSignal. A transfer started with any other DMADRV function
+ *  drops the queue of the channel.
+ *
+ * @param[in] channelId
+ *  The channel ID to use for the transfer.
+ *
+ * @param[in] peripheralSignal
+ *  Selects which peripheral/peripheralsignal to use.
+ *
+ * @param[in] dst
+ *  A destination (peripheral register) memory address.
+ *
+ * @param[in] src
+ *  A source memory address.
+ *
+ * @param[in] srcInc
+ *  Set to true to enable source address increment (increments according to
+ *  @a size parameter).
+ *
+ * @param[in] len
+ *  A number of items (of @a size size) to transfer.
+ *
+ * @param[in] size
+ *  An item size, byte, halfword or word.
+ *
+ * @param[in] callback
+ *  A function to call on completion of this transfer, use NULL if not needed.
+ *  Its return value is ignored.
+ *
+ * @param[in] cbUserParam
+ *  An optional user parameter to feed to the callback function. Use NULL if
+ *  not needed.
+ *
+ * @return
+ *   @ref ECODE_EMDRV_DMADRV_OK on success,
+ *   @ref ECODE_EMDRV_DMADRV_QUEUE_FULL if @ref EMDRV_DMADRV_QUEUE_DEPTH
+ *   transfers are already queued. On other failures, an appropriate
+ *   DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_MemoryPeripheralEnqueue(unsigned int              channelId,
+                                       DMADRV_PeripheralSignal_t peripheralSignal,
+                                       void                      *dst,
+                                       void                      *src,
+                                       bool                      srcInc,
+                                       int                       len,
+                                       DMADRV_DataSize_t         size,
+                                       DMADRV_Callback_t         callback,
+                                       void                      *cbUserParam)
+{
+  return EnqueueTransfer(dmaDirectionMemToPeripheral,
+                         channelId,
+                         peripheralSignal,
+                         dst,
+                         src,
+                         srcInc,
+                         len,
+                         size,
+                         callback,
+                         cbUserParam);
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Queue a peripheral to memory DMA transfer.
+ *
+ * @details
+ *  See @ref DMADRV_MemoryPeripheralEnqueue().
+ *
+ * @param[in] channelId
+ *  The channel ID to use for the transfer.
+ *
+ * @param[in] peripheralSignal
+ *  Selects which peripheral/peripheralsignal to use.
+ *
+ * @param[in] dst
+ *  A destination memory address.
+ *
+ * @param[in] src
+ *  A source memory (peripheral register) address.
+ *
+ * @param[in] dstInc
+ *  Set to true to enable destination address increment (increments according
+ *  to @a size parameter).
+ *
+ * @param[in] len
+ *  A number of items (of @a size size) to transfer.
+ *
+ * @param[in] size
+ *  An item size, byte, halfword or word.
+ *
+ * @param[in] callback
+ *  A function to call on completion of this transfer, use NULL if not needed.
+ *  Its return value is ignored.
+ *
+ * @param[in] cbUserParam
+ *  An optional user parameter to feed to the callback function. Use NULL if
+ *  not needed.
+ *
+ * @return
+ *   @ref ECODE_EMDRV_DMADRV_OK on success,
+ *   @ref ECODE_EMDRV_DMADRV_QUEUE_FULL if @ref EMDRV_DMADRV_QUEUE_DEPTH
+ *   transfers are already queued. On other failures, an appropriate
+ *   DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_PeripheralMemoryEnqueue(unsigned int              channelId,
+                                       DMADRV_PeripheralSignal_t peripheralSignal,
+                                       void                      *dst,
+                                       void                      *src,
+                                       bool                      dstInc,
+                                       int                       len,
+                                       DMADRV_DataSize_t         size,
+                                       DMADRV_Callback_t         callback,
+                                       void                      *cbUserParam)
+{
+  return EnqueueTransfer(dmaDirectionPeripheralToMem,
+                         channelId,
+                         peripheralSignal,
+                         dst,
+                         src,
+                         dstInc,
+                         len,
+                         size,
+                         callback,
+                         cbUserParam);
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Get the number of queued transfers not completed yet.
+ *
+ * @param[in] channelId
+ *  The channel ID of the queue to check.
+ *
+ * @param[out] count
+ *  A number of transfers queued, including the one in progress.
+ *
+ * @return
+ *  @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *  DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_QueuedCount(unsigned int channelId, int *count)
+{
+  if ( !initialized ) {
+    return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+  }
+
+  if ( (channelId >= EMDRV_DMADRV_DMA_CH_COUNT)
+       || (count == NULL) ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  if ( chTable[channelId].allocated == false ) {
+    return ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED;
+  }
+
+  if ( chTable[channelId].mode == dmaModeQueue ) {
+    *count = (int)dmaQueue[channelId].count;
+  } else {
+    *count = 0;
+  }
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+#endif
+
+#if (EMDRV_DMADRV_RING_MAX_SEGMENTS > 0) || defined(DOXYGEN)
+/***************************************************************************//**
+ * @brief
+ *  Start a continuous peripheral to memory DMA transfer into a ring buffer.
+ *
+ * @details
+ *  The LDMA writes into the buffer endlessly, wrapping around at its end,
+ *  without any software intervention. The consumer gets the received items
+ *  at its own pace with @ref DMADRV_RingAvailable() and
+ *  @ref DMADRV_RingConsume(). If the consumer falls more than one buffer
+ *  length behind, the overwritten items are reported as an overrun.
+ *
+ *  The buffer is split in segments of @a threshold items, one LDMA descriptor
+ *  each, and the DMA interrupt only fires at the end of a segment. Without a
+ *  threshold, segments are half the buffer, or shorter if the transfer size
+ *  limit requires it. The write position stays exact as long as the DMA
+ *  interrupt is handled less than one buffer length late.
+ *
+ * @note
+ *  The transfer runs until @ref DMADRV_StopTransfer() is called. The ring
+ *  buffer functions then fail with @ref ECODE_EMDRV_DMADRV_PARAM_ERROR, or
+ *  with @ref ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED once the channel is freed.
+ *
+ * @param[in] channelId
+ *  The channel ID to use for the transfer.
+ *
+ * @param[in] peripheralSignal
+ *  Selects which peripheral/peripheralsignal to use.
+ *
+ * @param[in] dst
+ *  The ring buffer memory address.
+ *
+ * @param[in] src
+ *  A source memory (peripheral register) address.
+ *
+ * @param[in] len
+ *  The ring buffer length in items (of @a size size). Must be a power of 2.
+ *
+ * @param[in] size
+ *  An item size, byte, halfword or word.
+ *
+ * @param[in] threshold
+ *  A number of items after which a @ref dmadrvRingEventThreshold
+ *  notification is sent. Must be a power of 2 no larger than half of
+ *  @a len, or 0 for no threshold notifications. The buffer must not be split in more than
+ *  EMDRV_DMADRV_RING_MAX_SEGMENTS segments.
+ *
+ * @param[in] callback
+ *  A function to call on ring buffer events, use NULL if not needed.
+ *
+ * @param[in] cbUserParam
+ *  An optional user parameter to feed to the callback function. Use NULL if
+ *  not needed.
+ *
+ * @return
+ *   @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *   DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_PeripheralMemoryRing(unsigned int              channelId,
+                                    DMADRV_PeripheralSignal_t peripheralSignal,
+                                    void                      *dst,
+                                    void                      *src,
+                                    int                       len,
+                                    DMADRV_DataSize_t         size,
+                                    int                       threshold,
+                                    DMADRV_RingCallback_t     callback,
+                                    void                      *cbUserParam)
+{
+  ChTable_t *ch;
+  DmaRing_t *ring;
+  uint32_t segmentLength;
+  uint32_t segments;
+  uint32_t segmentBytes;
+  CORE_DECLARE_IRQ_STATE;
+
+  if ( !initialized ) {
+    return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+  }
+
+  if ( (channelId >= EMDRV_DMADRV_DMA_CH_COUNT)
+       || (dst == NULL)
+       || (src == NULL)
+       || (len < 2)
+       || ((len & (len - 1)) != 0)
+       || (threshold < 0)
+       || (threshold == 1)
+       || (threshold > (len / 2))
+       || ((threshold & (threshold - 1)) != 0) ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  segmentLength = (threshold > 0) ? (uint32_t)threshold : ((uint32_t)len / 2U);
+  while ( segmentLength > (uint32_t)DMADRV_MAX_XFER_COUNT ) {
+    segmentLength /= 2U;
+  }
+  segments = (uint32_t)len / segmentLength;
+  if ( segments > EMDRV_DMADRV_RING_MAX_SEGMENTS ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  ch = &chTable[channelId];
+  if ( ch->allocated == false ) {
+    return ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED;
+  }
+
+  ring = &dmaRing[channelId];
+  segmentBytes = segmentLength << (uint32_t)size;
+
+  for (uint32_t i = 0U; i < segments; i++) {
+#if defined(EMDRV_DMADRV_LDMA)
+    ring->desc[i] = p2m;
+    ring->desc[i].xfer.xferCnt  = segmentLength - 1U;
+    ring->desc[i].xfer.dstAddr  = (uint32_t)(uint8_t *)dst + (i * segmentBytes);
+    ring->desc[i].xfer.srcAddr  = (uint32_t)(uint8_t *)src;
+    ring->desc[i].xfer.size     = size;
+    ring->desc[i].xfer.linkMode = ldmaLinkModeRel;
+    ring->desc[i].xfer.link     = 1;
+    ring->desc[i].xfer.linkAddr = 4;    /* Refer to the next descriptor. */
+#else
+    ring->desc[i] = p2m;
+    ring->desc[i].xfer.xfer_count = segmentLength - 1U;
+    ring->desc[i].xfer.dst_addr   = (uint32_t)(uint8_t *)dst + (i * segmentBytes);
+    ring->desc[i].xfer.src_addr   = (uint32_t)(uint8_t *)src;
+    ring->desc[i].xfer.size       = size;
+    ring->desc[i].xfer.link_mode  = SL_HAL_LDMA_LINK_MODE_REL;
+    ring->desc[i].xfer.link       = 1;
+    ring->desc[i].xfer.link_addr  = 4;  /* Refer to the next descriptor. */
+#endif
+  }
+  /* The last descriptor refers to the first one. */
+#if defined(EMDRV_DMADRV_LDMA)
+  ring->desc[segments - 1U].xfer.linkAddr = -4 * (int32_t)(segments - 1U);
+#else
+  ring->desc[segments - 1U].xfer.link_addr = -4 * (int32_t)(segments - 1U);
+#endif
+
+  CORE_ENTER_ATOMIC();
+  ring->callback      = callback;
+  ring->userParam     = cbUserParam;
+  ring->address       = (uint32_t)(uint8_t *)dst;
+  ring->sizeShift     = (uint32_t)size;
+  ring->length        = (uint32_t)len;
+  ring->segmentLength = segmentLength;
+  ring->threshold     = (uint32_t)threshold;
+  ring->segmentsDone  = 0U;
+  ring->readPosition  = 0U;
+  ring->idlePosition  = 0U;
+  ring->overrun       = false;
+  ch->callback        = NULL;
+  ch->callbackCount   = 0;
+  ch->mode            = dmaModeRing;
+  CORE_EXIT_ATOMIC();
+
+#if defined(EMDRV_DMADRV_LDMA)
+  LDMA_TransferCfg_t xfer = xferCfgPeripheral;
+
+  xfer.ldmaReqSel = peripheralSignal;
+  LDMA_StartTransfer(channelId, &xfer, &ring->desc[0]);
+#else
+  sl_hal_ldma_transfer_config_t xfer = xferCfgPeripheral;
+
+  xfer.request_sel = peripheralSignal;
+  sl_hal_ldma_init_transfer(LDMA0, channelId, &xfer, &ring->desc[0]);
+  sl_hal_ldma_start_transfer(LDMA0, channelId);
+  if (channelId < 16) {
+    sl_hal_ldma_enable_interrupts(LDMA0, (0x1UL << channelId));
+  }
+#if defined(_LDMA_IFH_MASK)
+  else {
+    sl_hal_ldma_enable_high_interrupts(LDMA0, (0x1UL << (channelId - 16)));
+  }
+#endif
+#endif
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Get the index in the ring buffer of the next item the LDMA will write.
+ *
+ * @note
+ *  Must not be called from an interrupt with a higher priority than the DMA
+ *  interrupt.
+ *
+ * @param[in] channelId
+ *  The channel ID of the ring buffer transfer.
+ *
+ * @param[out] index
+ *  The write index, in items from the start of the buffer.
+ *
+ * @return
+ *  @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *  DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_RingWriteIndex(unsigned int channelId, int *index)
+{
+  Ecode_t status;
+
+  if ( index == NULL ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  status = RingCheckChannel(channelId);
+  if ( status != ECODE_EMDRV_DMADRV_OK ) {
+    return status;
+  }
+
+  *index = (int)(RingWritePosition(channelId)
+                 & (dmaRing[channelId].length - 1U));
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Get the received items not read yet from a ring buffer.
+ *
+ * @details
+ *  The available items start at @a readIndex and may wrap around the end of
+ *  the buffer. On overrun, all the items received so far are dropped and the
+ *  consumer resumes with the next received item.
+ *
+ * @note
+ *  Must not be called from an interrupt with a higher priority than the DMA
+ *  interrupt.
+ *
+ * @param[in] channelId
+ *  The channel ID of the ring buffer transfer.
+ *
+ * @param[out] readIndex
+ *  The index of the first available item, may be NULL.
+ *
+ * @param[out] available
+ *  The number of available items.
+ *
+ * @return
+ *  @ref ECODE_EMDRV_DMADRV_OK on success,
+ *  @ref ECODE_EMDRV_DMADRV_RING_OVERRUN if unread items were overwritten.
+ *  On other failures, an appropriate DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_RingAvailable(unsigned int channelId,
+                             int *readIndex,
+                             int *available)
+{
+  DmaRing_t *ring;
+  uint32_t writePosition;
+  Ecode_t status;
+  CORE_DECLARE_IRQ_STATE;
+
+  if ( available == NULL ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  status = RingCheckChannel(channelId);
+  if ( status != ECODE_EMDRV_DMADRV_OK ) {
+    return status;
+  }
+
+  ring = &dmaRing[channelId];
+
+  CORE_ENTER_ATOMIC();
+  writePosition = RingWritePosition(channelId);
+  if ( ring->overrun
+       || ((writePosition - ring->readPosition) > ring->length) ) {
+    ring->overrun      = false;
+    ring->readPosition = writePosition;
+    status             = ECODE_EMDRV_DMADRV_RING_OVERRUN;
+  }
+  *available = (int)(writePosition - ring->readPosition);
+  if ( readIndex != NULL ) {
+    *readIndex = (int)(ring->readPosition & (ring->length - 1U));
+  }
+  CORE_EXIT_ATOMIC();
+
+  return status;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Release items read from a ring buffer.
+ *
+ * @param[in] channelId
+ *  The channel ID of the ring buffer transfer.
+ *
+ * @param[in] count
+ *  The number of items read, at most the number of available items.
+ *
+ * @return
+ *  @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *  DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_RingConsume(unsigned int channelId, int count)
+{
+  DmaRing_t *ring;
+  Ecode_t status;
+  CORE_DECLARE_IRQ_STATE;
+
+  status = RingCheckChannel(channelId);
+  if ( status != ECODE_EMDRV_DMADRV_OK ) {
+    return status;
+  }
+
+  ring = &dmaRing[channelId];
+
+  CORE_ENTER_ATOMIC();
+  if ( (count < 0)
+       || ((uint32_t)count
+           > (RingWritePosition(channelId) - ring->readPosition)) ) {
+    status = ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  } else {
+    ring->readPosition += (uint32_t)count;
+  }
+  CORE_EXIT_ATOMIC();
+
+  return status;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Check whether a ring buffer receive went idle.
+ *
+ * @details
+ *  Sends a @ref dmadrvRingEventIdle notification if items are available and
+ *  no item was received since the previous call. Call it periodically, for
+ *  instance from a timer set to a few character times, or from the receive
+ *  timeout interrupt of the peripheral, to flush the items below the
+ *  threshold at the end of a burst.
+ *
+ * @param[in] channelId
+ *  The channel ID of the ring buffer transfer.
+ *
+ * @return
+ *  @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *  DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_RingCheckIdle(unsigned int channelId)
+{
+  DmaRing_t *ring;
+  uint32_t writePosition;
+  bool idle;
+  Ecode_t status;
+  CORE_DECLARE_IRQ_STATE;
+
+  status = RingCheckChannel(channelId);
+  if ( status != ECODE_EMDRV_DMADRV_OK ) {
+    return status;
+  }
+
+  ring = &dmaRing[channelId];
+
+  CORE_ENTER_ATOMIC();
+  writePosition = RingWritePosition(channelId);
+  idle = (writePosition == ring->idlePosition)
+         && (writePosition != ring->readPosition);
+  ring->idlePosition = writePosition;
+  CORE_EXIT_ATOMIC();
+
+  if ( idle && (ring->callback != NULL) ) {
+    ring->callback(channelId,
+                   dmadrvRingEventIdle,
+                   (int)(writePosition - ring->readPosition),
+                   ring->userParam);
+  }
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+#endif
+
 /***************************************************************************//**
  * @brief
  *  Pause an ongoing DMA transfer.
@@ -806,6 +1463,14 @@ Ecode_t DMADRV_StopTransfer(unsigned int channelId)
   sl_hal_ldma_stop_transfer(LDMA0, channelId);
 #endif
 
+#if defined(EMDRV_DMADRV_LDMA) || defined(EMDRV_DMADRV_LDMA_S3)
+  /* Drop the queued transfers or the ring buffer, their callbacks are not
+     called. */
+  CORE_ATOMIC_SECTION(
+    ResetChannelMode(channelId);
+    )
+#endif
+
   return ECODE_EMDRV_DMADRV_OK;
 }
 
@@ -1029,6 +1694,74 @@ Ecode_t DMADRV_TransferRemainingCount(unsigned int channelId,
   return ECODE_EMDRV_DMADRV_OK;
 }
 
+#if (EMDRV_DMADRV_STATS_ENABLE == 1) || defined(DOXYGEN)
+/***************************************************************************//**
+ * @brief
+ *  Get the interrupt statistics of a channel.
+ *
+ * @details
+ *  The statistics are accumulated since @ref DMADRV_Init() or the last call
+ *  to @ref DMADRV_ResetChannelStats(), across transfers and channel
+ *  allocations.
+ *
+ * @param[in] channelId
+ *  The channel ID to get the statistics of.
+ *
+ * @param[out] stats
+ *  The channel statistics.
+ *
+ * @return
+ *  @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *  DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_GetChannelStats(unsigned int channelId,
+                               DMADRV_ChannelStats_t *stats)
+{
+  if ( !initialized ) {
+    return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+  }
+
+  if ( (channelId >= EMDRV_DMADRV_DMA_CH_COUNT)
+       || (stats == NULL) ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  CORE_ATOMIC_SECTION(
+    *stats = chStats[channelId];
+    )
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Reset the interrupt statistics of a channel.
+ *
+ * @param[in] channelId
+ *  The channel ID to reset the statistics of.
+ *
+ * @return
+ *  @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *  DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_ResetChannelStats(unsigned int channelId)
+{
+  if ( !initialized ) {
+    return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+  }
+
+  if ( channelId >= EMDRV_DMADRV_DMA_CH_COUNT ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  CORE_ATOMIC_SECTION(
+    chStats[channelId] = (DMADRV_ChannelStats_t){ 0 };
+    )
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+#endif
+
 /// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
 
 #if defined(EMDRV_DMADRV_LDMA)
@@ -1038,8 +1771,6 @@ Ecode_t DMADRV_TransferRemainingCount(unsigned int channelId,
  ******************************************************************************/
 void LDMA_IRQHandler(void)
 {
-  bool stop;
-  ChTable_t *ch;
   uint32_t pending;
   uint32_t chnum;
   uint32_t chmask;
@@ -1056,32 +1787,80 @@ void LDMA_IRQHandler(void)
     }
   }
 
-  /* Iterate over all LDMA channels. */
-  for ( chnum = 0, chmask = 1;
-        chnum < EMDRV_DMADRV_DMA_CH_COUNT;
-        chnum++, chmask <<= 1 ) {
-    if ( pending & chmask ) {
-      /* Clear the interrupt flag. */
+  /* Iterate over the pending channels only, lowest channel first. */
+  pending &= DMADRV_CH_MASK;
+  while ( pending != 0U ) {
+    chnum    = __CLZ(__RBIT(pending));
+    chmask   = 1UL << chnum;
+    pending &= ~chmask;
+
+    /* Clear the interrupt flag. */
 #if defined (LDMA_HAS_SET_CLEAR)
-      LDMA->IF_CLR = chmask;
+    LDMA->IF_CLR = chmask;
 #else
-      LDMA->IFC = chmask;
+    LDMA->IFC = chmask;
 #endif
 
-      ch = &chTable[chnum];
-      if ( ch->callback != NULL ) {
-        ch->callbackCount++;
-        stop = !ch->callback(chnum, ch->callbackCount, ch->userParam);
+    ChannelIrqHandler(chnum);
+  }
+}
+#endif /* defined( EMDRV_DMADRV_LDMA ) */
 
-        if ( (ch->mode == dmaModePingPong) && stop ) {
-          dmaXfer[chnum].desc[0].xfer.link = 0;
-          dmaXfer[chnum].desc[1].xfer.link = 0;
-        }
-      }
+#if defined(EMDRV_DMADRV_LDMA) || defined(EMDRV_DMADRV_LDMA_S3)
+/***************************************************************************//**
+ * @brief
+ *  Handle the completion interrupt of a channel, its flag already cleared.
+ *
+ * @param[in] chnum
+ *  The channel ID responsible for the interrupt.
+ ******************************************************************************/
+static void ChannelIrqHandler(unsigned int chnum)
+{
+  bool stop;
+  ChTable_t *ch = &chTable[chnum];
+#if (EMDRV_DMADRV_STATS_ENABLE == 1)
+  uint32_t start = DWT->CYCCNT;
+  uint32_t cycles;
+
+  callbackCycles = 0U;
+#endif
+
+#if (EMDRV_DMADRV_QUEUE_DEPTH > 0)
+  if ( ch->mode == dmaModeQueue ) {
+    QueueIrqHandler(chnum);
+  } else
+#endif
+#if (EMDRV_DMADRV_RING_MAX_SEGMENTS > 0)
+  if ( ch->mode == dmaModeRing ) {
+    RingIrqHandler(chnum);
+  } else
+#endif
+  if ( ch->callback != NULL ) {
+    ch->callbackCount++;
+    {
+      STATS_CALLBACK_ENTER();
+      stop = !ch->callback(chnum, ch->callbackCount, ch->userParam);
+      STATS_CALLBACK_EXIT();
+    }
+
+    /* Continue or not a ping-pong transfer. */
+    if ( (ch->mode == dmaModePingPong) && stop ) {
+      dmaXfer[chnum].desc[0].xfer.link = 0;
+      dmaXfer[chnum].desc[1].xfer.link = 0;
     }
   }
+
+#if (EMDRV_DMADRV_STATS_ENABLE == 1)
+  cycles = DWT->CYCCNT - start;
+  chStats[chnum].completions++;
+  chStats[chnum].isrCycles      += cycles;
+  chStats[chnum].callbackCycles += callbackCycles;
+  if ( cycles > chStats[chnum].maxIsrCycles ) {
+    chStats[chnum].maxIsrCycles = cycles;
+  }
+#endif
 }
-#endif /* defined( EMDRV_DMADRV_LDMA ) */
+#endif
 
 #if defined(EMDRV_DMADRV_LDMA_S3)
 /***************************************************************************//**
@@ -1093,8 +1872,6 @@ void LDMA_IRQHandler(void)
  ******************************************************************************/
 static void LDMA_IRQHandlerDefault(uint8_t chnum)
 {
-  bool stop;
-  ChTable_t *ch;
   uint32_t pending;
   uint32_t pending_done;
   uint32_t pending_error;
@@ -1130,17 +1907,7 @@ static void LDMA_IRQHandlerDefault(uint8_t chnum)
 #endif
 
     /* Callback called if it was provided for the given channel. */
-    ch = &chTable[chnum];
-    if ( ch->callback != NULL ) {
-      ch->callbackCount++;
-      stop = !ch->callback(chnum, ch->callbackCount, ch->userParam);
-
-      /* Continue or not a ping-pong transfer. */
-      if ( (ch->mode == dmaModePingPong) && stop ) {
-        dmaXfer[chnum].desc[0].xfer.link = 0;
-        dmaXfer[chnum].desc[1].xfer.link = 0;
-      }
-    }
+    ChannelIrqHandler(chnum);
   }
 }
 
@@ -1702,6 +2469,337 @@ static Ecode_t StartTransfer(DmaMode_t             mode,
 }
 #endif /* defined( EMDRV_DMADRV_LDMA_S3 ) */
 
+#if defined(EMDRV_DMADRV_LDMA) || defined(EMDRV_DMADRV_LDMA_S3)
+/***************************************************************************//**
+ * @brief
+ *  Return a channel to basic mode. Its queued transfers are dropped and its
+ *  ring buffer ended, so the interrupt handler no longer routes completions
+ *  to the queue or ring handlers. Must be called inside an atomic section.
+ ******************************************************************************/
+static void ResetChannelMode(unsigned int channelId)
+{
+  chTable[channelId].mode = dmaModeBasic;
+#if (EMDRV_DMADRV_QUEUE_DEPTH > 0)
+  dmaQueue[channelId].count = 0;
+#endif
+}
+#endif
+
+#if (EMDRV_DMADRV_QUEUE_DEPTH > 0)
+/***************************************************************************//**
+ * @brief
+ *  Start the LDMA on a queued transfer.
+ ******************************************************************************/
+static void QueueStart(unsigned int channelId, unsigned int slot)
+{
+  DmaQueue_t *queue = &dmaQueue[channelId];
+
+#if defined(EMDRV_DMADRV_LDMA)
+  LDMA_TransferCfg_t xfer = xferCfgPeripheral;
+
+  xfer.ldmaReqSel = queue->peripheralSignal;
+  LDMA_StartTransfer(channelId, &xfer, &queue->desc[slot]);
+#else
+  sl_hal_ldma_transfer_config_t xfer = xferCfgPeripheral;
+
+  xfer.request_sel = queue->peripheralSignal;
+  sl_hal_ldma_init_transfer(LDMA0, channelId, &xfer, &queue->desc[slot]);
+  sl_hal_ldma_start_transfer(LDMA0, channelId);
+  if (channelId < 16) {
+    sl_hal_ldma_enable_interrupts(LDMA0, (0x1UL << channelId));
+  }
+#if defined(_LDMA_IFH_MASK)
+  else {
+    sl_hal_ldma_enable_high_interrupts(LDMA0, (0x1UL << (channelId - 16)));
+  }
+#endif
+#endif
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Queue an LDMA transfer.
+ ******************************************************************************/
+static Ecode_t EnqueueTransfer(DmaDirection_t            direction,
+                               unsigned int              channelId,
+                               DMADRV_PeripheralSignal_t peripheralSignal,
+                               void                      *dst,
+                               void                      *src,
+                               bool                      bufInc,
+                               int                       len,
+                               DMADRV_DataSize_t         size,
+                               DMADRV_Callback_t         callback,
+                               void                      *cbUserParam)
+{
+  ChTable_t *ch;
+  DmaQueue_t *queue;
+  unsigned int slot;
+  unsigned int next;
+  CORE_DECLARE_IRQ_STATE;
+
+  if ( !initialized ) {
+    return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+  }
+
+  if ( (channelId >= EMDRV_DMADRV_DMA_CH_COUNT)
+       || (dst == NULL)
+       || (src == NULL)
+       || (len < 1)
+       || (len > DMADRV_MAX_XFER_COUNT) ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  ch = &chTable[channelId];
+  if ( ch->allocated == false ) {
+    return ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED;
+  }
+
+  queue = &dmaQueue[channelId];
+
+  CORE_ENTER_ATOMIC();
+  if ( ch->mode != dmaModeQueue ) {
+    /* The channel was last used for another kind of transfer. */
+    ch->mode          = dmaModeQueue;
+    ch->callback      = NULL;
+    ch->callbackCount = 0;
+    queue->count      = 0;
+  }
+
+  if ( (queue->count > 0)
+       && (queue->peripheralSignal != peripheralSignal) ) {
+    CORE_EXIT_ATOMIC();
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  if ( queue->count == EMDRV_DMADRV_QUEUE_DEPTH ) {
+    CORE_EXIT_ATOMIC();
+    return ECODE_EMDRV_DMADRV_QUEUE_FULL;
+  }
+
+  slot = (queue->head + queue->count) % EMDRV_DMADRV_QUEUE_DEPTH;
+  next = (slot + 1) % EMDRV_DMADRV_QUEUE_DEPTH;
+
+#if defined(EMDRV_DMADRV_LDMA)
+  if ( direction == dmaDirectionMemToPeripheral ) {
+    queue->desc[slot] = m2p;
+    if ( !bufInc ) {
+      queue->desc[slot].xfer.srcInc = ldmaCtrlSrcIncNone;
+    }
+  } else {
+    queue->desc[slot] = p2m;
+    if ( !bufInc ) {
+      queue->desc[slot].xfer.dstInc = ldmaCtrlDstIncNone;
+    }
+  }
+  queue->desc[slot].xfer.xferCnt  = len - 1;
+  queue->desc[slot].xfer.dstAddr  = (uint32_t)(uint8_t *)dst;
+  queue->desc[slot].xfer.srcAddr  = (uint32_t)(uint8_t *)src;
+  queue->desc[slot].xfer.size     = size;
+  queue->desc[slot].xfer.linkMode = ldmaLinkModeAbs;
+  queue->desc[slot].xfer.linkAddr = (int32_t)((uint32_t)&queue->desc[next] >> 2);
+#else
+  if ( direction == dmaDirectionMemToPeripheral ) {
+    queue->desc[slot] = m2p;
+    if ( !bufInc ) {
+      queue->desc[slot].xfer.src_inc = SL_HAL_LDMA_CTRL_SRC_INC_NONE;
+    }
+  } else {
+    queue->desc[slot] = p2m;
+    if ( !bufInc ) {
+      queue->desc[slot].xfer.dst_inc = SL_HAL_LDMA_CTRL_DST_INC_NONE;
+    }
+  }
+  queue->desc[slot].xfer.xfer_count = len - 1;
+  queue->desc[slot].xfer.dst_addr   = (uint32_t)(uint8_t *)dst;
+  queue->desc[slot].xfer.src_addr   = (uint32_t)(uint8_t *)src;
+  queue->desc[slot].xfer.size       = size;
+  queue->desc[slot].xfer.link_mode  = SL_HAL_LDMA_LINK_MODE_ABS;
+  queue->desc[slot].xfer.link_addr  = (int32_t)((uint32_t)&queue->desc[next] >> 2);
+#endif
+  queue->callback[slot]  = callback;
+  queue->userParam[slot] = cbUserParam;
+
+  if ( queue->count == 0 ) {
+    queue->head             = slot;
+    queue->count            = 1;
+    queue->peripheralSignal = peripheralSignal;
+    QueueStart(channelId, slot);
+  } else {
+    /* The descriptor must be complete before the LDMA can follow the link.
+       If the LDMA already loaded the previous descriptor, the link is
+       missed and the interrupt handler restarts the channel. */
+    __DMB();
+    queue->desc[(slot + EMDRV_DMADRV_QUEUE_DEPTH - 1)
+                % EMDRV_DMADRV_QUEUE_DEPTH].xfer.link = 1;
+    queue->count++;
+  }
+  CORE_EXIT_ATOMIC();
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Retire the completed queued transfers of a channel.
+ ******************************************************************************/
+static void QueueIrqHandler(unsigned int channelId)
+{
+  ChTable_t *ch = &chTable[channelId];
+  DmaQueue_t *queue = &dmaQueue[channelId];
+  DMADRV_Callback_t callback[EMDRV_DMADRV_QUEUE_DEPTH];
+  void *userParam[EMDRV_DMADRV_QUEUE_DEPTH];
+  unsigned int done;
+  unsigned int loaded;
+  uint32_t link;
+  bool active;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  if ( queue->count == 0 ) {
+    CORE_EXIT_ATOMIC();
+    return;
+  }
+
+  /* Read the channel state before its link, the link no longer changes once
+     the channel stopped. */
+#if defined(EMDRV_DMADRV_LDMA)
+  active = LDMA_ChannelEnabled(channelId);
+  link   = LDMA->CH[channelId].LINK & _LDMA_CH_LINK_LINKADDR_MASK;
+#else
+  active = sl_hal_ldma_channel_is_enabled(LDMA0, channelId);
+  link   = LDMA0->CH[channelId].LINK & _LDMA_CH_LINK_LINKADDR_MASK;
+#endif
+
+  /* Every queued descriptor points to its successor in the ring, so the link
+     loaded in the channel tells which descriptor the LDMA reached. */
+  loaded = (link - (uint32_t)&queue->desc[0]) / sizeof(queue->desc[0]);
+  loaded = (loaded + EMDRV_DMADRV_QUEUE_DEPTH - 1) % EMDRV_DMADRV_QUEUE_DEPTH;
+  done   = (loaded + EMDRV_DMADRV_QUEUE_DEPTH - queue->head)
+           % EMDRV_DMADRV_QUEUE_DEPTH;
+  if ( done >= queue->count ) {
+    /* The descriptor is not loaded yet. */
+    done = 0;
+  } else if ( !active ) {
+    done++;
+  }
+
+  /* The LDMA missed a link enabled after it loaded the last descriptor,
+     start the remaining transfers right away. */
+  if ( !active && (done < queue->count) ) {
+    QueueStart(channelId,
+               (queue->head + done) % EMDRV_DMADRV_QUEUE_DEPTH);
+  }
+
+  /* Release the slots before calling the callbacks, which may queue new
+     transfers or stop the channel. */
+  for (unsigned int i = 0U; i < done; i++) {
+    callback[i]  = queue->callback[queue->head];
+    userParam[i] = queue->userParam[queue->head];
+    queue->head  = (queue->head + 1) % EMDRV_DMADRV_QUEUE_DEPTH;
+  }
+  queue->count -= done;
+  CORE_EXIT_ATOMIC();
+
+  for (unsigned int i = 0U; i < done; i++) {
+    if ( callback[i] != NULL ) {
+      ch->callbackCount++;
+      STATS_CALLBACK_ENTER();
+      callback[i](channelId, ch->callbackCount, userParam[i]);
+      STATS_CALLBACK_EXIT();
+    }
+  }
+}
+#endif /* (EMDRV_DMADRV_QUEUE_DEPTH > 0) */
+
+#if (EMDRV_DMADRV_RING_MAX_SEGMENTS > 0)
+/***************************************************************************//**
+ * @brief
+ *  Check that a channel runs a ring buffer transfer. A ring buffer transfer
+ *  ends when its channel is stopped or freed.
+ ******************************************************************************/
+static Ecode_t RingCheckChannel(unsigned int channelId)
+{
+  if ( !initialized ) {
+    return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+  }
+
+  if ( channelId >= EMDRV_DMADRV_DMA_CH_COUNT ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  if ( chTable[channelId].allocated == false ) {
+    return ECODE_EMDRV_DMADRV_CH_NOT_ALLOCATED;
+  }
+
+  if ( chTable[channelId].mode != dmaModeRing ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Get the number of items written into a ring buffer since its start.
+ *
+ * @details
+ *  The destination address of the channel gives the write index, the
+ *  segments accounted for by the interrupt handler give the number of laps.
+ *  Segment completions not handled yet are covered by the distance between
+ *  the two, as long as the handler is less than one buffer length late.
+ ******************************************************************************/
+static uint32_t RingWritePosition(unsigned int channelId)
+{
+  DmaRing_t *ring = &dmaRing[channelId];
+  uint32_t position;
+  uint32_t index;
+
+#if defined(EMDRV_DMADRV_LDMA)
+  index = LDMA->CH[channelId].DST;
+#else
+  index = LDMA0->CH[channelId].DST;
+#endif
+  index    = ((index - ring->address) >> ring->sizeShift) & (ring->length - 1U);
+  position = ring->segmentsDone * ring->segmentLength;
+
+  return position + ((index - position) & (ring->length - 1U));
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Account for the completed ring buffer segments.
+ ******************************************************************************/
+static void RingIrqHandler(unsigned int channelId)
+{
+  DmaRing_t *ring = &dmaRing[channelId];
+  DMADRV_RingEvent_t event;
+  uint32_t available;
+  bool notify = false;
+
+  ring->segmentsDone = RingWritePosition(channelId) / ring->segmentLength;
+  available = (ring->segmentsDone * ring->segmentLength) - ring->readPosition;
+
+  if ( available > ring->length ) {
+    /* Report an overrun once, until the consumer reads again. */
+    if ( !ring->overrun ) {
+      ring->overrun = true;
+      event         = dmadrvRingEventOverrun;
+      notify        = true;
+    }
+  } else if ( (ring->threshold > 0U) && (available >= ring->threshold) ) {
+    event  = dmadrvRingEventThreshold;
+    notify = true;
+  }
+
+  if ( notify && (ring->callback != NULL) ) {
+    chTable[channelId].callbackCount++;
+    STATS_CALLBACK_ENTER();
+    ring->callback(channelId, event, (int)available, ring->userParam);
+    STATS_CALLBACK_EXIT();
+  }
+}
+#endif /* (EMDRV_DMADRV_RING_MAX_SEGMENTS > 0) */
+
 /// @endcond
 
 // ******** THE REST OF THE FILE IS DOCUMENTATION ONLY !***********************
@@ -1796,6 +2894,22 @@ static Ecode_t StartTransfer(DmaMode_t             mode,
 ///   @ref DMADRV_PeripheralMemoryPingPong() @n
 ///    Start a DMA ping-pong transfer from a peripheral to memory.
 ///
+///   @ref DMADRV_MemoryPeripheralEnqueue(), @ref DMADRV_PeripheralMemoryEnqueue() @n
+///    Queue a DMA transfer. Queued transfers run back to back, each with its
+///    own completion callback. Requires EMDRV_DMADRV_QUEUE_DEPTH > 0.
+///
+///   @ref DMADRV_QueuedCount() @n
+///    Get the number of queued transfers not completed yet.
+///
+///   @ref DMADRV_PeripheralMemoryRing() @n
+///    Start an endless DMA transfer from a peripheral into a ring buffer.
+///    Requires EMDRV_DMADRV_RING_MAX_SEGMENTS > 0.
+///
+///   @ref DMADRV_RingWriteIndex(), @ref DMADRV_RingAvailable(),
+///   @ref DMADRV_RingConsume(), @ref DMADRV_RingCheckIdle() @n
+///    Track the ring buffer write position, read and release received items,
+///    and detect the end of a burst.
+///
 ///   @ref DMADRV_LdmaStartTransfer() @n
 ///    Start a DMA transfer on an LDMA controller.
 ///
@@ -1820,6 +2934,10 @@ static Ecode_t StartTransfer(DmaMode_t             mode,
 ///   @ref DMADRV_TransferRemainingCount() @n
 ///    Get number of items remaining in a transfer.
 ///
+///   @ref DMADRV_GetChannelStats(), @ref DMADRV_ResetChannelStats() @n
+///    Read or reset the completion count and the interrupt and callback CPU
+///    cycles of a channel. Requires EMDRV_DMADRV_STATS_ENABLE.
+///
 ///   @n @section dmadrv_example Example
 ///   Transfer a text string to USART1.
 ///   @code{.c}
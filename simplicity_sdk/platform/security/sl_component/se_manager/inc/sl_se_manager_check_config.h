@@ -58,4 +58,16 @@
 #error "Using multiple blocks for key stream computation is not supported"
 #endif
 
+#if (SL_SE_MANAGER_COMMAND_QUEUE_SIZE > 0) \
+  && !defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
+#error "The SE command queue requires yield support, i.e. RTOS mode."
+#endif
+#if (SL_SE_MANAGER_COMMAND_QUEUE_SIZE > 255)
+#error "The SE command queue size must be less than 256."
+#endif
+
+#if (SL_SE_HASH_REGION_MAX_DESCRIPTORS < 1)
+#error "At least one data transfer descriptor is required per hash update command."
+#endif
+
 #endif // SL_SE_MANAGER_CHECK_CONFIG_H
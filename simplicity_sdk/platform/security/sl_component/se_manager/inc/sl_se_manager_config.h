@@ -55,6 +55,21 @@
   #define SLI_SE_AES_CTR_NUM_BLOCKS_BUFFERED 1
 #endif
 
+#ifndef SL_SE_MANAGER_COMMAND_QUEUE_SIZE
+// Number of SE mailbox commands that can be queued for asynchronous execution
+// with sli_se_execute_async(). Queued commands are fed to the SE mailbox from
+// the SEMBRX interrupt handler, which requires yield support. 0 disables the
+// command queue.
+  #define SL_SE_MANAGER_COMMAND_QUEUE_SIZE 0
+#endif
+
+#ifndef SL_SE_HASH_REGION_MAX_DESCRIPTORS
+// Maximum number of data transfer descriptors chained in a single hash update
+// command by sl_se_hash_multipart_update_region(). The descriptors are
+// allocated on the stack.
+  #define SL_SE_HASH_REGION_MAX_DESCRIPTORS 4
+#endif
+
 // Check consistency of configuration options.
 // Always include se_manager_check_config.h in order to assert that the
 // configuration options dependencies and restrictions are ok.
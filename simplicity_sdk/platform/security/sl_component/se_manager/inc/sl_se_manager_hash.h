@@ -267,6 +267,88 @@ sl_status_t sl_se_hash_multipart_update(void *hash_type_ctx,
                                         const uint8_t *input,
                                         size_t input_len);
 
+/***************************************************************************//**
+ * @brief
+ *   Feeds a memory-mapped region, such as internal flash, into a hash
+ *   streaming operation.
+ *
+ * @details
+ *   Unlike sl_se_hash_multipart_update(), the region is hashed directly from
+ *   memory in as few SE commands as possible: the block buffered by previous
+ *   updates and up to @ref SL_SE_HASH_REGION_MAX_DESCRIPTORS block-aligned
+ *   chunks of the region are chained in the scatter list of a single command.
+ *   Only the last partial block of the region is copied to the context.
+ *
+ * @param[in] hash_type_ctx
+ *   Pointer to a hash streaming context object.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @param[in] start
+ *   Start address of the region. The region must be readable by the SE.
+ *
+ * @param[in] length
+ *   The length of the region in bytes.
+ *
+ * @return
+ *   Status code, @ref sl_status.h.
+ ******************************************************************************/
+sl_status_t sl_se_hash_multipart_update_region(void *hash_type_ctx,
+                                               sl_se_command_context_t *cmd_ctx,
+                                               const void *start,
+                                               size_t length);
+
+/***************************************************************************//**
+ * @brief
+ *   Feeds a region read through a callback, such as external flash, into a
+ *   hash streaming operation.
+ *
+ * @details
+ *   The region is read in chunks into the two halves of @p workspace. When
+ *   the SE command queue is enabled (@ref SL_SE_MANAGER_COMMAND_QUEUE_SIZE),
+ *   the SE hashes one half while the next chunk is read into the other. The
+ *   calling thread then yields while waiting for the SE if @p cmd_ctx was
+ *   initialized with yield enabled. Otherwise the chunks are read and hashed
+ *   in turn.
+ *
+ * @param[in] hash_type_ctx
+ *   Pointer to a hash streaming context object.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @param[in] read_callback
+ *   Callback reading the region.
+ *
+ * @param[in] read_ctx
+ *   Context passed to @p read_callback.
+ *
+ * @param[in] offset
+ *   Offset of the region, passed to @p read.
+ *
+ * @param[in] length
+ *   The length of the region in bytes.
+ *
+ * @param[in] workspace
+ *   Buffer receiving the data read. Each half must hold at least one hash
+ *   block, and larger buffers mean fewer SE commands.
+ *
+ * @param[in] workspace_size
+ *   The size of @p workspace in bytes.
+ *
+ * @return
+ *   Status code, @ref sl_status.h.
+ ******************************************************************************/
+sl_status_t sl_se_hash_multipart_update_read(void *hash_type_ctx,
+                                             sl_se_command_context_t *cmd_ctx,
+                                             sl_se_hash_read_callback_t read_callback,
+                                             void *read_ctx,
+                                             size_t offset,
+                                             size_t length,
+                                             uint8_t *workspace,
+                                             size_t workspace_size);
+
 /***************************************************************************//**
  * @brief
  *   Finish a hash streaming operation and return the resulting hash digest.
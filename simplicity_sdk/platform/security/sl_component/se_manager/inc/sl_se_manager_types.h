@@ -39,6 +39,7 @@
 
 #include "sl_se_manager_defines.h"
 #include "sli_se_manager_mailbox.h"
+#include "sl_status.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -154,6 +155,19 @@ typedef struct sl_se_command_context_t {
   #endif // #if defined(_SILICON_LABS_32B_SERIES_3)
 } sl_se_command_context_t;
 
+/***************************************************************************//**
+ * @brief          SE mailbox command completion callback
+ *
+ * @details
+ *   Callback invoked when an SE mailbox command queued for asynchronous
+ *   execution completes. The callback is invoked from the SEMBRX interrupt
+ *   handler, with the status of the command and the user data given when the
+ *   command was queued. The command context may be reused from the callback.
+ ******************************************************************************/
+typedef void (*sl_se_command_callback_t)(sl_se_command_context_t *cmd_ctx,
+                                         sl_status_t status,
+                                         void *user_data);
+
 /// @} (end addtogroup sl_se_manager_core)
 
 /// @addtogroup sl_se_manager_util
@@ -465,6 +479,13 @@ typedef struct {
 
 #endif
 
+/// Callback reading @p length bytes at @p offset of a region hashed by
+/// sl_se_hash_multipart_update_read() into @p buffer.
+typedef sl_status_t (*sl_se_hash_read_callback_t)(void *read_ctx,
+                                                  size_t offset,
+                                                  uint8_t *buffer,
+                                                  size_t length);
+
 /// @} (end addtogroup sl_se_manager_hash)
 
 #if defined(_SILICON_LABS_32B_SERIES_3)
@@ -59,6 +59,16 @@ extern "C" {
 #define SLI_SE_MAX_POINT_MULT_RETRIES   3U
 #endif
 
+// Mailbox commands can be queued for asynchronous execution with
+// sli_se_execute_async(). The queue is fed from the SEMBRX interrupt handler,
+// so it needs yield support and is not available on host systems.
+#if defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION) \
+  && (SL_SE_MANAGER_COMMAND_QUEUE_SIZE > 0)                          \
+  && defined(SLI_MAILBOX_COMMAND_SUPPORTED)                          \
+  && !defined(SLI_SE_MANAGER_HOST_SYSTEM)
+#define SLI_SE_MANAGER_COMMAND_QUEUE
+#endif
+
 // -------------------------------
 // Function-like macros
 
@@ -184,6 +194,42 @@ sl_status_t sli_se_lock_release(void);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SE_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx);
 
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+/***************************************************************************//**
+ * @brief
+ *   Queue a mailbox command for asynchronous execution.
+ *
+ * @details
+ *   The command is started immediately if the SE mailbox is idle, otherwise
+ *   it is started from the SEMBRX interrupt handler once the commands queued
+ *   before it have completed. Any user of the SE lock, such as
+ *   sli_se_execute_and_wait(), is given the SE mailbox before the remaining
+ *   queued commands, and no queued command executes while the SE lock is held.
+ *
+ * @note
+ *   The command context and every buffer and data transfer descriptor it
+ *   refers to must stay valid until the completion callback is invoked.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @param[in] callback
+ *   Callback invoked when the command completes, or NULL. It is invoked from
+ *   the SEMBRX interrupt handler, or from the thread acquiring the SE lock
+ *   when that thread polls the completion, and must not block.
+ *
+ * @param[in] user_data
+ *   User data passed to the callback.
+ *
+ * @return
+ *   SL_STATUS_OK when the command was queued, SL_STATUS_FULL when the command
+ *   queue is full, or else error code.
+ ******************************************************************************/
+sl_status_t sli_se_execute_async(sl_se_command_context_t *cmd_ctx,
+                                 sl_se_command_callback_t callback,
+                                 void *user_data);
+#endif // SLI_SE_MANAGER_COMMAND_QUEUE
+
 #if defined(SLI_MAILBOX_COMMAND_SUPPORTED)
 // Key handling helper functions
 sl_status_t sli_key_get_storage_size(const sl_se_key_descriptor_t* key,
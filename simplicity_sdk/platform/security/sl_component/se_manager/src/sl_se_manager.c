@@ -36,6 +36,7 @@
 #include "sli_se_manager_internal.h"
 #include "sli_se_manager_mailbox.h"
 #include "sl_assert.h"
+#include "sl_core.h"
 #if defined(_CMU_CLKEN1_SEMAILBOXHOST_MASK)
 #if defined(_SILICON_LABS_32B_SERIES_3)
 #include "sl_hal_bus.h"
@@ -110,6 +111,32 @@ static volatile sli_psec_osal_completion_t se_command_completion;
 static volatile sli_se_mailbox_response_t se_manager_command_response = SLI_SE_RESPONSE_INTERNAL_ERROR;
   #endif // SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION
 
+  #if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+// Command queued for asynchronous execution.
+typedef struct {
+  sl_se_command_context_t *cmd_ctx;
+  sl_se_command_callback_t callback;
+  void *user_data;
+} se_command_queue_entry_t;
+
+// Asynchronous SE command queue. The command at the head of the queue is the
+// one executing in the SE mailbox while active is set, the next one is started
+// from the SEMBRX ISR. Only accessed inside atomic sections.
+static struct {
+  se_command_queue_entry_t entries[SL_SE_MANAGER_COMMAND_QUEUE_SIZE];
+  uint8_t head;
+  uint8_t count;
+  // The command at the head of the queue is executing.
+  bool active;
+  // The thread holding the SE lock owns the SE mailbox.
+  bool sync_owner;
+  // The thread holding the SE lock waits for the SE mailbox, and whether it
+  // yields while waiting.
+  bool sync_waiting;
+  bool sync_yield;
+} se_command_queue;
+  #endif // SLI_SE_MANAGER_COMMAND_QUEUE
+
 #endif // #if defined (SL_SE_MANAGER_THREADING)
 //   || defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
 
@@ -160,6 +187,143 @@ static bool configure_l1_cache(bool enable)
 
 #endif // #if defined(_SILICON_LABS_32B_SERIES_3)
 
+/***************************************************************************//**
+ *   Enable or disable the SEMAILBOX clock if necessary.
+ ******************************************************************************/
+static void se_mailbox_clock_enable(bool enable)
+{
+  #if defined(_CMU_CLKEN1_SEMAILBOXHOST_MASK)
+  #if defined(_SILICON_LABS_32B_SERIES_3)
+  sl_hal_bus_reg_write_bit(&CMU->CLKEN1, _CMU_CLKEN1_SEMAILBOXHOST_SHIFT, enable);
+  #else
+  BUS_RegBitWrite(&CMU->CLKEN1, _CMU_CLKEN1_SEMAILBOXHOST_SHIFT, enable);
+  #endif
+  if (enable) {
+    // Make sure the write to CMU->CLKEN1 is finished.
+    __DSB();
+  }
+  #else
+  (void)enable;
+  #endif
+}
+
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+
+/***************************************************************************//**
+ *   Start the command at the head of the command queue.
+ *   Must be called inside an atomic section.
+ ******************************************************************************/
+static void se_command_queue_start(void)
+{
+  se_mailbox_clock_enable(true);
+  se_command_queue.active = true;
+  sli_se_mailbox_execute_command(&se_command_queue.entries[se_command_queue.head].cmd_ctx->command);
+  sli_se_mailbox_enable_interrupt(SEMAILBOX_CONFIGURATION_RXINTEN);
+}
+
+/***************************************************************************//**
+ *   Complete the command at the head of the command queue if the SE has
+ *   answered it, and hand the SE mailbox over to the next command. Called
+ *   from the SEMBRX ISR, and polled by a thread taking the SE mailbox over.
+ *
+ * @return
+ *   true if a queued command was completed, false otherwise.
+ ******************************************************************************/
+static bool se_command_queue_complete(void)
+{
+  se_command_queue_entry_t entry;
+  sli_se_mailbox_response_t command_response;
+  sl_status_t status;
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+
+  if (!se_command_queue.active
+      || ((SEMAILBOX_HOST->RX_STATUS & SEMAILBOX_RX_STATUS_RXINT) == 0U)) {
+    CORE_EXIT_ATOMIC();
+    return false;
+  }
+
+  // Get command response and clear interrupt condition in SEMAILBOX peripheral
+  command_response = sli_se_mailbox_handle_response();
+  // Clear interrupt condition in NVIC, the response may have been polled.
+  NVIC_ClearPendingIRQ(SEMBRX_IRQn);
+
+  entry = se_command_queue.entries[se_command_queue.head];
+  se_command_queue.head = (uint8_t)((se_command_queue.head + 1U) % SL_SE_MANAGER_COMMAND_QUEUE_SIZE);
+  se_command_queue.count--;
+  se_command_queue.active = false;
+
+  if (se_command_queue.sync_waiting) {
+    // Give the SE mailbox to the thread waiting in sli_se_execute_and_wait()
+    // before the remaining queued commands.
+    sli_se_mailbox_disable_interrupt(SEMAILBOX_CONFIGURATION_RXINTEN);
+    se_command_queue.sync_waiting = false;
+    se_command_queue.sync_owner = true;
+    if (se_command_queue.sync_yield) {
+      status = sli_psec_osal_complete((sli_psec_osal_completion_t *)&se_command_completion);
+      EFM_ASSERT(status == SL_STATUS_OK);
+    }
+  } else if (se_command_queue.count > 0U) {
+    se_command_queue_start();
+  } else {
+    sli_se_mailbox_disable_interrupt(SEMAILBOX_CONFIGURATION_RXINTEN);
+    se_mailbox_clock_enable(false);
+  }
+
+  CORE_EXIT_ATOMIC();
+
+  if (entry.callback != NULL) {
+    status = (command_response == SLI_SE_RESPONSE_OK)
+             ? SL_STATUS_OK : sli_se_to_sl_status(command_response);
+    entry.callback(entry.cmd_ctx, status, entry.user_data);
+  }
+
+  return true;
+}
+
+/***************************************************************************//**
+ *   Take the SE mailbox over from the command queue, waiting for the queued
+ *   command being executed to complete if any. Must be called with the SE lock
+ *   held.
+ *
+ *   Without yield, the SE response is polled rather than waited for from the
+ *   ISR, since the SE lock may be taken with interrupts disabled.
+ ******************************************************************************/
+static sl_status_t se_command_queue_claim(bool yield)
+{
+  bool owner;
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  if (!se_command_queue.active) {
+    se_command_queue.sync_owner = true;
+    CORE_EXIT_ATOMIC();
+    // The SEMAILBOX clock is turned off when the queue runs empty.
+    se_mailbox_clock_enable(true);
+    return SL_STATUS_OK;
+  }
+  se_command_queue.sync_waiting = true;
+  se_command_queue.sync_yield = yield;
+  CORE_EXIT_ATOMIC();
+
+  if (yield) {
+    return sli_psec_osal_wait_completion((sli_psec_osal_completion_t *)&se_command_completion,
+                                         SLI_PSEC_OSAL_WAIT_FOREVER);
+  }
+
+  do {
+    (void)se_command_queue_complete();
+    CORE_ENTER_ATOMIC();
+    owner = se_command_queue.sync_owner;
+    CORE_EXIT_ATOMIC();
+  } while (!owner);
+
+  return SL_STATUS_OK;
+}
+
+#endif // SLI_SE_MANAGER_COMMAND_QUEUE
+
 // -----------------------------------------------------------------------------
 // Global functions
 
@@ -241,6 +405,18 @@ sl_status_t sl_se_deinit(void)
       return ret;
     }
 
+      #if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+    // Commands queued for asynchronous execution must complete first.
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    bool queue_empty = (se_command_queue.count == 0U);
+    CORE_EXIT_ATOMIC();
+    if (!queue_empty) {
+      sli_se_lock_release();
+      return SL_STATUS_BUSY;
+    }
+      #endif
+
       #if defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
     // Disable SE RX mailbox interrupt in NVIC.
     NVIC_ClearPendingIRQ(SEMBRX_IRQn);
@@ -316,42 +492,64 @@ sl_status_t sli_se_to_sl_status(sli_se_mailbox_response_t res)
 }
 
 /***************************************************************************//**
- * Acquire the SE lock for exclusive access if necessary (thread mode).
- * Enable the SEMAILBOX clock if necessary.
+ *   Acquire the SE lock and take the SE mailbox over from the command queue.
+ *   Every user of the SE mailbox goes through here, so a queued command is
+ *   never executing while the SE lock is held.
  ******************************************************************************/
-sl_status_t sli_se_lock_acquire(void)
+static sl_status_t se_lock_acquire(bool yield)
 {
   #if defined(SL_SE_MANAGER_THREADING)
   sl_status_t status = sli_psec_osal_take_lock(&se_lock);
   #else
   sl_status_t status = SL_STATUS_OK;
   #endif
-  #if defined(_CMU_CLKEN1_SEMAILBOXHOST_MASK)
   if (status == SL_STATUS_OK) {
-  #if defined(_SILICON_LABS_32B_SERIES_3)
-    sl_hal_bus_reg_write_bit(&CMU->CLKEN1, _CMU_CLKEN1_SEMAILBOXHOST_SHIFT, 1);
-  #else
-    BUS_RegBitWrite(&CMU->CLKEN1, _CMU_CLKEN1_SEMAILBOXHOST_SHIFT, 1);
-  #endif
-    // Make sure the write to CMU->CLKEN1 is finished.
-    __DSB();
+    se_mailbox_clock_enable(true);
+  }
+  #if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+  if (status == SL_STATUS_OK) {
+    status = se_command_queue_claim(yield);
+    if (status != SL_STATUS_OK) {
+      sli_se_lock_release();
+    }
   }
+  #else
+  (void)yield;
   #endif
   return status;
 }
 
+/***************************************************************************//**
+ * Acquire the SE lock for exclusive access if necessary (thread mode).
+ * Enable the SEMAILBOX clock if necessary.
+ ******************************************************************************/
+sl_status_t sli_se_lock_acquire(void)
+{
+  return se_lock_acquire(false);
+}
+
 /***************************************************************************//**
  * Release the SE lock if necessary (thread mode).
  * Disable the SEMAILBOX clock if necessary.
  ******************************************************************************/
 sl_status_t sli_se_lock_release(void)
 {
-  #if defined(_CMU_CLKEN1_SEMAILBOXHOST_MASK)
-  #if defined(_SILICON_LABS_32B_SERIES_3)
-  sl_hal_bus_reg_write_bit(&CMU->CLKEN1, _CMU_CLKEN1_SEMAILBOXHOST_SHIFT, 0);
+  #if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+  // Give the SE mailbox back to the command queue, and keep the SEMAILBOX
+  // clock enabled while queued commands are executing.
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  se_command_queue.sync_owner = false;
+  se_command_queue.sync_waiting = false;
+  if (!se_command_queue.active && (se_command_queue.count > 0U)) {
+    se_command_queue_start();
+  }
+  if (se_command_queue.count == 0U) {
+    se_mailbox_clock_enable(false);
+  }
+  CORE_EXIT_ATOMIC();
   #else
-  BUS_RegBitWrite(&CMU->CLKEN1, _CMU_CLKEN1_SEMAILBOXHOST_SHIFT, 0);
-  #endif
+  se_mailbox_clock_enable(false);
   #endif
   #if defined(SL_SE_MANAGER_THREADING)
   return sli_psec_osal_give_lock(&se_lock);
@@ -369,6 +567,18 @@ sl_status_t sli_se_lock_release(void)
 void SEMBRX_IRQHandler(void)
 {
   sl_status_t status;
+  #if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+  if (se_command_queue_complete()) {
+    // Completion of a queued command.
+    return;
+  }
+  if ((SEMAILBOX_HOST->RX_STATUS & SEMAILBOX_RX_STATUS_RXINT) == 0U) {
+    // A queued command completion already polled by a thread taking the SE
+    // mailbox over, there is no response to read.
+    NVIC_ClearPendingIRQ(SEMBRX_IRQn);
+    return;
+  }
+  #endif
   // Check if the SE mailbox is the source of the interrupt.
   if (SEMAILBOX_HOST->RX_STATUS & SEMAILBOX_RX_STATUS_RXINT) {
     // Signal SE mailbox completion.
@@ -426,8 +636,13 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
     return SL_STATUS_INVALID_PARAMETER;
   }
 
-  // Try to acquire SE lock
-  status = sli_se_lock_acquire();
+  // Try to acquire SE lock, and take the SE mailbox over from the
+  // asynchronous command queue
+  #if defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
+  status = se_lock_acquire(cmd_ctx->yield);
+  #else
+  status = se_lock_acquire(false);
+  #endif
   if (status != SL_STATUS_OK) {
     return status;
   }
@@ -491,7 +706,7 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
   }
   #endif // #if defined(_SILICON_LABS_32B_SERIES_3_CONFIG_301)
 
-  // Release SE lock
+  // Release SE lock, and start the commands queued while the SE mailbox was in use
   status = sli_se_lock_release();
 
   // Return sl_status_t code.
@@ -503,6 +718,59 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
   }
 }
 
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+
+/***************************************************************************//**
+ * Queue a mailbox command for asynchronous execution.
+ ******************************************************************************/
+sl_status_t sli_se_execute_async(sl_se_command_context_t *cmd_ctx,
+                                 sl_se_command_callback_t callback,
+                                 void *user_data)
+{
+  if (cmd_ctx == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  #if defined(_SILICON_LABS_32B_SERIES_3_CONFIG_301)
+  // Flash write and erase commands need the L1 cache to be disabled by the
+  // caller while they execute.
+  if (cmd_ctx->flash_wr) {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+  #endif
+
+  if (!se_manager_initialized) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+
+  if (se_command_queue.count == SL_SE_MANAGER_COMMAND_QUEUE_SIZE) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_FULL;
+  }
+
+  se_command_queue_entry_t *entry = &se_command_queue.entries[(se_command_queue.head + se_command_queue.count)
+                                                              % SL_SE_MANAGER_COMMAND_QUEUE_SIZE];
+  entry->cmd_ctx = cmd_ctx;
+  entry->callback = callback;
+  entry->user_data = user_data;
+  se_command_queue.count++;
+
+  // Start the command right away if the SE mailbox is idle. Otherwise it is
+  // started when the commands ahead of it complete.
+  if (!se_command_queue.active && !se_command_queue.sync_owner) {
+    se_command_queue_start();
+  }
+
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+#endif // SLI_SE_MANAGER_COMMAND_QUEUE
+
 #elif defined(SLI_VSE_MAILBOX_COMMAND_SUPPORTED) // SLI_MAILBOX_COMMAND_SUPPORTED
 
 sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
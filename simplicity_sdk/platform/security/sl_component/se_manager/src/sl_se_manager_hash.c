@@ -35,6 +35,9 @@
 #include "sli_se_manager_internal.h"
 #include "sli_se_manager_mailbox.h"
 #include "sl_assert.h"
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+#include "sli_psec_osal.h"
+#endif
 #include <string.h>
 
 /***************************************************************************//**
@@ -42,6 +45,263 @@
  * @{
  ******************************************************************************/
 
+// -----------------------------------------------------------------------------
+// Local types
+
+// Data transfer descriptors of a hash update command
+typedef struct {
+  volatile sli_se_datatransfer_t iv_in;
+  volatile sli_se_datatransfer_t iv_out;
+} se_hash_update_state_t;
+
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+// Hash update command executed asynchronously by the read pipeline
+typedef struct {
+  se_hash_update_state_t state;
+  volatile sli_se_datatransfer_t data_in;
+  volatile bool done;
+  volatile sl_status_t status;
+  bool yield;                            // Block on completion while waiting
+  sli_psec_osal_completion_t completion; // Signalled when done is set
+} se_hash_pipeline_job_t;
+#endif
+
+// -----------------------------------------------------------------------------
+// Local functions
+
+/***************************************************************************//**
+ *   Set up a data transfer descriptor as the last one of a list.
+ ******************************************************************************/
+static void se_hash_datatransfer_set(volatile sli_se_datatransfer_t *data,
+                                     const void *address,
+                                     size_t length)
+{
+  data->data = (void*)address;
+  data->next = (void*)SLI_SE_DATATRANSFER_STOP;
+  data->length = length | SLI_SE_DATATRANSFER_REALIGN;
+}
+
+/***************************************************************************//**
+ *   Get the block buffer, the length counter and the block size of a hash
+ *   streaming context.
+ ******************************************************************************/
+static sl_status_t se_hash_multipart_get_buffer(void *hash_type_ctx,
+                                                uint8_t **buffer,
+                                                uint32_t **counter,
+                                                size_t *blocksize)
+{
+  switch (((sl_se_sha1_multipart_context_t*)hash_type_ctx)->hash_type) {
+    case SL_SE_HASH_SHA1:
+      *counter = ((sl_se_sha1_multipart_context_t*)hash_type_ctx)->total;
+      *buffer = ((sl_se_sha1_multipart_context_t*)hash_type_ctx)->buffer;
+      *blocksize = 64;
+      break;
+    case SL_SE_HASH_SHA224:
+      *counter = ((sl_se_sha224_multipart_context_t*)hash_type_ctx)->total;
+      *buffer = ((sl_se_sha224_multipart_context_t*)hash_type_ctx)->buffer;
+      *blocksize = 64;
+      break;
+    case SL_SE_HASH_SHA256:
+      *counter = ((sl_se_sha256_multipart_context_t*)hash_type_ctx)->total;
+      *buffer = ((sl_se_sha256_multipart_context_t*)hash_type_ctx)->buffer;
+      *blocksize = 64;
+      break;
+
+#if (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT)
+    case SL_SE_HASH_SHA384:
+      *counter = ((sl_se_sha384_multipart_context_t*)hash_type_ctx)->total;
+      *buffer = ((sl_se_sha384_multipart_context_t*)hash_type_ctx)->buffer;
+      *blocksize = 128;
+      break;
+    case SL_SE_HASH_SHA512:
+      *counter = ((sl_se_sha512_multipart_context_t*)hash_type_ctx)->total;
+      *buffer = ((sl_se_sha512_multipart_context_t*)hash_type_ctx)->buffer;
+      *blocksize = 128;
+      break;
+#endif
+
+    default:
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *   Add the length of new input data to the length counter of a hash
+ *   streaming context.
+ ******************************************************************************/
+static sl_status_t se_hash_multipart_add_length(uint32_t *counter,
+                                                size_t blocksize,
+                                                size_t input_len)
+{
+  size_t countersize = blocksize / 32;
+
+  counter[0] += input_len;
+
+  // ripple counter
+  if ( counter[0] < input_len ) {
+    counter[1] += 1;
+#if (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT)
+    for (size_t i = 1; i < (countersize - 1); i++) {
+      if ( counter[i] == 0 ) {
+        counter[i + 1]++;
+      }
+    }
+#else
+    (void)countersize;
+#endif
+  }
+
+  // We only support hashing up to 4 GB data
+  // so if anything but counter[0] is set, return NOT_SUPPORTED
+#if defined(SLI_SE_MAJOR_VERSION_TWO)
+  for (size_t i = 1; i < countersize; i++) {
+    if (counter[i] != 0) {
+      return SL_STATUS_NOT_SUPPORTED;
+    }
+  }
+#endif
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *   Prepare a hash update command feeding a list of data transfer descriptors
+ *   into an ongoing hash computation. The length of the data must be a
+ *   multiple of the block size.
+ ******************************************************************************/
+static sl_status_t se_cmd_hash_multipart_prepare_update(void *hash_type_ctx,
+                                                        sl_se_command_context_t *cmd_ctx,
+                                                        se_hash_update_state_t *update,
+                                                        volatile sli_se_datatransfer_t *data_in,
+                                                        size_t ilen)
+{
+  sli_se_mailbox_command_t *se_cmd = &cmd_ctx->command;
+  uint8_t *state;
+  uint32_t command_word = SLI_SE_COMMAND_HASHUPDATE;
+  size_t state_len;
+
+  switch (((sl_se_sha1_multipart_context_t*)hash_type_ctx)->hash_type) {
+    case SL_SE_HASH_SHA1:
+      state = ((sl_se_sha1_multipart_context_t*)hash_type_ctx)->state;
+      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA1;
+      state_len = 20;
+      break;
+    case SL_SE_HASH_SHA224:
+      state = ((sl_se_sha224_multipart_context_t*)hash_type_ctx)->state;
+      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA224;
+      state_len = 32;
+      break;
+    case SL_SE_HASH_SHA256:
+      state = ((sl_se_sha256_multipart_context_t*)hash_type_ctx)->state;
+      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA256;
+      state_len = 32;
+      break;
+
+#if (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT)
+    case SL_SE_HASH_SHA384:
+      state = ((sl_se_sha384_multipart_context_t*)hash_type_ctx)->state;
+      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA384;
+      state_len = 64;
+      break;
+    case SL_SE_HASH_SHA512:
+      state = ((sl_se_sha512_multipart_context_t*)hash_type_ctx)->state;
+      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA512;
+      state_len = 64;
+      break;
+#endif
+
+    default:
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  sli_se_command_init(cmd_ctx, command_word);
+
+  sli_se_mailbox_command_add_parameter(se_cmd, ilen);
+
+  se_hash_datatransfer_set(&update->iv_in, state, state_len);
+  se_hash_datatransfer_set(&update->iv_out, state, state_len);
+
+  sli_se_mailbox_command_add_input(se_cmd, &update->iv_in);
+  sli_se_mailbox_command_add_input(se_cmd, data_in);
+  sli_se_mailbox_command_add_output(se_cmd, &update->iv_out);
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *   Feeds a list of data transfer descriptors into an ongoing hash
+ *   computation. The length of the data must be a multiple of the block size.
+ ******************************************************************************/
+static sl_status_t se_cmd_hash_multipart_update_list(void *hash_type_ctx,
+                                                     sl_se_command_context_t *cmd_ctx,
+                                                     volatile sli_se_datatransfer_t *data_in,
+                                                     size_t ilen)
+{
+  se_hash_update_state_t update;
+  sl_status_t status;
+
+  status = se_cmd_hash_multipart_prepare_update(hash_type_ctx, cmd_ctx, &update, data_in, ilen);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  // Execute and wait
+  return sli_se_execute_and_wait(cmd_ctx);
+}
+
+/***************************************************************************//**
+ *   Feeds an input block into an ongoing hash computation.
+ ******************************************************************************/
+static sl_status_t se_cmd_hash_multipart_update(void *hash_type_ctx,
+                                                sl_se_command_context_t *cmd_ctx,
+                                                const uint8_t *input,
+                                                size_t ilen)
+{
+  volatile sli_se_datatransfer_t data_in = SLI_SE_DATATRANSFER_DEFAULT(input, ilen);
+
+  return se_cmd_hash_multipart_update_list(hash_type_ctx, cmd_ctx, &data_in, ilen);
+}
+
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+/***************************************************************************//**
+ *   Completion callback of the hash update commands of the read pipeline.
+ ******************************************************************************/
+static void se_hash_pipeline_complete(sl_se_command_context_t *cmd_ctx,
+                                      sl_status_t status,
+                                      void *user_data)
+{
+  se_hash_pipeline_job_t *job = (se_hash_pipeline_job_t*)user_data;
+  (void)cmd_ctx;
+
+  job->status = status;
+  job->done = true;
+  if (job->yield) {
+    sl_status_t ret = sli_psec_osal_complete(&job->completion);
+    EFM_ASSERT(ret == SL_STATUS_OK);
+    (void)ret;
+  }
+}
+
+/***************************************************************************//**
+ *   Wait for the hash update command of the read pipeline to complete.
+ ******************************************************************************/
+static sl_status_t se_hash_pipeline_wait(se_hash_pipeline_job_t *job)
+{
+  if (job->yield) {
+    // Yield until the completion callback signals the command completion.
+    // The wait returns right away when the kernel is not running yet.
+    (void)sli_psec_osal_wait_completion(&job->completion,
+                                        SLI_PSEC_OSAL_WAIT_FOREVER);
+  }
+  while (!job->done) {
+    // Wait for the SEMBRX interrupt handler to complete the command.
+  }
+  return job->status;
+}
+#endif // SLI_SE_MANAGER_COMMAND_QUEUE
+
 // -----------------------------------------------------------------------------
 // Global functions
 
@@ -246,185 +506,307 @@ sl_status_t sl_se_hash_multipart_starts(void *hash_type_ctx,
 }
 
 /***************************************************************************//**
- *   Feeds an input block into an ongoing hash computation.
+ *   Feeds an input buffer into an ongoing hash computation.
  ******************************************************************************/
-static sl_status_t se_cmd_hash_multipart_update(void *hash_type_ctx,
-                                                sl_se_command_context_t *cmd_ctx,
-                                                const uint8_t *input,
-                                                uint32_t num_blocks)
+sl_status_t sl_se_hash_multipart_update(void *hash_type_ctx,
+                                        sl_se_command_context_t *cmd_ctx,
+                                        const uint8_t *input,
+                                        size_t input_len)
 {
-  sli_se_mailbox_command_t *se_cmd = &cmd_ctx->command;
-  uint8_t *state;
-  uint32_t command_word = SLI_SE_COMMAND_HASHUPDATE;
-  size_t state_len, blocksize;
+  size_t blocks, fill, left, blocksize;
+  sl_status_t status;
+  uint8_t *buffer;
+  uint32_t *counter;
 
-  switch (((sl_se_sha1_multipart_context_t*)hash_type_ctx)->hash_type) {
-    case SL_SE_HASH_SHA1:
-      state = ((sl_se_sha1_multipart_context_t*)hash_type_ctx)->state;
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA1;
-      state_len = 20;
-      blocksize = 64;
-      break;
-    case SL_SE_HASH_SHA224:
-      state = ((sl_se_sha224_multipart_context_t*)hash_type_ctx)->state;
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA224;
-      state_len = 32;
-      blocksize = 64;
-      break;
-    case SL_SE_HASH_SHA256:
-      state = ((sl_se_sha256_multipart_context_t*)hash_type_ctx)->state;
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA256;
-      state_len = 32;
-      blocksize = 64;
-      break;
+  if ( input_len == 0 ) {
+    return SL_STATUS_OK;
+  }
 
-#if (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT)
-    case SL_SE_HASH_SHA384:
-      state = ((sl_se_sha384_multipart_context_t*)hash_type_ctx)->state;
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA384;
-      state_len = 64;
-      blocksize = 128;
-      break;
-    case SL_SE_HASH_SHA512:
-      state = ((sl_se_sha512_multipart_context_t*)hash_type_ctx)->state;
-      command_word |= SLI_SE_COMMAND_OPTION_HASH_SHA512;
-      state_len = 64;
-      blocksize = 128;
-      break;
-#endif
+  if (hash_type_ctx == NULL || cmd_ctx == NULL || input == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
 
-    default:
-      return SL_STATUS_INVALID_PARAMETER;
+  status = se_hash_multipart_get_buffer(hash_type_ctx, &buffer, &counter, &blocksize);
+  if (status != SL_STATUS_OK) {
+    return status;
   }
 
-  sli_se_command_init(cmd_ctx, command_word);
+  left = (counter[0] & (blocksize - 1));
+  fill = blocksize - left;
 
-  size_t ilen = blocksize * num_blocks;
-  sli_se_mailbox_command_add_parameter(se_cmd, ilen);
+  status = se_hash_multipart_add_length(counter, blocksize, input_len);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
 
-  volatile sli_se_datatransfer_t data_in = SLI_SE_DATATRANSFER_DEFAULT(input, ilen);
-  volatile sli_se_datatransfer_t iv_in = SLI_SE_DATATRANSFER_DEFAULT(state, state_len);
-  volatile sli_se_datatransfer_t iv_out = SLI_SE_DATATRANSFER_DEFAULT(state, state_len);
+  if ( (left > 0) && (input_len >= fill) ) {
+    memcpy( (void *) (buffer + left), input, fill);
+    status = se_cmd_hash_multipart_update(hash_type_ctx, cmd_ctx, buffer, blocksize);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    input += fill;
+    input_len -= fill;
+    left = 0;
+  }
 
-  sli_se_mailbox_command_add_input(se_cmd, &iv_in);
-  sli_se_mailbox_command_add_input(se_cmd, &data_in);
-  sli_se_mailbox_command_add_output(se_cmd, &iv_out);
+  if ( input_len >= blocksize ) {
+    blocks = input_len / blocksize;
+    status = se_cmd_hash_multipart_update(hash_type_ctx, cmd_ctx, input, blocksize * blocks);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    input += blocksize * blocks;
+    input_len -= blocksize * blocks;
+  }
 
-  // Execute and wait
-  return sli_se_execute_and_wait(cmd_ctx);
+  if ( input_len > 0 ) {
+    memcpy( (void *) (buffer + left), input, input_len);
+  }
+
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
- *   Feeds an input buffer into an ongoing hash computation.
+ *   Feeds a memory-mapped region into an ongoing hash computation.
  ******************************************************************************/
-sl_status_t sl_se_hash_multipart_update(void *hash_type_ctx,
-                                        sl_se_command_context_t *cmd_ctx,
-                                        const uint8_t *input,
-                                        size_t input_len)
+sl_status_t sl_se_hash_multipart_update_region(void *hash_type_ctx,
+                                               sl_se_command_context_t *cmd_ctx,
+                                               const void *start,
+                                               size_t length)
 {
-  size_t blocks, fill, left, blocksize, countersize;
+  volatile sli_se_datatransfer_t data_in[SL_SE_HASH_REGION_MAX_DESCRIPTORS];
+  const uint8_t *input = (const uint8_t*)start;
+  size_t left, blocksize, max_chunk;
+  size_t num_descriptors = 0;
+  size_t ilen = 0;
   sl_status_t status;
   uint8_t *buffer;
   uint32_t *counter;
 
-  if ( input_len == 0 ) {
+  if (length == 0) {
     return SL_STATUS_OK;
   }
 
-  if (hash_type_ctx == NULL || cmd_ctx == NULL || input == NULL) {
+  if (hash_type_ctx == NULL || cmd_ctx == NULL || start == NULL) {
     return SL_STATUS_INVALID_PARAMETER;
   }
 
-  switch (((sl_se_sha1_multipart_context_t*)hash_type_ctx)->hash_type) {
-    case SL_SE_HASH_SHA1:
-      counter = ((sl_se_sha1_multipart_context_t*)hash_type_ctx)->total;
-      buffer = ((sl_se_sha1_multipart_context_t*)hash_type_ctx)->buffer;
-      blocksize = 64;
-      break;
-    case SL_SE_HASH_SHA224:
-      counter = ((sl_se_sha224_multipart_context_t*)hash_type_ctx)->total;
-      buffer = ((sl_se_sha224_multipart_context_t*)hash_type_ctx)->buffer;
-      blocksize = 64;
-      break;
-    case SL_SE_HASH_SHA256:
-      counter = ((sl_se_sha256_multipart_context_t*)hash_type_ctx)->total;
-      buffer = ((sl_se_sha256_multipart_context_t*)hash_type_ctx)->buffer;
-      blocksize = 64;
-      break;
+  status = se_hash_multipart_get_buffer(hash_type_ctx, &buffer, &counter, &blocksize);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
 
-#if (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT)
-    case SL_SE_HASH_SHA384:
-      counter = ((sl_se_sha384_multipart_context_t*)hash_type_ctx)->total;
-      buffer = ((sl_se_sha384_multipart_context_t*)hash_type_ctx)->buffer;
-      blocksize = 128;
-      break;
-    case SL_SE_HASH_SHA512:
-      counter = ((sl_se_sha512_multipart_context_t*)hash_type_ctx)->total;
-      buffer = ((sl_se_sha512_multipart_context_t*)hash_type_ctx)->buffer;
-      blocksize = 128;
-      break;
-#endif
+  left = (counter[0] & (blocksize - 1));
 
-    default:
-      return SL_STATUS_INVALID_PARAMETER;
+  status = se_hash_multipart_add_length(counter, blocksize, length);
+  if (status != SL_STATUS_OK) {
+    return status;
   }
 
-  countersize = blocksize / 32;
-  left = (counter[0] & (blocksize - 1));
-  fill = blocksize - left;
+  // Complete the block buffered by previous updates, and hash it in the same
+  // command as the start of the region.
+  if (left > 0) {
+    size_t fill = blocksize - left;
+    if (length < fill) {
+      memcpy(buffer + left, input, length);
+      return SL_STATUS_OK;
+    }
+    memcpy(buffer + left, input, fill);
+    input += fill;
+    length -= fill;
+    se_hash_datatransfer_set(&data_in[0], buffer, blocksize);
+    num_descriptors = 1;
+    ilen = blocksize;
+  }
 
-  counter[0] += input_len;
+  // Hash the region directly from memory, in chunks as large as a single
+  // data transfer descriptor allows.
+  max_chunk = SLI_SE_DATATRANSFER_LENGTH_MASK & ~(blocksize - 1);
+  while (length >= blocksize || num_descriptors > 0) {
+    if (length >= blocksize) {
+      size_t chunk = length & ~(blocksize - 1);
+      if (chunk > max_chunk) {
+        chunk = max_chunk;
+      }
+      se_hash_datatransfer_set(&data_in[num_descriptors], input, chunk);
+      if (num_descriptors > 0) {
+        data_in[num_descriptors - 1].next = (void*)&data_in[num_descriptors];
+      }
+      num_descriptors++;
+      ilen += chunk;
+      input += chunk;
+      length -= chunk;
+    }
 
-  // ripple counter
-  if ( counter[0] < input_len ) {
-    counter[1] += 1;
-#if (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT)
-    for (size_t i = 1; i < (countersize - 1); i++) {
-      if ( counter[i] == 0 ) {
-        counter[i + 1]++;
+    if (num_descriptors == SL_SE_HASH_REGION_MAX_DESCRIPTORS || length < blocksize) {
+      status = se_cmd_hash_multipart_update_list(hash_type_ctx, cmd_ctx, &data_in[0], ilen);
+      if (status != SL_STATUS_OK) {
+        return status;
       }
+      num_descriptors = 0;
+      ilen = 0;
     }
-#else
-    (void)countersize;
-#endif
   }
 
-  // We only support hashing up to 4 GB data
-  // so if anything but counter[0] is set, return NOT_SUPPORTED
-#if defined(SLI_SE_MAJOR_VERSION_TWO)
-  for (size_t i = 1; i < countersize; i++) {
-    if (counter[i] != 0) {
-      return SL_STATUS_NOT_SUPPORTED;
-    }
+  if (length > 0) {
+    memcpy(buffer, input, length);
   }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *   Feeds a region read through a callback into an ongoing hash computation.
+ ******************************************************************************/
+sl_status_t sl_se_hash_multipart_update_read(void *hash_type_ctx,
+                                             sl_se_command_context_t *cmd_ctx,
+                                             sl_se_hash_read_callback_t read_callback,
+                                             void *read_ctx,
+                                             size_t offset,
+                                             size_t length,
+                                             uint8_t *workspace,
+                                             size_t workspace_size)
+{
+  size_t left, blocksize, chunk_size;
+  sl_status_t status;
+  uint8_t *buffer;
+  uint32_t *counter;
+  uint8_t *chunk_buffer[2];
+  unsigned int current = 0;
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+  se_hash_pipeline_job_t job;
+  bool pending = false;
 #endif
 
-  if ( (left > 0) && (input_len >= fill) ) {
-    memcpy( (void *) (buffer + left), input, fill);
-    status = se_cmd_hash_multipart_update(hash_type_ctx, cmd_ctx, buffer, 1);
+  if (length == 0) {
+    return SL_STATUS_OK;
+  }
+
+  if (hash_type_ctx == NULL || cmd_ctx == NULL || read_callback == NULL || workspace == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  status = se_hash_multipart_get_buffer(hash_type_ctx, &buffer, &counter, &blocksize);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  // The workspace is split in two halves holding a whole number of blocks:
+  // one is hashed by the SE while the next chunk is read into the other.
+  chunk_size = (workspace_size / 2) & ~(blocksize - 1);
+  if (chunk_size == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  chunk_buffer[0] = workspace;
+  chunk_buffer[1] = workspace + chunk_size;
+
+  // Complete the block buffered by previous updates first.
+  left = (counter[0] & (blocksize - 1));
+  if (left > 0) {
+    size_t fill = blocksize - left;
+    if (fill > length) {
+      fill = length;
+    }
+    status = read_callback(read_ctx, offset, workspace, fill);
+    if (status == SL_STATUS_OK) {
+      status = sl_se_hash_multipart_update(hash_type_ctx, cmd_ctx, workspace, fill);
+    }
     if (status != SL_STATUS_OK) {
       return status;
     }
-    input += fill;
-    input_len -= fill;
-    left = 0;
+    offset += fill;
+    length -= fill;
   }
 
-  if ( input_len >= blocksize ) {
-    blocks = input_len / blocksize;
-    status = se_cmd_hash_multipart_update(hash_type_ctx, cmd_ctx, input, blocks);
+  size_t full_length = length & ~(blocksize - 1);
+  size_t tail_length = length - full_length;
+
+  status = se_hash_multipart_add_length(counter, blocksize, full_length);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+  job.yield = cmd_ctx->yield && (full_length > 0);
+  if (job.yield) {
+    status = sli_psec_osal_init_completion(&job.completion);
     if (status != SL_STATUS_OK) {
       return status;
     }
-    input += blocksize * blocks;
-    input_len -= blocksize * blocks;
   }
+#endif
 
-  if ( input_len > 0 ) {
-    memcpy( (void *) (buffer + left), input, input_len);
+  while (full_length > 0) {
+    size_t chunk = (full_length < chunk_size) ? full_length : chunk_size;
+
+    // Read the next chunk while the SE hashes the previous one.
+    status = read_callback(read_ctx, offset, chunk_buffer[current], chunk);
+
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+    if (pending) {
+      sl_status_t job_status = se_hash_pipeline_wait(&job);
+      pending = false;
+      if (status == SL_STATUS_OK) {
+        status = job_status;
+      }
+    }
+    if (status != SL_STATUS_OK) {
+      break;
+    }
+
+    se_hash_datatransfer_set(&job.data_in, chunk_buffer[current], chunk);
+    status = se_cmd_hash_multipart_prepare_update(hash_type_ctx, cmd_ctx, &job.state, &job.data_in, chunk);
+    if (status != SL_STATUS_OK) {
+      break;
+    }
+    job.done = false;
+    status = sli_se_execute_async(cmd_ctx, se_hash_pipeline_complete, &job);
+    if (status == SL_STATUS_OK) {
+      pending = true;
+    } else if (status == SL_STATUS_FULL) {
+      // The command queue is used by others, run the command synchronously.
+      status = sli_se_execute_and_wait(cmd_ctx);
+    }
+#else
+    if (status == SL_STATUS_OK) {
+      status = se_cmd_hash_multipart_update(hash_type_ctx, cmd_ctx, chunk_buffer[current], chunk);
+    }
+#endif
+    if (status != SL_STATUS_OK) {
+      break;
+    }
+
+    current ^= 1U;
+    offset += chunk;
+    full_length -= chunk;
   }
 
-  return SL_STATUS_OK;
+#if defined(SLI_SE_MANAGER_COMMAND_QUEUE)
+  if (pending) {
+    sl_status_t job_status = se_hash_pipeline_wait(&job);
+    if (status == SL_STATUS_OK) {
+      status = job_status;
+    }
+  }
+  if (job.yield) {
+    (void)sli_psec_osal_free_completion(&job.completion);
+  }
+#endif
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  // Buffer the last partial block in the hash streaming context.
+  if (tail_length > 0) {
+    status = read_callback(read_ctx, offset, buffer, tail_length);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    status = se_hash_multipart_add_length(counter, blocksize, tail_length);
+  }
+
+  return status;
 }
 
 /***************************************************************************//**
@@ -194,6 +194,40 @@ sl_status_t sli_ccm_zigbee(bool encrypt,
                            unsigned char       *tag,
                            size_t              tag_len);
 
+/// One frame of a batch of Zigbee CCM operations
+typedef struct {
+  bool                encrypt;        ///< true to encrypt and tag, false to decrypt and verify
+  const unsigned char *key;           ///< AES-128 key
+  const unsigned char *iv;            ///< 13-byte nonce
+  const unsigned char *aad;           ///< Additional Authenticated Data
+  size_t              aad_len;        ///< Length of aad
+  const unsigned char *data_in;       ///< Input payload
+  unsigned char       *data_out;      ///< Output payload, can be equal to data_in
+  size_t              length;         ///< Length of the payload
+  unsigned char       *tag;           ///< Authentication tag (MIC)
+  size_t              tag_len;        ///< Length of tag, 0 for CCM* without MIC
+  sl_status_t         status;         ///< Result of the operation, set by the batch
+} sli_ccm_zigbee_frame_t;
+
+/***************************************************************************//**
+ * @brief          CCM encryption/decryption of a burst of Zigbee frames
+ *
+ * @details        All the frames are processed under a single RADIOAES
+ *                 acquire, and the descriptors of a frame are built while
+ *                 the previous frame is processed. Each frame gets its own
+ *                 result, a failing frame does not stop the batch.
+ *
+ * @param frames      Array of frames
+ * @param frame_count Number of frames in the array
+ *
+ * @return         SL_STATUS_OK if all the frames were processed and
+ *                 authenticated, otherwise the status of the last failing
+ *                 frame or of the RADIOAES acquire
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+sl_status_t sli_ccm_zigbee_batch(sli_ccm_zigbee_frame_t frames[],
+                                 size_t                 frame_count);
+
 /***************************************************************************//**
  * @brief          Process a table of BLE RPA device keys and look for a
  *                 match against the supplied hash
@@ -212,6 +246,57 @@ int sli_process_ble_rpa(const unsigned char keytable[],
                         uint32_t            prand,
                         uint32_t            hash);
 
+/***************************************************************************//**
+ * @brief          Process a table of BLE RPA device keys of any size and look
+ *                 for a match against the supplied hash
+ *
+ * @param keytable      Pointer to an array of AES-128 keys, corresponding to
+ *                      the per-device key in the BLE RPA process
+ * @param keymask       Array of bitmasks indicating which key indices in
+ *                      keytable are valid, 32 keys per word
+ * @param keymask_words Number of words in keymask
+ * @param prand         24-bit BLE nonce to encrypt with each key and match
+ *                      against hash
+ * @param hash          BLE RPA hash to match against (last 24 bits of AES
+ *                      result)
+ *
+ * @return         0-based index of matching key if a match is found, -1 for no match.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+int sli_process_ble_rpa_batch(const unsigned char keytable[],
+                              const uint32_t      keymask[],
+                              size_t              keymask_words,
+                              uint32_t            prand,
+                              uint32_t            hash);
+
+/// Statistics of the cache of resolved BLE RPAs
+typedef struct {
+  uint32_t hits;          ///< Addresses resolved from the cache
+  uint32_t misses;        ///< Addresses resolved from the whole key table
+  uint32_t stale_entries; ///< Cached addresses no longer resolved by their key
+} sli_ble_rpa_cache_statistics_t;
+
+/***************************************************************************//**
+ * @brief          Get the statistics of the cache of resolved BLE RPAs
+ *
+ * @param statistics Pointer to the statistics to fill
+ ******************************************************************************/
+void sli_process_ble_rpa_get_cache_statistics(sli_ble_rpa_cache_statistics_t *statistics);
+
+/***************************************************************************//**
+ * @brief          Reset the statistics of the cache of resolved BLE RPAs
+ ******************************************************************************/
+void sli_process_ble_rpa_reset_cache_statistics(void);
+
+/***************************************************************************//**
+ * @brief          Drop all the addresses from the cache of resolved BLE RPAs
+ *
+ * @details        Cached addresses are checked against their key before being
+ *                 used, so calling this function when the key table changes
+ *                 is not required, but avoids the cost of that check.
+ ******************************************************************************/
+void sli_process_ble_rpa_invalidate_cache(void);
+
 #ifdef __cplusplus
 }
 #endif
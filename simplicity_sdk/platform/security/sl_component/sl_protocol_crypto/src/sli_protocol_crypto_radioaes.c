@@ -36,6 +36,7 @@
 #include "sli_protocol_crypto.h"
 #include "sl_code_classification.h"
 #include "em_core.h"
+#include "sl_common.h"
 
 #define AES_BLOCK_BYTES       16U
 #define AES_128_KEY_BYTES     16U
@@ -47,6 +48,11 @@
 #define RADIOAES_BLE_RPA_MAX_KEYS 32
 #endif
 
+// Number of resolved BLE RPAs cached. 0 disables the cache.
+#ifndef RADIOAES_BLE_RPA_CACHE_SIZE
+#define RADIOAES_BLE_RPA_CACHE_SIZE 8
+#endif
+
 /// value for sli_radioaes_dma_sg_descr.tag to direct data to parameters
 #define DMA_SG_TAG_ISCONFIG 0x00000010
 /// value for sli_radioaes_dma_sg_descr.tag to direct data to processing
@@ -225,20 +231,56 @@ static sl_status_t sli_radioaes_run_operation(sli_radioaes_dma_descr_t *first_fe
   return sli_radioaes_release();
 }
 
-// CCM (and CCM-star) implementation
+///
+/// @brief Descriptor lists and buffers of a CCM operation, kept together so
+/// the lists of several operations can be prepared ahead of running them.
+///
+typedef struct {
+  sli_radioaes_dma_descr_t fetcher_config;
+  sli_radioaes_dma_descr_t fetcher_key;
+  sli_radioaes_dma_descr_t fetcher_header;
+  sli_radioaes_dma_descr_t fetcher_add;
+  sli_radioaes_dma_descr_t fetcher_data;
+  sli_radioaes_dma_descr_t fetcher_tag;
+  sli_radioaes_dma_descr_t pusher_header_add;
+  sli_radioaes_dma_descr_t pusher_data;
+  sli_radioaes_dma_descr_t pusher_data_padding;
+  sli_radioaes_dma_descr_t pusher_tag;
+  sli_radioaes_dma_descr_t pusher_final_padding;
+  volatile uint8_t ver_failed[AES_BLOCK_BYTES];
+  uint8_t header[18];
+  bool encrypt;
+  size_t tag_length;
+} aes_ccm_radio_job_t;
+
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
-static sl_status_t aes_ccm_radio(bool                encrypt,
-                                 const unsigned char *add_data,
-                                 size_t              add_length,
-                                 const unsigned char *data_in,
-                                 unsigned char       *data_out,
-                                 size_t              length,
-                                 const unsigned char *key,
-                                 const unsigned char *header,
-                                 size_t              header_length,
-                                 unsigned char       *tag,
-                                 size_t              tag_length)
+static void radioaes_descr_set(sli_radioaes_dma_descr_t *descr,
+                               uint32_t                 address,
+                               uint32_t                 next_descr,
+                               uint32_t                 length_and_irq,
+                               uint32_t                 tag)
+{
+  descr->address = address;
+  descr->nextDescr = next_descr;
+  descr->lengthAndIrq = length_and_irq;
+  descr->tag = tag;
+}
 
+// Build the descriptor lists of a CCM (or CCM-star) operation. The header
+// buffer must stay valid until the operation completes.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+static void aes_ccm_radio_prepare(aes_ccm_radio_job_t *job,
+                                  bool                encrypt,
+                                  const unsigned char *add_data,
+                                  size_t              add_length,
+                                  const unsigned char *data_in,
+                                  unsigned char       *data_out,
+                                  size_t              length,
+                                  const unsigned char *key,
+                                  const unsigned char *header,
+                                  size_t              header_length,
+                                  unsigned char       *tag,
+                                  size_t              tag_length)
 {
   // Assumptions:
   // * There is always header input, but the header input may be block-aligned (BLE-CCM)
@@ -248,8 +290,13 @@ static sl_status_t aes_ccm_radio(bool                encrypt,
   // * Data output may be NULL (in which case it is discarded)
   // * Tag length may be 0 (CCM-star), in which case the tag pointer is also allowed to be NULL
 
-  // Setup ver_failed output buffer and initialize it in case of decryption to an invalid value
-  volatile uint8_t ver_failed[AES_BLOCK_BYTES] = {[0 ... AES_BLOCK_BYTES - 1] = 0xFF };
+  job->encrypt = encrypt;
+  job->tag_length = tag_length;
+
+  // Initialize ver_failed output buffer in case of decryption to an invalid value
+  for (size_t i = 0; i < AES_BLOCK_BYTES; i++) {
+    job->ver_failed[i] = 0xFF;
+  }
 
   // Calculate padding bytes. Since the accelerator expects to see the AESPAYLOAD data type
   // at least once during the operation, ensure that we're emitting a padding block in case
@@ -262,138 +309,141 @@ static sl_status_t aes_ccm_radio(bool                encrypt,
   // Tag output. If used, always the last descriptor. Not used for CCM-* without tag, the
   // accelerator actually looks at the header and figures out whether or not to take in
   // tag input.
-  sli_radioaes_dma_descr_t ccm_desc_fetcher_tag = {
-    .address       = (uint32_t) tag,
-    .nextDescr     = (uint32_t) DMA_AXI_DESCR_END_POINTER,
-    .lengthAndIrq  = (uint32_t) tag_length
+  radioaes_descr_set(&job->fetcher_tag,
+                     (uint32_t) tag,
+                     (uint32_t) DMA_AXI_DESCR_END_POINTER,
+                     (uint32_t) tag_length
                      | BLOCK_S_INCR_ADDR
                      | BLOCK_S_REALIGN_DATA,
-    .tag           = DMA_SG_ENGINESELECT_BA411E
+                     DMA_SG_ENGINESELECT_BA411E
                      | DMA_SG_TAG_ISDATA
                      | DMA_SG_TAG_ISLAST
                      | DMA_SG_TAG_DATATYPE_AESPAYLOAD
-                     | DMA_SG_TAG_SETINVALIDBYTES(AES_BLOCK_BYTES - tag_length)
-  };
+                     | DMA_SG_TAG_SETINVALIDBYTES(AES_BLOCK_BYTES - tag_length));
 
   // Data input. Can be zero-length, in which case we'll issue a bogus descriptor instead.
-  sli_radioaes_dma_descr_t ccm_desc_fetcher_data = {
-    .address       = (uint32_t) (length > 0 ? data_in : ver_failed),
-    .nextDescr     = (uint32_t) ((encrypt || tag_length == 0) ? DMA_AXI_DESCR_END_POINTER : &ccm_desc_fetcher_tag),
-    .lengthAndIrq  = (uint32_t) (length > 0 ? length : data_pad_bytes)
+  radioaes_descr_set(&job->fetcher_data,
+                     (uint32_t) (length > 0 ? data_in : job->ver_failed),
+                     (uint32_t) ((encrypt || tag_length == 0) ? DMA_AXI_DESCR_END_POINTER : &job->fetcher_tag),
+                     (uint32_t) (length > 0 ? length : data_pad_bytes)
                      | BLOCK_S_INCR_ADDR
                      | BLOCK_S_REALIGN_DATA,
-    .tag           = DMA_SG_ENGINESELECT_BA411E
+                     DMA_SG_ENGINESELECT_BA411E
                      | DMA_SG_TAG_ISDATA
                      | DMA_SG_TAG_DATATYPE_AESPAYLOAD
                      | ((encrypt || tag_length == 0) ? DMA_SG_TAG_ISLAST : 0)
-                     | DMA_SG_TAG_SETINVALIDBYTES(data_pad_bytes),
-  };
+                     | DMA_SG_TAG_SETINVALIDBYTES(data_pad_bytes));
 
   // Possible CCM AAD block (concatenated with the header). Can be zero-length, in which case
   // this descriptor should not be referenced but rather bypassed to data.
-  sli_radioaes_dma_descr_t ccm_desc_fetcher_add = {
-    .address       = (uint32_t) add_data,
-    .nextDescr     = (uint32_t) &ccm_desc_fetcher_data,
-    .lengthAndIrq  = (uint32_t) add_length
+  radioaes_descr_set(&job->fetcher_add,
+                     (uint32_t) add_data,
+                     (uint32_t) &job->fetcher_data,
+                     (uint32_t) add_length
                      | BLOCK_S_INCR_ADDR
                      | BLOCK_S_REALIGN_DATA,
-    .tag           = DMA_SG_ENGINESELECT_BA411E
+                     DMA_SG_ENGINESELECT_BA411E
                      | DMA_SG_TAG_ISDATA
                      | DMA_SG_TAG_DATATYPE_AESHEADER
-                     | DMA_SG_TAG_SETINVALIDBYTES(header_pad_bytes)
-  };
+                     | DMA_SG_TAG_SETINVALIDBYTES(header_pad_bytes));
 
   // Header input block. Always present.
-  sli_radioaes_dma_descr_t ccm_desc_fetcher_header = {
-    .address       = (uint32_t) header,
-    .nextDescr     = (uint32_t) (add_length > 0 ? &ccm_desc_fetcher_add : &ccm_desc_fetcher_data),
-    .lengthAndIrq  = (uint32_t) header_length
+  radioaes_descr_set(&job->fetcher_header,
+                     (uint32_t) header,
+                     (uint32_t) (add_length > 0 ? &job->fetcher_add : &job->fetcher_data),
+                     (uint32_t) header_length
                      | BLOCK_S_INCR_ADDR
                      | (add_length > 0 ? 0 : BLOCK_S_REALIGN_DATA),
-    .tag           = DMA_SG_ENGINESELECT_BA411E
+                     DMA_SG_ENGINESELECT_BA411E
                      | DMA_SG_TAG_ISDATA
                      | DMA_SG_TAG_DATATYPE_AESHEADER
-                     | (add_length > 0 ? 0 : DMA_SG_TAG_SETINVALIDBYTES(header_pad_bytes))
-  };
+                     | (add_length > 0 ? 0 : DMA_SG_TAG_SETINVALIDBYTES(header_pad_bytes)));
 
   // Key input block. Always present.
-  sli_radioaes_dma_descr_t ccm_desc_fetcher_key = {
-    .address       = (uint32_t) key,
-    .nextDescr     = (uint32_t) &ccm_desc_fetcher_header,
-    .lengthAndIrq  = (uint32_t) AES_128_KEY_BYTES
+  radioaes_descr_set(&job->fetcher_key,
+                     (uint32_t) key,
+                     (uint32_t) &job->fetcher_header,
+                     (uint32_t) AES_128_KEY_BYTES
                      | BLOCK_S_INCR_ADDR
                      | BLOCK_S_REALIGN_DATA,
-    .tag           = DMA_SG_ENGINESELECT_BA411E
+                     DMA_SG_ENGINESELECT_BA411E
                      | DMA_SG_TAG_ISCONFIG
-                     | DMA_SG_TAG_SETCFGOFFSET(AES_OFFSET_KEY)
-  };
+                     | DMA_SG_TAG_SETCFGOFFSET(AES_OFFSET_KEY));
 
   // Operation configuration word block. Always present.
-  sli_radioaes_dma_descr_t ccm_desc_fetcher_config = {
-    .address       = (uint32_t) (encrypt ? &aes_ccm_config_encrypt : &aes_ccm_config_decrypt),
-    .nextDescr     = (uint32_t) &ccm_desc_fetcher_key,
-    .lengthAndIrq  = (uint32_t) RADIOAES_CONFIG_BYTES
+  radioaes_descr_set(&job->fetcher_config,
+                     (uint32_t) (encrypt ? &aes_ccm_config_encrypt : &aes_ccm_config_decrypt),
+                     (uint32_t) &job->fetcher_key,
+                     (uint32_t) RADIOAES_CONFIG_BYTES
                      | BLOCK_S_INCR_ADDR
                      | BLOCK_S_REALIGN_DATA,
-    .tag           = DMA_SG_ENGINESELECT_BA411E
+                     DMA_SG_ENGINESELECT_BA411E
                      | DMA_SG_TAG_ISCONFIG
-                     | DMA_SG_TAG_SETCFGOFFSET(AES_OFFSET_CFG)
-  };
+                     | DMA_SG_TAG_SETCFGOFFSET(AES_OFFSET_CFG));
 
   // Pushers
 
   // Tag / verification output padding, only if 0 < tag length < 16 bytes.
-  sli_radioaes_dma_descr_t ccm_desc_pusher_final_padding = {
-    .address       = (uint32_t) NULL,
-    .nextDescr     = (uint32_t) DMA_AXI_DESCR_END_POINTER,
-    .lengthAndIrq  = (uint32_t) (AES_BLOCK_BYTES - tag_length)
-                     | DMA_AXI_DESCR_DISCARD
-  };
+  radioaes_descr_set(&job->pusher_final_padding,
+                     (uint32_t) NULL,
+                     (uint32_t) DMA_AXI_DESCR_END_POINTER,
+                     (uint32_t) (AES_BLOCK_BYTES - tag_length)
+                     | DMA_AXI_DESCR_DISCARD,
+                     0);
 
   // Tag output. Direct into tag buffer for encrypt, into local buffer for
   // decrypt-and-verify. This descriptor is not referenced with tag_length == 0 (CCM-*)
-  sli_radioaes_dma_descr_t ccm_desc_pusher_tag = {
-    .address       = (uint32_t) (encrypt ? tag : (unsigned char *)ver_failed),
-    .nextDescr     = (uint32_t) ((AES_BLOCK_BYTES - tag_length) > 0 ? &ccm_desc_pusher_final_padding : DMA_AXI_DESCR_END_POINTER),
-    .lengthAndIrq  = (uint32_t) tag_length
-  };
+  radioaes_descr_set(&job->pusher_tag,
+                     (uint32_t) (encrypt ? tag : (unsigned char *)job->ver_failed),
+                     (uint32_t) ((AES_BLOCK_BYTES - tag_length) > 0 ? &job->pusher_final_padding : DMA_AXI_DESCR_END_POINTER),
+                     (uint32_t) tag_length,
+                     0);
 
   // Data padding output. There's guaranteed always at least one of data or data padding.
-  sli_radioaes_dma_descr_t ccm_desc_pusher_data_padding = {
-    .address       = (uint32_t) NULL,
-    .nextDescr     = (uint32_t) (tag_length > 0 ? &ccm_desc_pusher_tag : DMA_AXI_DESCR_END_POINTER),
-    .lengthAndIrq  = (uint32_t) data_pad_bytes
+  radioaes_descr_set(&job->pusher_data_padding,
+                     (uint32_t) NULL,
+                     (uint32_t) (tag_length > 0 ? &job->pusher_tag : DMA_AXI_DESCR_END_POINTER),
+                     (uint32_t) data_pad_bytes
                      | DMA_AXI_DESCR_DISCARD,
-  };
+                     0);
 
   // Data (ciphertext/plaintext) output. Pointer can be NULL, in which case we tell the
   // DMA to discard the data.
-  sli_radioaes_dma_descr_t ccm_desc_pusher_data = {
-    .address       = (uint32_t) data_out,
-    .nextDescr     = (uint32_t) (data_pad_bytes > 0 ? &ccm_desc_pusher_data_padding : (tag_length > 0 ? &ccm_desc_pusher_tag : DMA_AXI_DESCR_END_POINTER)),
-    .lengthAndIrq  = (uint32_t) length
+  radioaes_descr_set(&job->pusher_data,
+                     (uint32_t) data_out,
+                     (uint32_t) (data_pad_bytes > 0 ? &job->pusher_data_padding : (tag_length > 0 ? &job->pusher_tag : DMA_AXI_DESCR_END_POINTER)),
+                     (uint32_t) length
                      | (data_out == NULL ? DMA_AXI_DESCR_DISCARD : 0),
-  };
+                     0);
 
   // Discard all AAD input (which is reflected back to the output). There's guaranteed always a header.
-  sli_radioaes_dma_descr_t ccm_desc_pusher_header_add = {
-    .address       = (uint32_t) NULL,
-    .nextDescr     = (uint32_t) (length > 0 ? &ccm_desc_pusher_data : &ccm_desc_pusher_data_padding),
-    .lengthAndIrq  = (uint32_t) (header_length + add_length + header_pad_bytes)
-                     | DMA_AXI_DESCR_DISCARD
-  };
+  radioaes_descr_set(&job->pusher_header_add,
+                     (uint32_t) NULL,
+                     (uint32_t) (length > 0 ? &job->pusher_data : &job->pusher_data_padding),
+                     (uint32_t) (header_length + add_length + header_pad_bytes)
+                     | DMA_AXI_DESCR_DISCARD,
+                     0);
+}
 
-  sl_status_t status = sli_radioaes_run_operation(&ccm_desc_fetcher_config, &ccm_desc_pusher_header_add);
+// Start the operation of a prepared job. RADIOAES must be acquired, idle and
+// already fed with the mask when masking is required.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+static void aes_ccm_radio_start(aes_ccm_radio_job_t *job)
+{
+  RADIOAES->FETCHADDR = (uint32_t) &job->fetcher_config;
+  RADIOAES->PUSHADDR  = (uint32_t) &job->pusher_header_add;
 
-  if (status != SL_STATUS_OK) {
-    return status;
-  }
+  RADIOAES->CMD = AES_CMD_STARTPUSHER | AES_CMD_STARTFETCHER;
+}
 
-  // Check MIC
-  if (!encrypt) {
+// Check the MIC of a completed job.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_status_t aes_ccm_radio_finish(const aes_ccm_radio_job_t *job)
+{
+  if (!job->encrypt) {
     uint32_t accumulator = 0;
-    for (size_t i = 0; i < tag_length; i++) {
-      accumulator |= ver_failed[i];
+    for (size_t i = 0; i < job->tag_length; i++) {
+      accumulator |= job->ver_failed[i];
     }
     if (accumulator != 0) {
       return SL_STATUS_INVALID_SIGNATURE;
@@ -402,6 +452,40 @@ static sl_status_t aes_ccm_radio(bool                encrypt,
   return SL_STATUS_OK;
 }
 
+// CCM (and CCM-star) implementation
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_status_t aes_ccm_radio(bool                encrypt,
+                                 const unsigned char *add_data,
+                                 size_t              add_length,
+                                 const unsigned char *data_in,
+                                 unsigned char       *data_out,
+                                 size_t              length,
+                                 const unsigned char *key,
+                                 const unsigned char *header,
+                                 size_t              header_length,
+                                 unsigned char       *tag,
+                                 size_t              tag_length)
+
+{
+  aes_ccm_radio_job_t job;
+
+  aes_ccm_radio_prepare(&job,
+                        encrypt,
+                        add_data, add_length,
+                        data_in, data_out, length,
+                        key,
+                        header, header_length,
+                        tag, tag_length);
+
+  sl_status_t status = sli_radioaes_run_operation(&job.fetcher_config, &job.pusher_header_add);
+
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  return aes_ccm_radio_finish(&job);
+}
+
 // Perform a CCM encrypt/decrypt operation with BLE parameters and input.
 // This means:
 // * 13 bytes IV
@@ -678,22 +762,19 @@ sl_status_t sli_ccm_encrypt_and_tag_ble(unsigned char       *data,
                      tag);
 }
 
-sl_status_t sli_ccm_zigbee(bool encrypt,
-                           const unsigned char *data_in,
-                           unsigned char       *data_out,
-                           size_t              length,
-                           const unsigned char *key,
-                           const unsigned char *iv,
-                           const unsigned char *aad,
-                           size_t              aad_len,
-                           unsigned char       *tag,
-                           size_t              tag_len)
+// Build the CCM header (B0 block and AAD length) of a Zigbee operation.
+// Returns the header length.
+//
+// Validated assumption: for ZigBee, the authenticated data
+// length will always fit into a 16-bit length field, meaning
+// the header will always be either 16 or 18 bytes long.
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+static size_t ccm_zigbee_header(uint8_t             header[18],
+                                size_t              length,
+                                const unsigned char *iv,
+                                size_t              aad_len,
+                                size_t              tag_len)
 {
-  // Validated assumption: for ZigBee, the authenticated data
-  // length will always fit into a 16-bit length field, meaning
-  // the header will always be either 16 or 18 bytes long.
-  uint8_t header[18];
-
   // Start with the 'flags' byte. It encodes whether there is AAD,
   // and the length of the tag fields
   header[0] = 0x01 // always 2 bytes of message length
@@ -711,6 +792,23 @@ sl_status_t sli_ccm_zigbee(bool encrypt,
     header[17] = (uint8_t) aad_len; // lower octet of AAD length
   }
 
+  return (aad_len > 0 ? 18 : 16);
+}
+
+sl_status_t sli_ccm_zigbee(bool encrypt,
+                           const unsigned char *data_in,
+                           unsigned char       *data_out,
+                           size_t              length,
+                           const unsigned char *key,
+                           const unsigned char *iv,
+                           const unsigned char *aad,
+                           size_t              aad_len,
+                           unsigned char       *tag,
+                           size_t              tag_len)
+{
+  uint8_t header[18];
+  size_t header_length = ccm_zigbee_header(header, length, iv, aad_len, tag_len);
+
   return aes_ccm_radio(encrypt,
                        aad,
                        aad_len,
@@ -719,22 +817,216 @@ sl_status_t sli_ccm_zigbee(bool encrypt,
                        length,
                        key,
                        header,
-                       (aad_len > 0 ? 18 : 16),
+                       header_length,
                        tag,
                        tag_len);
 }
 
+sl_status_t sli_ccm_zigbee_batch(sli_ccm_zigbee_frame_t frames[],
+                                 size_t                 frame_count)
+{
+  // Two jobs: the descriptor lists of a frame are built while RADIOAES
+  // processes the previous frame.
+  aes_ccm_radio_job_t jobs[2];
+  sli_radioaes_state_t aes_ctx;
+  sl_status_t batch_status = SL_STATUS_OK;
+
+  if (frame_count == 0) {
+    return SL_STATUS_OK;
+  }
+
+  sl_status_t status = sli_radioaes_acquire();
+  if (status == SL_STATUS_ISR) {
+    sli_radioaes_save_state(&aes_ctx);
+  } else if (status != SL_STATUS_OK) {
+    for (size_t i = 0; i < frame_count; i++) {
+      frames[i].status = status;
+    }
+    return status;
+  }
+
+  RADIOAES->CTRL = AES_CTRL_FETCHERSCATTERGATHER | AES_CTRL_PUSHERSCATTERGATHER;
+
+  #if defined(SLI_RADIOAES_REQUIRES_MASKING)
+  // Feed the mask once, it applies to all the frames of the batch
+  sli_radioaes_dma_descr_t mask_descr = SLI_RADIOAES_MASK_DESCRIPTOR(DMA_AXI_DESCR_NEXT_STOP);
+  RADIOAES->FETCHADDR = (uint32_t) &mask_descr;
+  RADIOAES->CMD = AES_CMD_STARTFETCHER;
+  #endif
+
+  for (size_t i = 0; i <= frame_count; i++) {
+    aes_ccm_radio_job_t *job = &jobs[i % 2];
+
+    if (i < frame_count) {
+      sli_ccm_zigbee_frame_t *frame = &frames[i];
+      size_t header_length = ccm_zigbee_header(job->header,
+                                               frame->length,
+                                               frame->iv,
+                                               frame->aad_len,
+                                               frame->tag_len);
+      aes_ccm_radio_prepare(job,
+                            frame->encrypt,
+                            frame->aad, frame->aad_len,
+                            frame->data_in, frame->data_out, frame->length,
+                            frame->key,
+                            job->header, header_length,
+                            frame->tag, frame->tag_len);
+    }
+
+    while (RADIOAES->STATUS & (AES_STATUS_FETCHERBSY | AES_STATUS_PUSHERBSY)) {
+      // Wait for completion of the previous frame
+    }
+
+    if (i < frame_count) {
+      aes_ccm_radio_start(job);
+    }
+
+    if (i > 0) {
+      frames[i - 1].status = aes_ccm_radio_finish(&jobs[(i - 1) % 2]);
+      if (frames[i - 1].status != SL_STATUS_OK) {
+        batch_status = frames[i - 1].status;
+      }
+    }
+  }
+
+  if (status == SL_STATUS_ISR) {
+    sli_radioaes_restore_state(&aes_ctx);
+  }
+
+  status = sli_radioaes_release();
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  return batch_status;
+}
+
+#if (RADIOAES_BLE_RPA_CACHE_SIZE > 0)
+// Cache of recently resolved BLE RPAs, mapping an address to the index of the
+// key which resolved it.
+// The entries are kept in most recently used first order.
+static struct {
+  const unsigned char *keytable;
+  uint32_t prand;
+  uint32_t hash;
+  int index;
+} ble_rpa_cache[RADIOAES_BLE_RPA_CACHE_SIZE];
+static size_t ble_rpa_cache_count;
+static sli_ble_rpa_cache_statistics_t ble_rpa_cache_statistics;
+
+// Look up an address in the cache and move it first. Returns the index of the
+// key which resolved the address, or -1 if the address is not in the cache.
+static int ble_rpa_cache_lookup(const unsigned char keytable[],
+                                uint32_t prand,
+                                uint32_t hash)
+{
+  int index = -1;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  for (size_t i = 0; i < ble_rpa_cache_count; i++) {
+    if ((ble_rpa_cache[i].prand == prand)
+        && (ble_rpa_cache[i].hash == hash)
+        && (ble_rpa_cache[i].keytable == keytable)) {
+      index = ble_rpa_cache[i].index;
+      for (; i > 0; i--) {
+        ble_rpa_cache[i] = ble_rpa_cache[i - 1];
+      }
+      ble_rpa_cache[0].keytable = keytable;
+      ble_rpa_cache[0].prand = prand;
+      ble_rpa_cache[0].hash = hash;
+      ble_rpa_cache[0].index = index;
+      break;
+    }
+  }
+  if (index < 0) {
+    ble_rpa_cache_statistics.misses++;
+  }
+  CORE_EXIT_CRITICAL();
+
+  return index;
+}
+
+// Record whether a cached address was still resolved by its key. A stale
+// entry also counts as a miss, as the whole key table is then processed.
+static void ble_rpa_cache_record_check(bool hit)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  if (hit) {
+    ble_rpa_cache_statistics.hits++;
+  } else {
+    ble_rpa_cache_statistics.stale_entries++;
+    ble_rpa_cache_statistics.misses++;
+  }
+  CORE_EXIT_CRITICAL();
+}
+
+// Insert a resolved address first in the cache, evicting the least recently
+// used address if the cache is full. A negative index removes the address
+// from the cache instead.
+static void ble_rpa_cache_update(const unsigned char keytable[],
+                                 uint32_t prand,
+                                 uint32_t hash,
+                                 int index)
+{
+  size_t i;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  for (i = 0; i < ble_rpa_cache_count; i++) {
+    if ((ble_rpa_cache[i].prand == prand)
+        && (ble_rpa_cache[i].hash == hash)
+        && (ble_rpa_cache[i].keytable == keytable)) {
+      break;
+    }
+  }
+  if (i == ble_rpa_cache_count) {
+    if (index < 0) {
+      CORE_EXIT_CRITICAL();
+      return;
+    }
+    if (ble_rpa_cache_count < RADIOAES_BLE_RPA_CACHE_SIZE) {
+      ble_rpa_cache_count++;
+    } else {
+      i--;
+    }
+  }
+  if (index < 0) {
+    ble_rpa_cache_count--;
+    for (; i < ble_rpa_cache_count; i++) {
+      ble_rpa_cache[i] = ble_rpa_cache[i + 1];
+    }
+  } else {
+    for (; i > 0; i--) {
+      ble_rpa_cache[i] = ble_rpa_cache[i - 1];
+    }
+    ble_rpa_cache[0].keytable = keytable;
+    ble_rpa_cache[0].prand = prand;
+    ble_rpa_cache[0].hash = hash;
+    ble_rpa_cache[0].index = index;
+  }
+  CORE_EXIT_CRITICAL();
+}
+#endif // RADIOAES_BLE_RPA_CACHE_SIZE > 0
+
 //
 // Process a table of BLE RPA device keys and look for a
 // match against the supplied hash. Algorithm is AES-128.
+// The key mask is processed in batches of 32 keys, one word at a time, with
+// the key descriptor of the next key loaded while the previous one is
+// processed, across batch boundaries.
 //
-int sli_process_ble_rpa(const unsigned char keytable[],
-                        uint32_t            keymask,
-                        uint32_t            prand,
-                        uint32_t            hash)
+static int ble_rpa_process(const unsigned char keytable[],
+                           const uint32_t      keymask[],
+                           size_t              keymask_words,
+                           uint32_t            prand,
+                           uint32_t            hash)
 {
   int block;
   int previous_block = -1, result = -1;
+  size_t word;
   static const uint32_t  aes_rpa_config = AES_MODEID_ECB
                                           | AES_MODEID_NO_CX
                                           | AES_MODEID_AES128
@@ -797,9 +1089,13 @@ int sli_process_ble_rpa(const unsigned char keytable[],
   CORE_ENTER_CRITICAL();
 
   // Data output contains hash in the most significant word (WORD3).
-  // Descriptors for blocks that are not included in key mask will be skipped.
-  for (block = 0; block < RADIOAES_BLE_RPA_MAX_KEYS; block++) {
-    if ( keymask & (1U << block) ) {  // Skip masked keys
+  // Only the keys included in the key mask are processed.
+  for (word = 0; (word < keymask_words) && (result < 0); word++) {
+    uint32_t mask = keymask[word];
+    while (mask != 0U) {
+      block = (int)((word * 32U) + SL_CTZ(mask));
+      mask &= mask - 1U;
+
       // Handle pending interrupts while the peripheral is in 'preemptable' state
       CORE_YIELD_CRITICAL();
       // Write key address and start operation
@@ -848,7 +1144,7 @@ int sli_process_ble_rpa(const unsigned char keytable[],
     return result;
   }
 
-  if ((rpa_data_out[3] & 0xFFFFFF00) == __REV(hash) ) {
+  if ((previous_block >= 0) && ((rpa_data_out[3] & 0xFFFFFF00) == __REV(hash)) ) {
     return previous_block;
   }
 
@@ -856,6 +1152,87 @@ int sli_process_ble_rpa(const unsigned char keytable[],
   return -1;
 }
 
+int sli_process_ble_rpa_batch(const unsigned char keytable[],
+                              const uint32_t      keymask[],
+                              size_t              keymask_words,
+                              uint32_t            prand,
+                              uint32_t            hash)
+{
+  #if (RADIOAES_BLE_RPA_CACHE_SIZE > 0)
+  int index = ble_rpa_cache_lookup(keytable, prand, hash);
+
+  if (index >= 0) {
+    // Check the cached key again, as the key table may have changed since the
+    // address was resolved. This costs a single AES operation.
+    size_t word = (size_t)index / 32U;
+    uint32_t mask = 1UL << ((uint32_t)index % 32U);
+    if ((word < keymask_words)
+        && ((keymask[word] & mask) != 0U)
+        && (ble_rpa_process(&keytable[word * 32U * AES_128_KEY_BYTES], &mask, 1U, prand, hash) >= 0)) {
+      ble_rpa_cache_record_check(true);
+      return index;
+    }
+    ble_rpa_cache_record_check(false);
+  }
+
+  index = ble_rpa_process(keytable, keymask, keymask_words, prand, hash);
+  ble_rpa_cache_update(keytable, prand, hash, index);
+  return index;
+  #else
+  return ble_rpa_process(keytable, keymask, keymask_words, prand, hash);
+  #endif
+}
+
+int sli_process_ble_rpa(const unsigned char keytable[],
+                        uint32_t            keymask,
+                        uint32_t            prand,
+                        uint32_t            hash)
+{
+  #if (RADIOAES_BLE_RPA_MAX_KEYS < 32)
+  keymask &= (1UL << RADIOAES_BLE_RPA_MAX_KEYS) - 1U;
+  #endif
+  return sli_process_ble_rpa_batch(keytable, &keymask, 1U, prand, hash);
+}
+
+void sli_process_ble_rpa_get_cache_statistics(sli_ble_rpa_cache_statistics_t *statistics)
+{
+  #if (RADIOAES_BLE_RPA_CACHE_SIZE > 0)
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  *statistics = ble_rpa_cache_statistics;
+  CORE_EXIT_CRITICAL();
+  #else
+  statistics->hits = 0;
+  statistics->misses = 0;
+  statistics->stale_entries = 0;
+  #endif
+}
+
+void sli_process_ble_rpa_reset_cache_statistics(void)
+{
+  #if (RADIOAES_BLE_RPA_CACHE_SIZE > 0)
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  ble_rpa_cache_statistics.hits = 0;
+  ble_rpa_cache_statistics.misses = 0;
+  ble_rpa_cache_statistics.stale_entries = 0;
+  CORE_EXIT_CRITICAL();
+  #endif
+}
+
+void sli_process_ble_rpa_invalidate_cache(void)
+{
+  #if (RADIOAES_BLE_RPA_CACHE_SIZE > 0)
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  ble_rpa_cache_count = 0;
+  CORE_EXIT_CRITICAL();
+  #endif
+}
+
 void sli_aes_seed_mask(void)
 {
   // Acquiring and releasing the peripheral should ensure the mask is properly
@@ -185,6 +185,21 @@ sl_status_t sli_radioaes_release(void)
 #endif
 }
 
+bool sli_radioaes_is_busy(void)
+{
+  // The registers cannot be read while the peripheral is not clocked, in
+  // which case no operation can be in progress either.
+#if defined(_CMU_CLKEN0_MASK)
+  if ((CMU->CLKEN0 & CMU_CLKEN0_RADIOAES) == 0U) {
+    return false;
+  }
+#endif
+  if ((CMU->RADIOCLKCTRL & CMU_RADIOCLKCTRL_EN) == 0U) {
+    return false;
+  }
+  return (RADIOAES->STATUS & (AES_STATUS_FETCHERBSY | AES_STATUS_PUSHERBSY | AES_STATUS_SOFTRSTBSY)) != 0U;
+}
+
 sl_status_t sli_radioaes_save_state(sli_radioaes_state_t *ctx)
 {
   CORE_DECLARE_IRQ_STATE;
@@ -33,6 +33,7 @@
 /// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "sl_status.h"
 #include "sl_code_classification.h"
 
@@ -76,6 +77,14 @@ sl_status_t sli_radioaes_acquire(void);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
 sl_status_t sli_radioaes_release(void);
 
+/***************************************************************************//**
+ * @brief          Check whether RADIOAES is running an operation
+ *
+ * @return         true if an operation is in progress, false otherwise
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+bool sli_radioaes_is_busy(void);
+
 /***************************************************************************//**
  * @brief          Save RADIOAES register state to RAM
  *
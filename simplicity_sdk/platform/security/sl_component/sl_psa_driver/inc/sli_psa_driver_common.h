@@ -35,7 +35,9 @@
 
 #include "psa/crypto.h"
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 // -----------------------------------------------------------------------------
 // Static inline functions
@@ -173,24 +175,56 @@ psa_status_t sli_psa_validate_pkcs7_padding(uint8_t *padded_data,
                                             size_t padded_data_length,
                                             size_t *padding_bytes);
 
+// Software GHASH kernels, selected at build time with
+// SLI_PSA_SOFTWARE_GHASH_KERNEL.
+// 4-bit tables (256 bytes per key, default)
+#define SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE4         0
+// 8-bit tables (4 KiB per key, 512 bytes of constants), for parts where
+// throughput matters more than memory. The one-shot GCM paths with IV
+// calculation keep this context on the stack, so the calling thread needs
+// 4 KiB of extra stack space with this kernel.
+#define SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE8         1
+// Constant-time carry-less multiplication without key-dependent tables
+#define SLI_PSA_SOFTWARE_GHASH_KERNEL_CONSTANT_TIME  2
+// Constant-time carry-less multiplication with one reduction per 4 blocks
+#define SLI_PSA_SOFTWARE_GHASH_KERNEL_AGGREGATED     3
+
+#if !defined(SLI_PSA_SOFTWARE_GHASH_KERNEL)
+  #define SLI_PSA_SOFTWARE_GHASH_KERNEL SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE4
+#endif
+
+/// Precomputed values for the multiplication by 'H' in GHASH
+typedef struct {
+#if (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE4)
+  uint64_t HL[16];      ///< Lower multiplication table for 'H'
+  uint64_t HH[16];      ///< Upper multiplication table for 'H'
+#elif (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE8)
+  uint64_t HL[256];     ///< Lower multiplication table for 'H'
+  uint64_t HH[256];     ///< Upper multiplication table for 'H'
+#elif (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_CONSTANT_TIME)
+  uint64_t H[2];        ///< 'H', least significant half first
+#elif (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_AGGREGATED)
+  uint64_t H[4][2];     ///< 'H' to 'H^4', least significant half first
+#else
+  #error "Unknown SLI_PSA_SOFTWARE_GHASH_KERNEL"
+#endif
+} sli_psa_software_ghash_context_t;
+
 /**
- * \brief Initialize Galois field (2^128) multiplication table
+ * \brief Initialize Galois field (2^128) multiplication context
  *
  * This function is used as part of a software-based GHASH (as defined in
  * AES-GCM) algorithm, and originates from the mbed TLS implementation in gcm.c
  *
  * It takes the in the 'H' value for the GHASH operation (which is a block of
  * zeroes encrypted using AES-ECB with the key to be used for GHASH/GCM), and
- * converts it into a multiplication table for later use by the multiplication
- * function.
+ * converts it into the values used by the selected multiplication kernel.
  *
- * \param[in] Ek  'H' value for which to create the multiplication tables
- * \param[out] HL Lower multiplication table for 'H'
- * \param[out] HH Upper multiplication table for 'H'
+ * \param[out] ctx Multiplication context for 'H'
+ * \param[in]  Ek  'H' value for which to create the multiplication context
  */
-void sli_psa_software_ghash_setup(const uint8_t Ek[16],
-                                  uint64_t HL[16],
-                                  uint64_t HH[16]);
+void sli_psa_software_ghash_setup(sli_psa_software_ghash_context_t *ctx,
+                                  const uint8_t Ek[16]);
 
 /**
  * \brief Galois field (2^128) multiplication operation
@@ -200,20 +234,36 @@ void sli_psa_software_ghash_setup(const uint8_t Ek[16],
  *
  * This function takes in a 128-bit scalar and multiplies it with H (Galois
  * field multiplication as defined in AES-GCM). H is not provided to this
- * function directly. Instead, multiplication tables for the specific H need to
- * be calculated first by \ref sli_psa_software_ghash_setup, and passed to this
- * function.
+ * function directly. Instead, a multiplication context for the specific H
+ * needs to be calculated first by \ref sli_psa_software_ghash_setup, and
+ * passed to this function.
  *
- * \param[in]   HL      Lower multiplication table for 'H'
- * \param[in]   HH      Upper multiplication table for 'H'
+ * \param[in]   ctx     Multiplication context for 'H'
  * \param[out]  output  Output buffer for the multiplication result
  * \param[in]   input   Input buffer for the scalar to multiply
  */
-void sli_psa_software_ghash_multiply(const uint64_t HL[16],
-                                     const uint64_t HH[16],
+void sli_psa_software_ghash_multiply(const sli_psa_software_ghash_context_t *ctx,
                                      uint8_t output[16],
                                      const uint8_t input[16]);
 
+/**
+ * \brief Accumulate data into a GHASH state
+ *
+ * For each 16-byte block of data, the block is added to the state, and the
+ * state is multiplied with H. The last block is padded with zeroes if the
+ * data length is not a multiple of 16 bytes. The aggregated kernel processes
+ * 4 blocks per reduction here.
+ *
+ * \param[in]     ctx          Multiplication context for 'H'
+ * \param[in,out] state        GHASH state
+ * \param[in]     data         Data to accumulate
+ * \param[in]     data_length  Length of data in bytes
+ */
+void sli_psa_software_ghash_update(const sli_psa_software_ghash_context_t *ctx,
+                                   uint8_t state[16],
+                                   const uint8_t *data,
+                                   size_t data_length);
+
 #if defined(MBEDTLS_ENTROPY_HARDWARE_ALT) \
   && !defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
 
@@ -225,6 +275,63 @@ psa_status_t mbedtls_psa_external_get_random(void *context,
 
 #endif // MBEDTLS_ENTROPY_HARDWARE_ALT && MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG
 
+/// Counters of the TRNG reservoir, see sli_psa_trng_reservoir_refill().
+typedef struct {
+  uint32_t refills;             ///< Refills that filled the reservoir
+  uint32_t reservoir_bytes;     ///< Random bytes served from the reservoir
+  uint32_t hardware_bytes;      ///< Random bytes read synchronously from the TRNG
+  uint32_t low_water_events;    ///< Requests leaving the reservoir below the low-water mark
+  uint32_t repetition_failures; ///< Chunks dropped by the repetition count test
+  uint32_t proportion_failures; ///< Chunks dropped by the adaptive proportion test
+} sli_psa_trng_reservoir_statistics_t;
+
+/**
+ * \brief Refill the TRNG reservoir
+ *
+ * When SL_PSA_TRNG_RESERVOIR_SIZE is non-zero, random requests are first
+ * served from a RAM reservoir of bytes read ahead from the TRNG, and only the
+ * part the reservoir cannot cover waits on the TRNG. This function reads from
+ * the TRNG until the reservoir is full, running the SP 800-90B repetition
+ * count and adaptive proportion tests on the new bytes. Bytes failing a test
+ * are dropped.
+ *
+ * It must be called from thread context, typically from a low-priority task
+ * with an RTOS, or from the super-loop before sl_power_manager_sleep() on
+ * bare metal, when sli_psa_trng_reservoir_needs_refill() returns true. It
+ * cannot be called from sl_power_manager_is_ok_to_sleep(), which runs with
+ * interrupts disabled.
+ *
+ * \retval PSA_SUCCESS                     The reservoir is full.
+ * \retval PSA_ERROR_INSUFFICIENT_ENTROPY   A health test failed.
+ * \retval PSA_ERROR_NOT_SUPPORTED         The reservoir is disabled.
+ * \return Any error of the TRNG.
+ */
+psa_status_t sli_psa_trng_reservoir_refill(void);
+
+/**
+ * \brief Check whether the TRNG reservoir is below its low-water mark
+ *
+ * \return true if sli_psa_trng_reservoir_refill() should be called.
+ */
+bool sli_psa_trng_reservoir_needs_refill(void);
+
+/**
+ * \brief Get the number of random bytes in the TRNG reservoir
+ */
+size_t sli_psa_trng_reservoir_get_fill(void);
+
+/**
+ * \brief Wipe the content of the TRNG reservoir
+ */
+void sli_psa_trng_reservoir_flush(void);
+
+/**
+ * \brief Get the counters of the TRNG reservoir
+ *
+ * \param[out] statistics  Copy of the counters
+ */
+void sli_psa_trng_reservoir_get_statistics(sli_psa_trng_reservoir_statistics_t *statistics);
+
 /// @endcond
 
 #endif // SLI_PSA_DRIVER_COMMON_H
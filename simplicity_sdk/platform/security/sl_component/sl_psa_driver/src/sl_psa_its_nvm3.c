@@ -55,6 +55,7 @@
 #if defined(SLI_PSA_ITS_ENCRYPTED)
   #include "psa_crypto_core.h"
   #include "psa_crypto_driver_wrappers.h"
+  #include "mbedtls/platform_util.h"
   #if defined(SEMAILBOX_PRESENT)
     #include "psa/crypto_extra.h"
     #include "sl_psa_values.h"
@@ -166,6 +167,9 @@ void sli_its_release_mutex(void)
 
 #define SLI_PSA_ITS_CACHE_INIT_CHUNK_SIZE 16
 
+// UID tag of an object whose UID is not known yet
+#define SLI_PSA_ITS_UID_TAG_UNKNOWN (0)
+
 // Enable backwards-compatibility with keys stored with a v1 header unless disabled.
 #if !defined(SL_PSA_ITS_REMOVE_V1_HEADER_SUPPORT)
 #define SLI_PSA_ITS_SUPPORT_V1_FORMAT
@@ -205,6 +209,11 @@ static previous_lookup_t previous_lookup = {
   0, 0, false
 };
 
+// Index of the UID stored in each object of the ITS range, as a 16-bit hash
+// of the UID. Lookups only read the metadata of the objects whose tag matches
+// the UID searched for, or whose tag is not known yet.
+SLI_STATIC uint16_t nvm3_uid_tag_index[SL_PSA_ITS_MAX_FILES] = { 0 };
+
 #if defined(SLI_PSA_ITS_ENCRYPTED)
 // The root key is an AES-256 key, and is therefore 32 bytes.
 #define ROOT_KEY_SIZE     (32)
@@ -223,17 +232,29 @@ static root_key_t g_root_key = {
 };
 #endif // !defined(SEMAILBOX_PRESENT)
 
+// Number of derived session keys kept in RAM. Each entry is keyed by the UID
+// and the IV of the file it was derived for.
+#if !defined(SL_PSA_ITS_SESSION_KEY_CACHE_SIZE)
+#define SL_PSA_ITS_SESSION_KEY_CACHE_SIZE (4)
+#endif
+
+#if (SL_PSA_ITS_SESSION_KEY_CACHE_SIZE < 1) || (SL_PSA_ITS_SESSION_KEY_CACHE_SIZE > 255)
+#error "SL_PSA_ITS_SESSION_KEY_CACHE_SIZE must be between 1 and 255"
+#endif
+
 typedef struct {
   bool active;
   psa_storage_uid_t uid;
+  uint8_t iv[AES_IV_GCM_SIZE];
   uint8_t data[SESSION_KEY_SIZE];
 } session_key_t;
 
-static session_key_t g_cached_session_key = {
-  .active = false,
-  .uid = 0,
-  .data = { 0 },
-};
+// Cached session keys, ordered from the most to the least recently used.
+SLI_STATIC session_key_t g_cached_session_keys[SL_PSA_ITS_SESSION_KEY_CACHE_SIZE] = { 0 };
+
+// Session key cache statistics
+SLI_STATIC uint32_t g_session_key_cache_hits = 0;
+SLI_STATIC uint32_t g_session_key_cache_misses = 0;
 #endif // defined(SLI_PSA_ITS_ENCRYPTED)
 
 // -------------------------------------
@@ -341,6 +362,30 @@ static inline bool cache_lookup(nvm3_ObjectKey_t key)
   uint32_t offset = i - 32 * bin;
   return (bool)((nvm3_uid_set_cache[bin] >> offset) & 0x1);
 }
+
+static inline uint16_t uid_tag(psa_storage_uid_t uid)
+{
+  uint32_t hash = (uint32_t)(uid ^ (uid >> 32)) * 0x9E3779B1UL;
+  uint16_t tag = (uint16_t)(hash >> 16);
+  return (tag == SLI_PSA_ITS_UID_TAG_UNKNOWN) ? 1U : tag;
+}
+
+static inline void uid_index_set(nvm3_ObjectKey_t key, uint16_t tag)
+{
+  nvm3_uid_tag_index[key - SLI_PSA_ITS_NVM3_RANGE_START] = tag;
+}
+
+static inline bool uid_index_may_match(nvm3_ObjectKey_t key, uint16_t tag)
+{
+  uint16_t object_tag = nvm3_uid_tag_index[key - SLI_PSA_ITS_NVM3_RANGE_START];
+  return (object_tag == SLI_PSA_ITS_UID_TAG_UNKNOWN) || (object_tag == tag);
+}
+
+static Ecode_t get_file_metadata(nvm3_ObjectKey_t key,
+                                 sli_its_file_meta_v2_t* metadata,
+                                 size_t* its_file_offset,
+                                 size_t* its_file_size);
+
 #if defined(SLI_STATIC_TESTABLE)
 bool cache_initialized(void)
 {
@@ -372,6 +417,17 @@ static void init_cache(void)
 
     for (size_t i = 0; i < num_keys_referenced_by_nvm3; i++) {
       cache_set(keys_referenced_by_nvm3[i]);
+
+      // Index the UID of the object. Objects without a valid header are left
+      // with an unknown tag, and get handled on the first lookup.
+      sli_its_file_meta_v2_t key_meta;
+      Ecode_t status = get_file_metadata(keys_referenced_by_nvm3[i], &key_meta, NULL, NULL);
+      if (status == ECODE_NVM3_OK
+          || status == SLI_PSA_ITS_ECODE_NEEDS_UPGRADE) {
+        uid_index_set(keys_referenced_by_nvm3[i], uid_tag(key_meta.uid));
+      } else {
+        uid_index_set(keys_referenced_by_nvm3[i], SLI_PSA_ITS_UID_TAG_UNKNOWN);
+      }
     }
   }
 
@@ -477,16 +533,23 @@ static nvm3_ObjectKey_t get_nvm3_id(psa_storage_uid_t uid, bool find_empty_slot)
       }
     }
 
+    uint16_t tag = uid_tag(uid);
+
     for (size_t i = 0; i < SL_PSA_ITS_MAX_FILES; i++) {
       if (!cache_lookup(i + SLI_PSA_ITS_NVM3_RANGE_START)) {
         continue;
       }
       nvm3_ObjectKey_t object_id = i + SLI_PSA_ITS_NVM3_RANGE_START;
 
+      if (!uid_index_may_match(object_id, tag)) {
+        continue;
+      }
+
       status = get_file_metadata(object_id, &key_meta, NULL, NULL);
 
       if (status == ECODE_NVM3_OK
           || status == SLI_PSA_ITS_ECODE_NEEDS_UPGRADE) {
+        uid_index_set(object_id, uid_tag(key_meta.uid));
         if (key_meta.uid == uid) {
           previous_lookup.set = true;
           previous_lookup.object_id = object_id;
@@ -507,6 +570,8 @@ static nvm3_ObjectKey_t get_nvm3_id(psa_storage_uid_t uid, bool find_empty_slot)
         if (status != ECODE_NVM3_OK) {
           return SLI_PSA_ITS_NVM3_RANGE_END + 1U;
         }
+        cache_clear(object_id);
+        uid_index_set(object_id, SLI_PSA_ITS_UID_TAG_UNKNOWN);
       }
     }
   }
@@ -536,12 +601,112 @@ static nvm3_ObjectKey_t prepare_its_get_nvm3_id(psa_storage_uid_t uid)
 }
 
 #if defined(SLI_PSA_ITS_ENCRYPTED)
-static inline void cache_session_key(uint8_t *session_key, psa_storage_uid_t uid)
+/**
+ * \brief Move a session key cache entry to the most recently used position.
+ *
+ * \param[in] index  Index of the entry to promote.
+ *
+ * \return The promoted entry.
+ */
+static session_key_t *promote_session_key(size_t index)
 {
-  // Cache the session key
-  memcpy(g_cached_session_key.data, session_key, sizeof(g_cached_session_key.data));
-  g_cached_session_key.uid = uid;
-  g_cached_session_key.active = true;
+  session_key_t entry;
+
+  if (index == 0) {
+    return &g_cached_session_keys[0];
+  }
+
+  memcpy(&entry, &g_cached_session_keys[index], sizeof(entry));
+  memmove(&g_cached_session_keys[1],
+          &g_cached_session_keys[0],
+          index * sizeof(g_cached_session_keys[0]));
+  memcpy(&g_cached_session_keys[0], &entry, sizeof(entry));
+  mbedtls_platform_zeroize(&entry, sizeof(entry));
+
+  return &g_cached_session_keys[0];
+}
+
+/**
+ * \brief Store a derived session key in the cache. The least recently used
+ *        entry is zeroized and replaced when the cache is full.
+ *
+ * \param[in] session_key  Derived session key, SESSION_KEY_SIZE bytes.
+ * \param[in] uid          UID of the file the key was derived for.
+ * \param[in] iv           IV the key was derived from.
+ */
+static void cache_session_key(const uint8_t *session_key,
+                              psa_storage_uid_t uid,
+                              const uint8_t *iv)
+{
+  size_t index = SL_PSA_ITS_SESSION_KEY_CACHE_SIZE - 1;
+
+  // Reuse the slot of a previous key of the same file, since its IV is stale
+  for (size_t i = 0; i < SL_PSA_ITS_SESSION_KEY_CACHE_SIZE; i++) {
+    if (!g_cached_session_keys[i].active || g_cached_session_keys[i].uid == uid) {
+      index = i;
+      break;
+    }
+  }
+
+  session_key_t *entry = promote_session_key(index);
+  mbedtls_platform_zeroize(entry, sizeof(*entry));
+  memcpy(entry->data, session_key, sizeof(entry->data));
+  memcpy(entry->iv, iv, sizeof(entry->iv));
+  entry->uid = uid;
+  entry->active = true;
+}
+
+/**
+ * \brief Look up a session key in the cache.
+ *
+ * \param[in]  uid          UID of the file to decrypt.
+ * \param[in]  iv           IV stored in the file.
+ * \param[out] session_key  Buffer receiving the key, SESSION_KEY_SIZE bytes.
+ *
+ * \return true if the key was found, false otherwise.
+ */
+static bool lookup_session_key(psa_storage_uid_t uid,
+                               const uint8_t *iv,
+                               uint8_t *session_key)
+{
+  for (size_t i = 0; i < SL_PSA_ITS_SESSION_KEY_CACHE_SIZE; i++) {
+    if (!g_cached_session_keys[i].active) {
+      break;
+    }
+    if (g_cached_session_keys[i].uid == uid
+        && memcmp(g_cached_session_keys[i].iv, iv, sizeof(g_cached_session_keys[i].iv)) == 0) {
+      session_key_t *entry = promote_session_key(i);
+      memcpy(session_key, entry->data, sizeof(entry->data));
+      g_session_key_cache_hits++;
+      return true;
+    }
+  }
+
+  g_session_key_cache_misses++;
+  return false;
+}
+
+/**
+ * rief Zeroize and drop the cached session key of a file, if any.
+ *
+ * \param[in] uid  UID of the removed file.
+ */
+static void forget_session_key(psa_storage_uid_t uid)
+{
+  for (size_t i = 0; i < SL_PSA_ITS_SESSION_KEY_CACHE_SIZE; i++) {
+    if (!g_cached_session_keys[i].active) {
+      break;
+    }
+    if (g_cached_session_keys[i].uid == uid) {
+      // Keep the active entries contiguous, in most recently used order
+      memmove(&g_cached_session_keys[i],
+              &g_cached_session_keys[i + 1],
+              (SL_PSA_ITS_SESSION_KEY_CACHE_SIZE - 1 - i) * sizeof(g_cached_session_keys[0]));
+      mbedtls_platform_zeroize(&g_cached_session_keys[SL_PSA_ITS_SESSION_KEY_CACHE_SIZE - 1],
+                               sizeof(g_cached_session_keys[0]));
+      break;
+    }
+  }
 }
 
 /**
@@ -688,7 +853,7 @@ static psa_status_t encrypt_its_file(sli_its_file_meta_v2_t *metadata,
     return psa_status;
   }
 
-  cache_session_key(session_key, metadata->uid);
+  cache_session_key(session_key, metadata->uid, blob->iv);
 
   // Retrieve data to be encrypted
   if (plaintext_size != 0U) {
@@ -766,15 +931,12 @@ static psa_status_t decrypt_its_file(sli_its_file_meta_v2_t *metadata,
   psa_status_t psa_status = PSA_ERROR_CORRUPTION_DETECTED;
   uint8_t session_key[SESSION_KEY_SIZE];
 
-  if (g_cached_session_key.active && g_cached_session_key.uid == metadata->uid) {
-    // Use cached session key if it's already set and UID matches
-    memcpy(session_key, g_cached_session_key.data, sizeof(session_key));
-  } else {
+  if (!lookup_session_key(metadata->uid, blob->iv, session_key)) {
     psa_status = derive_session_key(blob->iv, AES_IV_GCM_SIZE, session_key, sizeof(session_key));
     if (psa_status != PSA_SUCCESS) {
       return psa_status;
     }
-    cache_session_key(session_key, metadata->uid);
+    cache_session_key(session_key, metadata->uid, blob->iv);
   }
 
   // Decrypt and authenticate blob
@@ -1062,6 +1224,7 @@ psa_status_t psa_its_set(psa_storage_uid_t uid,
     // Power-loss might occur, however upon boot, the look-up table will be
     // re-filled as long as the data has been successfully written to NVM3.
     cache_set(nvm3_object_id);
+    uid_index_set(nvm3_object_id, uid_tag(uid));
   } else {
     ret = PSA_ERROR_STORAGE_FAILURE;
   }
@@ -1403,6 +1566,10 @@ psa_status_t psa_its_remove(psa_storage_uid_t uid)
       previous_lookup.set = false;
     }
     cache_clear(nvm3_object_id);
+    uid_index_set(nvm3_object_id, SLI_PSA_ITS_UID_TAG_UNKNOWN);
+#if defined(SLI_PSA_ITS_ENCRYPTED)
+    forget_session_key(uid);
+#endif
 
     psa_status = PSA_SUCCESS;
   } else {
@@ -1560,12 +1727,13 @@ psa_status_t sli_psa_its_change_key_id(mbedtls_svc_key_id_t old_id,
                           its_file_buffer,
                           its_file_size);
   if (status == ECODE_NVM3_OK) {
-    // Update last lookup and report success
+    // Update last lookup and UID index, and report success
     if (previous_lookup.set) {
       if (previous_lookup.uid == old_uid) {
         previous_lookup.uid = new_uid;
       }
     }
+    uid_index_set(nvm3_object_id, uid_tag(new_uid));
     psa_status = PSA_SUCCESS;
   } else {
     psa_status = PSA_ERROR_STORAGE_FAILURE;
@@ -1593,6 +1761,38 @@ psa_status_t sli_psa_its_encrypted(void)
   #endif
 }
 
+#if defined(SLI_PSA_ITS_ENCRYPTED)
+/**
+ * \brief Get the session key cache statistics.
+ *
+ * \param[out] hits    Number of decryptions that reused a cached session key. Can be NULL.
+ * \param[out] misses  Number of decryptions that derived a session key. Can be NULL.
+ */
+void sli_psa_its_get_session_key_cache_statistics(uint32_t *hits, uint32_t *misses)
+{
+  sli_its_acquire_mutex();
+  if (hits != NULL) {
+    *hits = g_session_key_cache_hits;
+  }
+  if (misses != NULL) {
+    *misses = g_session_key_cache_misses;
+  }
+  sli_its_release_mutex();
+}
+
+/**
+ * \brief Zeroize all the cached session keys and reset the cache statistics.
+ */
+void sli_psa_its_clear_session_key_cache(void)
+{
+  sli_its_acquire_mutex();
+  mbedtls_platform_zeroize(g_cached_session_keys, sizeof(g_cached_session_keys));
+  g_session_key_cache_hits = 0;
+  g_session_key_cache_misses = 0;
+  sli_its_release_mutex();
+}
+#endif // defined(SLI_PSA_ITS_ENCRYPTED)
+
 #if defined(SLI_PSA_ITS_ENCRYPTED) && !defined(SEMAILBOX_PRESENT)
 /**
  * \brief Set the root key to be used when deriving session keys for ITS encryption.
@@ -1675,17 +1875,29 @@ static root_key_t g_root_key = {
 };
 #endif // !defined(SEMAILBOX_PRESENT)
 
+// Number of derived session keys kept in RAM. Each entry is keyed by the UID
+// and the IV of the file it was derived for.
+#if !defined(SL_PSA_ITS_SESSION_KEY_CACHE_SIZE)
+#define SL_PSA_ITS_SESSION_KEY_CACHE_SIZE (4)
+#endif
+
+#if (SL_PSA_ITS_SESSION_KEY_CACHE_SIZE < 1) || (SL_PSA_ITS_SESSION_KEY_CACHE_SIZE > 255)
+#error "SL_PSA_ITS_SESSION_KEY_CACHE_SIZE must be between 1 and 255"
+#endif
+
 typedef struct {
   bool active;
   psa_storage_uid_t uid;
+  uint8_t iv[AES_GCM_IV_SIZE];
   uint8_t data[SESSION_KEY_SIZE];
 } session_key_t;
 
-static session_key_t g_cached_session_key = {
-  .active = false,
-  .uid = 0,
-  .data = { 0 },
-};
+// Cached session keys, ordered from the most to the least recently used.
+SLI_STATIC session_key_t g_cached_session_keys[SL_PSA_ITS_SESSION_KEY_CACHE_SIZE] = { 0 };
+
+// Session key cache statistics
+SLI_STATIC uint32_t g_session_key_cache_hits = 0;
+SLI_STATIC uint32_t g_session_key_cache_misses = 0;
 #endif // defined(SLI_PSA_ITS_ENCRYPTED)
 
 // -------------------------------------
@@ -2511,12 +2723,112 @@ static psa_status_t find_nvm3_id(psa_storage_uid_t uid,
 }
 
 #if defined(SLI_PSA_ITS_ENCRYPTED)
-static inline void cache_session_key(uint8_t *session_key, psa_storage_uid_t uid)
+/**
+ * \brief Move a session key cache entry to the most recently used position.
+ *
+ * \param[in] index  Index of the entry to promote.
+ *
+ * \return The promoted entry.
+ */
+static session_key_t *promote_session_key(size_t index)
+{
+  session_key_t entry;
+
+  if (index == 0) {
+    return &g_cached_session_keys[0];
+  }
+
+  memcpy(&entry, &g_cached_session_keys[index], sizeof(entry));
+  memmove(&g_cached_session_keys[1],
+          &g_cached_session_keys[0],
+          index * sizeof(g_cached_session_keys[0]));
+  memcpy(&g_cached_session_keys[0], &entry, sizeof(entry));
+  mbedtls_platform_zeroize(&entry, sizeof(entry));
+
+  return &g_cached_session_keys[0];
+}
+
+/**
+ * \brief Store a derived session key in the cache. The least recently used
+ *        entry is zeroized and replaced when the cache is full.
+ *
+ * \param[in] session_key  Derived session key, SESSION_KEY_SIZE bytes.
+ * \param[in] uid          UID of the file the key was derived for.
+ * \param[in] iv           IV the key was derived from.
+ */
+static void cache_session_key(const uint8_t *session_key,
+                              psa_storage_uid_t uid,
+                              const uint8_t *iv)
 {
-  // Cache the session key
-  memcpy(g_cached_session_key.data, session_key, sizeof(g_cached_session_key.data));
-  g_cached_session_key.uid = uid;
-  g_cached_session_key.active = true;
+  size_t index = SL_PSA_ITS_SESSION_KEY_CACHE_SIZE - 1;
+
+  // Reuse the slot of a previous key of the same file, since its IV is stale
+  for (size_t i = 0; i < SL_PSA_ITS_SESSION_KEY_CACHE_SIZE; i++) {
+    if (!g_cached_session_keys[i].active || g_cached_session_keys[i].uid == uid) {
+      index = i;
+      break;
+    }
+  }
+
+  session_key_t *entry = promote_session_key(index);
+  mbedtls_platform_zeroize(entry, sizeof(*entry));
+  memcpy(entry->data, session_key, sizeof(entry->data));
+  memcpy(entry->iv, iv, sizeof(entry->iv));
+  entry->uid = uid;
+  entry->active = true;
+}
+
+/**
+ * \brief Look up a session key in the cache.
+ *
+ * \param[in]  uid          UID of the file to decrypt.
+ * \param[in]  iv           IV stored in the file.
+ * \param[out] session_key  Buffer receiving the key, SESSION_KEY_SIZE bytes.
+ *
+ * \return true if the key was found, false otherwise.
+ */
+static bool lookup_session_key(psa_storage_uid_t uid,
+                               const uint8_t *iv,
+                               uint8_t *session_key)
+{
+  for (size_t i = 0; i < SL_PSA_ITS_SESSION_KEY_CACHE_SIZE; i++) {
+    if (!g_cached_session_keys[i].active) {
+      break;
+    }
+    if (g_cached_session_keys[i].uid == uid
+        && memcmp(g_cached_session_keys[i].iv, iv, sizeof(g_cached_session_keys[i].iv)) == 0) {
+      session_key_t *entry = promote_session_key(i);
+      memcpy(session_key, entry->data, sizeof(entry->data));
+      g_session_key_cache_hits++;
+      return true;
+    }
+  }
+
+  g_session_key_cache_misses++;
+  return false;
+}
+
+/**
+ * rief Zeroize and drop the cached session key of a file, if any.
+ *
+ * \param[in] uid  UID of the removed file.
+ */
+static void forget_session_key(psa_storage_uid_t uid)
+{
+  for (size_t i = 0; i < SL_PSA_ITS_SESSION_KEY_CACHE_SIZE; i++) {
+    if (!g_cached_session_keys[i].active) {
+      break;
+    }
+    if (g_cached_session_keys[i].uid == uid) {
+      // Keep the active entries contiguous, in most recently used order
+      memmove(&g_cached_session_keys[i],
+              &g_cached_session_keys[i + 1],
+              (SL_PSA_ITS_SESSION_KEY_CACHE_SIZE - 1 - i) * sizeof(g_cached_session_keys[0]));
+      mbedtls_platform_zeroize(&g_cached_session_keys[SL_PSA_ITS_SESSION_KEY_CACHE_SIZE - 1],
+                               sizeof(g_cached_session_keys[0]));
+      break;
+    }
+  }
 }
 
 /**
@@ -2663,7 +2975,7 @@ psa_status_t sli_encrypt_its_file(sli_its_file_meta_v2_t *metadata,
     return psa_status;
   }
 
-  cache_session_key(session_key, metadata->uid);
+  cache_session_key(session_key, metadata->uid, blob->iv);
 
   // Retrieve data to be encrypted
   if (plaintext_size != 0U) {
@@ -2741,15 +3053,12 @@ static psa_status_t sli_decrypt_its_file(sli_its_file_meta_v2_t *metadata,
   psa_status_t psa_status = PSA_ERROR_CORRUPTION_DETECTED;
   uint8_t session_key[SESSION_KEY_SIZE];
 
-  if (g_cached_session_key.active && g_cached_session_key.uid == metadata->uid) {
-    // Use cached session key if it's already set and UID matches
-    memcpy(session_key, g_cached_session_key.data, sizeof(session_key));
-  } else {
+  if (!lookup_session_key(metadata->uid, blob->iv, session_key)) {
     psa_status = derive_session_key(blob->iv, AES_GCM_IV_SIZE, session_key, sizeof(session_key));
     if (psa_status != PSA_SUCCESS) {
       return psa_status;
     }
-    cache_session_key(session_key, metadata->uid);
+    cache_session_key(session_key, metadata->uid, blob->iv);
   }
 
   // Decrypt and authenticate blob
@@ -3257,6 +3566,9 @@ psa_status_t psa_its_remove(psa_storage_uid_t uid)
   if (status == ECODE_NVM3_OK) {
     // Power-loss might occur, however upon boot, the look-up table will be
     // re-filled as long as the data has been successfully written to NVM3.
+#if defined(SLI_PSA_ITS_ENCRYPTED)
+    forget_session_key(uid);
+#endif
     if ((NVM3_KEY_INVALID != clear_cache(nvm3_object_id))
         && (NVM3_KEY_INVALID != set_tomb(nvm3_object_id))) {
       psa_status = PSA_SUCCESS;
@@ -3355,6 +3667,38 @@ psa_status_t sli_psa_its_encrypted(void)
 #endif
 }
 
+#if defined(SLI_PSA_ITS_ENCRYPTED)
+/**
+ * \brief Get the session key cache statistics.
+ *
+ * \param[out] hits    Number of decryptions that reused a cached session key. Can be NULL.
+ * \param[out] misses  Number of decryptions that derived a session key. Can be NULL.
+ */
+void sli_psa_its_get_session_key_cache_statistics(uint32_t *hits, uint32_t *misses)
+{
+  sli_its_acquire_mutex();
+  if (hits != NULL) {
+    *hits = g_session_key_cache_hits;
+  }
+  if (misses != NULL) {
+    *misses = g_session_key_cache_misses;
+  }
+  sli_its_release_mutex();
+}
+
+/**
+ * \brief Zeroize all the cached session keys and reset the cache statistics.
+ */
+void sli_psa_its_clear_session_key_cache(void)
+{
+  sli_its_acquire_mutex();
+  mbedtls_platform_zeroize(g_cached_session_keys, sizeof(g_cached_session_keys));
+  g_session_key_cache_hits = 0;
+  g_session_key_cache_misses = 0;
+  sli_its_release_mutex();
+}
+#endif // defined(SLI_PSA_ITS_ENCRYPTED)
+
 #if defined(SLI_PSA_ITS_ENCRYPTED) && !defined(SEMAILBOX_PRESENT)
 /**
  * \brief Set the root key to be used when deriving session keys for ITS encryption.
@@ -62,6 +62,8 @@
 // -----------------------------------------------------------------------------
 // Static constants
 
+#if (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE4)
+
 static const uint64_t last4[16] =
 {
   0x0000, 0x1c20, 0x3840, 0x2460,
@@ -70,12 +72,63 @@ static const uint64_t last4[16] =
   0x9180, 0x8da0, 0xa9c0, 0xb5e0
 };
 
+#elif (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE8)
+
+static const uint16_t last8[256] =
+{
+  0x0000, 0x01c2, 0x0384, 0x0246, 0x0708, 0x06ca, 0x048c, 0x054e,
+  0x0e10, 0x0fd2, 0x0d94, 0x0c56, 0x0918, 0x08da, 0x0a9c, 0x0b5e,
+  0x1c20, 0x1de2, 0x1fa4, 0x1e66, 0x1b28, 0x1aea, 0x18ac, 0x196e,
+  0x1230, 0x13f2, 0x11b4, 0x1076, 0x1538, 0x14fa, 0x16bc, 0x177e,
+  0x3840, 0x3982, 0x3bc4, 0x3a06, 0x3f48, 0x3e8a, 0x3ccc, 0x3d0e,
+  0x3650, 0x3792, 0x35d4, 0x3416, 0x3158, 0x309a, 0x32dc, 0x331e,
+  0x2460, 0x25a2, 0x27e4, 0x2626, 0x2368, 0x22aa, 0x20ec, 0x212e,
+  0x2a70, 0x2bb2, 0x29f4, 0x2836, 0x2d78, 0x2cba, 0x2efc, 0x2f3e,
+  0x7080, 0x7142, 0x7304, 0x72c6, 0x7788, 0x764a, 0x740c, 0x75ce,
+  0x7e90, 0x7f52, 0x7d14, 0x7cd6, 0x7998, 0x785a, 0x7a1c, 0x7bde,
+  0x6ca0, 0x6d62, 0x6f24, 0x6ee6, 0x6ba8, 0x6a6a, 0x682c, 0x69ee,
+  0x62b0, 0x6372, 0x6134, 0x60f6, 0x65b8, 0x647a, 0x663c, 0x67fe,
+  0x48c0, 0x4902, 0x4b44, 0x4a86, 0x4fc8, 0x4e0a, 0x4c4c, 0x4d8e,
+  0x46d0, 0x4712, 0x4554, 0x4496, 0x41d8, 0x401a, 0x425c, 0x439e,
+  0x54e0, 0x5522, 0x5764, 0x56a6, 0x53e8, 0x522a, 0x506c, 0x51ae,
+  0x5af0, 0x5b32, 0x5974, 0x58b6, 0x5df8, 0x5c3a, 0x5e7c, 0x5fbe,
+  0xe100, 0xe0c2, 0xe284, 0xe346, 0xe608, 0xe7ca, 0xe58c, 0xe44e,
+  0xef10, 0xeed2, 0xec94, 0xed56, 0xe818, 0xe9da, 0xeb9c, 0xea5e,
+  0xfd20, 0xfce2, 0xfea4, 0xff66, 0xfa28, 0xfbea, 0xf9ac, 0xf86e,
+  0xf330, 0xf2f2, 0xf0b4, 0xf176, 0xf438, 0xf5fa, 0xf7bc, 0xf67e,
+  0xd940, 0xd882, 0xdac4, 0xdb06, 0xde48, 0xdf8a, 0xddcc, 0xdc0e,
+  0xd750, 0xd692, 0xd4d4, 0xd516, 0xd058, 0xd19a, 0xd3dc, 0xd21e,
+  0xc560, 0xc4a2, 0xc6e4, 0xc726, 0xc268, 0xc3aa, 0xc1ec, 0xc02e,
+  0xcb70, 0xcab2, 0xc8f4, 0xc936, 0xcc78, 0xcdba, 0xcffc, 0xce3e,
+  0x9180, 0x9042, 0x9204, 0x93c6, 0x9688, 0x974a, 0x950c, 0x94ce,
+  0x9f90, 0x9e52, 0x9c14, 0x9dd6, 0x9898, 0x995a, 0x9b1c, 0x9ade,
+  0x8da0, 0x8c62, 0x8e24, 0x8fe6, 0x8aa8, 0x8b6a, 0x892c, 0x88ee,
+  0x83b0, 0x8272, 0x8034, 0x81f6, 0x84b8, 0x857a, 0x873c, 0x86fe,
+  0xa9c0, 0xa802, 0xaa44, 0xab86, 0xaec8, 0xaf0a, 0xad4c, 0xac8e,
+  0xa7d0, 0xa612, 0xa454, 0xa596, 0xa0d8, 0xa11a, 0xa35c, 0xa29e,
+  0xb5e0, 0xb422, 0xb664, 0xb7a6, 0xb2e8, 0xb32a, 0xb16c, 0xb0ae,
+  0xbbf0, 0xba32, 0xb874, 0xb9b6, 0xbcf8, 0xbd3a, 0xbf7c, 0xbebe
+};
+
+#endif
+
 // -----------------------------------------------------------------------------
-// Global functions
+// Static functions
+
+#if (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE4) \
+  || (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE8)
 
-void sli_psa_software_ghash_setup(const uint8_t Ek[16],
-                                  uint64_t HL[16],
-                                  uint64_t HH[16])
+// Number of bits of the input processed per table lookup
+#if (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE4)
+#define GHASH_TABLE_BITS 4
+#else
+#define GHASH_TABLE_BITS 8
+#endif
+#define GHASH_TABLE_SIZE (1 << GHASH_TABLE_BITS)
+
+static void ghash_table_setup(const uint8_t Ek[16],
+                              uint64_t HL[GHASH_TABLE_SIZE],
+                              uint64_t HH[GHASH_TABLE_SIZE])
 {
   int i, j;
   uint64_t hi, lo;
@@ -90,15 +143,15 @@ void sli_psa_software_ghash_setup(const uint8_t Ek[16],
   GET_UINT32_BE(lo, Ek, 12);
   vl = (uint64_t) hi << 32 | lo;
 
-  /* 8 = 1000 corresponds to 1 in GF(2^128) */
-  HL[8] = vl;
-  HH[8] = vh;
+  /* the most significant index bit corresponds to 1 in GF(2^128) */
+  HL[GHASH_TABLE_SIZE / 2] = vl;
+  HH[GHASH_TABLE_SIZE / 2] = vh;
 
   /* 0 corresponds to 0 in GF(2^128) */
   HH[0] = 0;
   HL[0] = 0;
 
-  for ( i = 4; i > 0; i >>= 1 ) {
+  for ( i = GHASH_TABLE_SIZE / 4; i > 0; i >>= 1 ) {
     uint32_t T = (vl & 1) * 0xe1000000U;
     vl  = (vh << 63) | (vl >> 1);
     vh  = (vh >> 1) ^ ( (uint64_t) T << 32);
@@ -107,7 +160,7 @@ void sli_psa_software_ghash_setup(const uint8_t Ek[16],
     HH[i] = vh;
   }
 
-  for ( i = 2; i <= 8; i *= 2 ) {
+  for ( i = 2; i <= GHASH_TABLE_SIZE / 2; i *= 2 ) {
     uint64_t *HiL = HL + i, *HiH = HH + i;
     vh = *HiH;
     vl = *HiL;
@@ -118,10 +171,12 @@ void sli_psa_software_ghash_setup(const uint8_t Ek[16],
   }
 }
 
-void sli_psa_software_ghash_multiply(const uint64_t HL[16],
-                                     const uint64_t HH[16],
-                                     uint8_t output[16],
-                                     const uint8_t input[16])
+#if (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE4)
+
+static void ghash_table_multiply(const uint64_t HL[16],
+                                 const uint64_t HH[16],
+                                 uint8_t output[16],
+                                 const uint8_t input[16])
 {
   int i = 0;
   unsigned char lo, hi, rem;
@@ -159,4 +214,250 @@ void sli_psa_software_ghash_multiply(const uint64_t HL[16],
   PUT_UINT32_BE(zl, output, 12);
 }
 
+#else // SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE8
+
+static void ghash_table_multiply(const uint64_t HL[256],
+                                 const uint64_t HH[256],
+                                 uint8_t output[16],
+                                 const uint8_t input[16])
+{
+  int i = 0;
+  unsigned char rem;
+  uint64_t zh, zl;
+
+  zh = HH[input[15]];
+  zl = HL[input[15]];
+
+  for ( i = 14; i >= 0; i-- ) {
+    rem = (unsigned char) zl;
+    zl = (zh << 56) | (zl >> 8);
+    zh = (zh >> 8);
+    zh ^= (uint64_t) last8[rem] << 48;
+    zh ^= HH[input[i]];
+    zl ^= HL[input[i]];
+  }
+
+  PUT_UINT32_BE(zh >> 32, output, 0);
+  PUT_UINT32_BE(zh, output, 4);
+  PUT_UINT32_BE(zl >> 32, output, 8);
+  PUT_UINT32_BE(zl, output, 12);
+}
+
+#endif
+
+#else // SLI_PSA_SOFTWARE_GHASH_KERNEL_CONSTANT_TIME || SLI_PSA_SOFTWARE_GHASH_KERNEL_AGGREGATED
+
+// Carry-less multiplication of two 64-bit values, keeping the low 64 bits of
+// the result. Integer multiplications are done on operands with 3-bit holes
+// between the data bits, so that carries never reach the next data bit. This
+// runs in constant time on cores with a constant-time multiplier.
+static uint64_t ghash_bmul64(uint64_t x, uint64_t y)
+{
+  uint64_t x0, x1, x2, x3;
+  uint64_t y0, y1, y2, y3;
+  uint64_t z0, z1, z2, z3;
+
+  x0 = x & 0x1111111111111111ULL;
+  x1 = x & 0x2222222222222222ULL;
+  x2 = x & 0x4444444444444444ULL;
+  x3 = x & 0x8888888888888888ULL;
+  y0 = y & 0x1111111111111111ULL;
+  y1 = y & 0x2222222222222222ULL;
+  y2 = y & 0x4444444444444444ULL;
+  y3 = y & 0x8888888888888888ULL;
+  z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+  z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+  z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+  z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+  z0 &= 0x1111111111111111ULL;
+  z1 &= 0x2222222222222222ULL;
+  z2 &= 0x4444444444444444ULL;
+  z3 &= 0x8888888888888888ULL;
+
+  return z0 | z1 | z2 | z3;
+}
+
+// Reverse the bit order of a 64-bit value.
+static uint64_t ghash_rev64(uint64_t x)
+{
+  x = ((x & 0x5555555555555555ULL) << 1) | ((x >> 1) & 0x5555555555555555ULL);
+  x = ((x & 0x3333333333333333ULL) << 2) | ((x >> 2) & 0x3333333333333333ULL);
+  x = ((x & 0x0F0F0F0F0F0F0F0FULL) << 4) | ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL);
+  x = ((x & 0x00FF00FF00FF00FFULL) << 8) | ((x >> 8) & 0x00FF00FF00FF00FFULL);
+  x = ((x & 0x0000FFFF0000FFFFULL) << 16) | ((x >> 16) & 0x0000FFFF0000FFFFULL);
+  return (x << 32) | (x >> 32);
+}
+
+static uint64_t ghash_load64(const uint8_t *b)
+{
+  uint32_t hi, lo;
+
+  GET_UINT32_BE(hi, b, 0);
+  GET_UINT32_BE(lo, b, 4);
+  return (uint64_t) hi << 32 | lo;
+}
+
+static void ghash_store64(uint8_t *b, uint64_t v)
+{
+  PUT_UINT32_BE(v >> 32, b, 0);
+  PUT_UINT32_BE(v, b, 4);
+}
+
+// Unreduced product of y and h, as 256 bits in v[0] (least significant) to
+// v[3], using Karatsuba. Values are in the GCM bit order, y[1] and h[1] being
+// the first 8 bytes of the blocks.
+static void ghash_mul_unreduced(uint64_t v[4], const uint64_t y[2], const uint64_t h[2])
+{
+  uint64_t y0r, y1r, y2, y2r, h0r, h1r, h2, h2r;
+  uint64_t z0, z1, z2, z0h, z1h, z2h;
+
+  y0r = ghash_rev64(y[0]);
+  y1r = ghash_rev64(y[1]);
+  y2 = y[0] ^ y[1];
+  y2r = y0r ^ y1r;
+  h0r = ghash_rev64(h[0]);
+  h1r = ghash_rev64(h[1]);
+  h2 = h[0] ^ h[1];
+  h2r = h0r ^ h1r;
+
+  z0 = ghash_bmul64(y[0], h[0]);
+  z1 = ghash_bmul64(y[1], h[1]);
+  z2 = ghash_bmul64(y2, h2);
+  z0h = ghash_bmul64(y0r, h0r);
+  z1h = ghash_bmul64(y1r, h1r);
+  z2h = ghash_bmul64(y2r, h2r);
+  z2 ^= z0 ^ z1;
+  z2h ^= z0h ^ z1h;
+  z0h = ghash_rev64(z0h) >> 1;
+  z1h = ghash_rev64(z1h) >> 1;
+  z2h = ghash_rev64(z2h) >> 1;
+
+  v[0] = z0;
+  v[1] = z0h ^ z2;
+  v[2] = z1 ^ z2h;
+  v[3] = z1h;
+}
+
+// Reduce a 256-bit unreduced product modulo the GCM polynomial into y.
+static void ghash_reduce(uint64_t y[2], const uint64_t v[4])
+{
+  uint64_t v0, v1, v2, v3;
+
+  // The bit-reversed product is one bit short: shift it left.
+  v3 = (v[3] << 1) | (v[2] >> 63);
+  v2 = (v[2] << 1) | (v[1] >> 63);
+  v1 = (v[1] << 1) | (v[0] >> 63);
+  v0 = (v[0] << 1);
+
+  v2 ^= v0 ^ (v0 >> 1) ^ (v0 >> 2) ^ (v0 >> 7);
+  v1 ^= (v0 << 63) ^ (v0 << 62) ^ (v0 << 57);
+  v3 ^= v1 ^ (v1 >> 1) ^ (v1 >> 2) ^ (v1 >> 7);
+  v2 ^= (v1 << 63) ^ (v1 << 62) ^ (v1 << 57);
+
+  y[0] = v2;
+  y[1] = v3;
+}
+
+static void ghash_mul(uint64_t y[2], const uint64_t h[2])
+{
+  uint64_t v[4];
+
+  ghash_mul_unreduced(v, y, h);
+  ghash_reduce(y, v);
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// Global functions
+
+void sli_psa_software_ghash_setup(sli_psa_software_ghash_context_t *ctx,
+                                  const uint8_t Ek[16])
+{
+#if (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE4) \
+  || (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE8)
+  ghash_table_setup(Ek, ctx->HL, ctx->HH);
+#elif (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_CONSTANT_TIME)
+  ctx->H[1] = ghash_load64(Ek);
+  ctx->H[0] = ghash_load64(Ek + 8);
+#else // SLI_PSA_SOFTWARE_GHASH_KERNEL_AGGREGATED
+  // H[i] holds H^(i + 1)
+  ctx->H[0][1] = ghash_load64(Ek);
+  ctx->H[0][0] = ghash_load64(Ek + 8);
+  for (size_t i = 1; i < 4; i++) {
+    ctx->H[i][0] = ctx->H[i - 1][0];
+    ctx->H[i][1] = ctx->H[i - 1][1];
+    ghash_mul(ctx->H[i], ctx->H[0]);
+  }
+#endif
+}
+
+void sli_psa_software_ghash_multiply(const sli_psa_software_ghash_context_t *ctx,
+                                     uint8_t output[16],
+                                     const uint8_t input[16])
+{
+#if (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE4) \
+  || (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_TABLE8)
+  ghash_table_multiply(ctx->HL, ctx->HH, output, input);
+#else
+  uint64_t y[2];
+
+  y[1] = ghash_load64(input);
+  y[0] = ghash_load64(input + 8);
+  #if (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_CONSTANT_TIME)
+  ghash_mul(y, ctx->H);
+  #else
+  ghash_mul(y, ctx->H[0]);
+  #endif
+  ghash_store64(output, y[1]);
+  ghash_store64(output + 8, y[0]);
+#endif
+}
+
+void sli_psa_software_ghash_update(const sli_psa_software_ghash_context_t *ctx,
+                                   uint8_t state[16],
+                                   const uint8_t *data,
+                                   size_t data_length)
+{
+  size_t i = 0;
+
+#if (SLI_PSA_SOFTWARE_GHASH_KERNEL == SLI_PSA_SOFTWARE_GHASH_KERNEL_AGGREGATED)
+  if (data_length >= 64) {
+    uint64_t y[2], x[2], v[4], t[4];
+
+    y[1] = ghash_load64(state);
+    y[0] = ghash_load64(state + 8);
+
+    // Process 4 blocks per reduction:
+    // Y' = (Y + X1) * H^4 + X2 * H^3 + X3 * H^2 + X4 * H
+    for (; data_length - i >= 64; i += 64) {
+      x[1] = y[1] ^ ghash_load64(&data[i]);
+      x[0] = y[0] ^ ghash_load64(&data[i + 8]);
+      ghash_mul_unreduced(v, x, ctx->H[3]);
+      for (size_t j = 1; j < 4; j++) {
+        x[1] = ghash_load64(&data[i + (16 * j)]);
+        x[0] = ghash_load64(&data[i + (16 * j) + 8]);
+        ghash_mul_unreduced(t, x, ctx->H[3 - j]);
+        v[0] ^= t[0];
+        v[1] ^= t[1];
+        v[2] ^= t[2];
+        v[3] ^= t[3];
+      }
+      ghash_reduce(y, v);
+    }
+
+    ghash_store64(state, y[1]);
+    ghash_store64(state + 8, y[0]);
+  }
+#endif
+
+  // The last block is padded with zeroes.
+  for (; i < data_length; i += 16) {
+    for (size_t j = 0; j < (data_length - i > 16 ? 16 : data_length - i); j++) {
+      state[j] ^= data[i + j];
+    }
+    sli_psa_software_ghash_multiply(ctx, state, state);
+  }
+}
+
 #endif // SLI_PSA_DRIVER_FEATURE_GCM_IV_CALCULATION
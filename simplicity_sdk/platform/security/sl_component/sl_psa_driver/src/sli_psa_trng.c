@@ -45,6 +45,57 @@
   #include "sl_si91x_psa_trng.h"
 #endif
 
+#include "sli_psa_driver_common.h"
+
+// -----------------------------------------------------------------------------
+// Configuration
+
+// Size in bytes of the reservoir of random bytes read ahead from the TRNG.
+// 0 disables the reservoir.
+#if !defined(SL_PSA_TRNG_RESERVOIR_SIZE)
+#define SL_PSA_TRNG_RESERVOIR_SIZE (0)
+#endif
+
+// Fill level in bytes below which the reservoir asks to be refilled.
+#if !defined(SL_PSA_TRNG_RESERVOIR_LOW_WATER_MARK)
+#define SL_PSA_TRNG_RESERVOIR_LOW_WATER_MARK (SL_PSA_TRNG_RESERVOIR_SIZE / 2)
+#endif
+
+#if (SL_PSA_TRNG_RESERVOIR_SIZE < 0) || (SL_PSA_TRNG_RESERVOIR_SIZE > 4096)
+#error "SL_PSA_TRNG_RESERVOIR_SIZE must be between 0 and 4096"
+#endif
+
+#if (SL_PSA_TRNG_RESERVOIR_LOW_WATER_MARK > SL_PSA_TRNG_RESERVOIR_SIZE)
+#error "SL_PSA_TRNG_RESERVOIR_LOW_WATER_MARK must not exceed SL_PSA_TRNG_RESERVOIR_SIZE"
+#endif
+
+// The reservoir is only available for the Series-2 TRNGs, whose drivers can
+// run from any thread.
+#if (SL_PSA_TRNG_RESERVOIR_SIZE > 0) \
+  && defined(SLI_PSA_DRIVER_FEATURE_TRNG) \
+  && (defined(SLI_MBEDTLS_DEVICE_HSE) || defined(SLI_MBEDTLS_DEVICE_VSE))
+  #define SLI_PSA_TRNG_RESERVOIR
+  #include "sl_core.h"
+  #include "mbedtls/platform_util.h"
+#endif
+
+#include <string.h>
+
+#if defined(SLI_PSA_TRNG_RESERVOIR)
+// Bytes read from the TRNG per step of a refill, bounding the stack usage
+// and the time spent with interrupts disabled.
+#define RESERVOIR_REFILL_CHUNK_SIZE       (64)
+
+// Continuous health tests of SP 800-90B section 4.4, applied to the bytes
+// read into the reservoir, assuming full entropy (8 bits per byte).
+// Repetition count test cutoff for a false positive rate of 2^-30.
+#define RESERVOIR_REPETITION_COUNT_CUTOFF (5)
+// Adaptive proportion test window and cutoff for a false positive rate of
+// 2^-30.
+#define RESERVOIR_PROPORTION_WINDOW       (512)
+#define RESERVOIR_PROPORTION_CUTOFF       (13)
+#endif
+
 // -----------------------------------------------------------------------------
 // Typedefs
 
@@ -90,17 +141,87 @@ static psa_status_t se_get_random(unsigned char *output,
 
 #endif // SLI_MBEDTLS_DEVICE_HSE
 
-// -----------------------------------------------------------------------------
-// Global entry points
+#if defined(SLI_PSA_TRNG_RESERVOIR)
 
-psa_status_t mbedtls_psa_external_get_random(
-  mbedtls_psa_external_random_context_t *context,
-  uint8_t *output,
-  size_t output_size,
-  size_t *output_length)
+static uint8_t reservoir[SL_PSA_TRNG_RESERVOIR_SIZE];
+// Number of unused bytes, stored at the start of the reservoir.
+static size_t reservoir_fill = 0;
+static sli_psa_trng_reservoir_statistics_t reservoir_statistics = { 0 };
+
+// Health test state, carried over from one refill to the next.
+static uint8_t repetition_value = 0;
+static size_t repetition_count = 0;
+static uint8_t proportion_value = 0;
+static size_t proportion_count = 0;
+static size_t proportion_index = RESERVOIR_PROPORTION_WINDOW;
+
+// Run the repetition count and adaptive proportion tests over new bytes.
+static psa_status_t reservoir_health_test(const uint8_t *data, size_t length)
 {
-  (void)context;
+  for (size_t i = 0; i < length; i++) {
+    if (repetition_count > 0 && data[i] == repetition_value) {
+      repetition_count++;
+      if (repetition_count >= RESERVOIR_REPETITION_COUNT_CUTOFF) {
+        repetition_count = 0;
+        reservoir_statistics.repetition_failures++;
+        return PSA_ERROR_INSUFFICIENT_ENTROPY;
+      }
+    } else {
+      repetition_value = data[i];
+      repetition_count = 1;
+    }
+
+    if (proportion_index >= RESERVOIR_PROPORTION_WINDOW) {
+      // Start a new window with this byte as the reference value
+      proportion_value = data[i];
+      proportion_count = 1;
+      proportion_index = 1;
+    } else {
+      if (data[i] == proportion_value) {
+        proportion_count++;
+        if (proportion_count >= RESERVOIR_PROPORTION_CUTOFF) {
+          proportion_index = RESERVOIR_PROPORTION_WINDOW;
+          reservoir_statistics.proportion_failures++;
+          return PSA_ERROR_INSUFFICIENT_ENTROPY;
+        }
+      }
+      proportion_index++;
+    }
+  }
 
+  return PSA_SUCCESS;
+}
+
+// Serve up to output_size bytes from the reservoir. Returns the number of
+// bytes served.
+static size_t reservoir_take(uint8_t *output, size_t output_size)
+{
+  size_t length;
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  length = (output_size < reservoir_fill) ? output_size : reservoir_fill;
+  reservoir_fill -= length;
+  // Bytes are served from the end of the used part, and wiped so that they
+  // can never be served twice.
+  memcpy(output, &reservoir[reservoir_fill], length);
+  mbedtls_platform_zeroize(&reservoir[reservoir_fill], length);
+  reservoir_statistics.reservoir_bytes += length;
+  if (length > 0 && reservoir_fill < SL_PSA_TRNG_RESERVOIR_LOW_WATER_MARK) {
+    reservoir_statistics.low_water_events++;
+  }
+  CORE_EXIT_ATOMIC();
+
+  return length;
+}
+
+#endif // SLI_PSA_TRNG_RESERVOIR
+
+// Read random bytes from the TRNG.
+static psa_status_t trng_get_random(uint8_t *output,
+                                    size_t output_size,
+                                    size_t *output_length)
+{
   #if defined(SLI_PSA_DRIVER_FEATURE_TRNG)
 
   psa_status_t entropy_status = PSA_ERROR_CORRUPTION_DETECTED;
@@ -157,4 +278,140 @@ psa_status_t mbedtls_psa_external_get_random(
   #endif // SLI_PSA_DRIVER_FEATURE_TRNG
 }
 
+// -----------------------------------------------------------------------------
+// Global entry points
+
+psa_status_t mbedtls_psa_external_get_random(
+  mbedtls_psa_external_random_context_t *context,
+  uint8_t *output,
+  size_t output_size,
+  size_t *output_length)
+{
+  (void)context;
+
+  #if defined(SLI_PSA_TRNG_RESERVOIR)
+  size_t served = reservoir_take(output, output_size);
+  if (served == output_size) {
+    *output_length = output_size;
+    return PSA_SUCCESS;
+  }
+
+  // Read the rest synchronously from the TRNG
+  size_t length = 0;
+  psa_status_t status = trng_get_random(&output[served],
+                                        output_size - served,
+                                        &length);
+  if (status != PSA_SUCCESS) {
+    mbedtls_platform_zeroize(output, served);
+    *output_length = 0;
+    return status;
+  }
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  reservoir_statistics.hardware_bytes += length;
+  CORE_EXIT_ATOMIC();
+
+  *output_length = served + length;
+  return PSA_SUCCESS;
+  #else
+  return trng_get_random(output, output_size, output_length);
+  #endif
+}
+
+psa_status_t sli_psa_trng_reservoir_refill(void)
+{
+  #if defined(SLI_PSA_TRNG_RESERVOIR)
+  uint8_t chunk[RESERVOIR_REFILL_CHUNK_SIZE];
+  psa_status_t status = PSA_SUCCESS;
+
+  while (status == PSA_SUCCESS) {
+    size_t space;
+    size_t length = 0;
+
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    space = SL_PSA_TRNG_RESERVOIR_SIZE - reservoir_fill;
+    CORE_EXIT_ATOMIC();
+
+    if (space == 0) {
+      CORE_ENTER_ATOMIC();
+      reservoir_statistics.refills++;
+      CORE_EXIT_ATOMIC();
+      break;
+    }
+    if (space > sizeof(chunk)) {
+      space = sizeof(chunk);
+    }
+
+    status = trng_get_random(chunk, space, &length);
+    if (status != PSA_SUCCESS) {
+      break;
+    }
+
+    // Bytes failing the health tests are dropped. The failure is reported,
+    // the reservoir keeps what it already holds.
+    CORE_ENTER_ATOMIC();
+    status = reservoir_health_test(chunk, length);
+    if (status == PSA_SUCCESS) {
+      // Random requests may have consumed bytes in the meantime, never
+      // overwrite unused ones.
+      if (length > SL_PSA_TRNG_RESERVOIR_SIZE - reservoir_fill) {
+        length = SL_PSA_TRNG_RESERVOIR_SIZE - reservoir_fill;
+      }
+      memcpy(&reservoir[reservoir_fill], chunk, length);
+      reservoir_fill += length;
+    }
+    CORE_EXIT_ATOMIC();
+  }
+
+  mbedtls_platform_zeroize(chunk, sizeof(chunk));
+  return status;
+  #else
+  return PSA_ERROR_NOT_SUPPORTED;
+  #endif
+}
+
+bool sli_psa_trng_reservoir_needs_refill(void)
+{
+  #if defined(SLI_PSA_TRNG_RESERVOIR)
+  // A single word read, no need for a critical section
+  return reservoir_fill < SL_PSA_TRNG_RESERVOIR_LOW_WATER_MARK;
+  #else
+  return false;
+  #endif
+}
+
+size_t sli_psa_trng_reservoir_get_fill(void)
+{
+  #if defined(SLI_PSA_TRNG_RESERVOIR)
+  return reservoir_fill;
+  #else
+  return 0;
+  #endif
+}
+
+void sli_psa_trng_reservoir_flush(void)
+{
+  #if defined(SLI_PSA_TRNG_RESERVOIR)
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  mbedtls_platform_zeroize(reservoir, sizeof(reservoir));
+  reservoir_fill = 0;
+  CORE_EXIT_ATOMIC();
+  #endif
+}
+
+void sli_psa_trng_reservoir_get_statistics(sli_psa_trng_reservoir_statistics_t *statistics)
+{
+  #if defined(SLI_PSA_TRNG_RESERVOIR)
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  *statistics = reservoir_statistics;
+  CORE_EXIT_ATOMIC();
+  #else
+  memset(statistics, 0, sizeof(*statistics));
+  #endif
+}
+
 #endif // MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG || MBEDTLS_ENTROPY_HARDWARE_ALT
@@ -35,6 +35,7 @@
 #include "psa/crypto.h"
 
 #include "sli_psa_driver_common.h"
+#include "mbedtls/platform_util.h"
 #include "sli_se_driver_key_management.h"
 #include "sli_se_driver_aead.h"
 
@@ -151,18 +152,19 @@ static psa_status_t check_aead_parameters(const psa_key_attributes_t *attributes
 
 // Do GCM in software in case the IV isn't 12 bytes, since that's the only
 // thing the accelerator supports.
-static psa_status_t sli_se_driver_software_gcm(sl_se_command_context_t *cmd_ctx,
-                                               sl_se_key_descriptor_t *key_desc,
-                                               const uint8_t* nonce,
-                                               size_t nonce_length,
-                                               const uint8_t* additional_data,
-                                               size_t additional_data_length,
-                                               const uint8_t* input,
-                                               uint8_t* output,
-                                               size_t plaintext_length,
-                                               size_t tag_length,
-                                               uint8_t* tag,
-                                               bool encrypt_ndecrypt)
+static psa_status_t sli_se_driver_software_gcm_with_context(sli_psa_software_ghash_context_t *ghash_ctx,
+                                                            sl_se_command_context_t *cmd_ctx,
+                                                            sl_se_key_descriptor_t *key_desc,
+                                                            const uint8_t* nonce,
+                                                            size_t nonce_length,
+                                                            const uint8_t* additional_data,
+                                                            size_t additional_data_length,
+                                                            const uint8_t* input,
+                                                            uint8_t* output,
+                                                            size_t plaintext_length,
+                                                            size_t tag_length,
+                                                            uint8_t* tag,
+                                                            bool encrypt_ndecrypt)
 {
   // Step 1: calculate H = Ek(0)
   uint8_t Ek[16] = { 0 };
@@ -179,25 +181,18 @@ static psa_status_t sli_se_driver_software_gcm(sl_se_command_context_t *cmd_ctx,
 
   // Step 2: calculate IV = GHASH(H, {}, IV)
   uint8_t iv[16] = { 0 };
-  uint64_t HL[16], HH[16];
 
-  sli_psa_software_ghash_setup(Ek, HL, HH);
+  sli_psa_software_ghash_setup(ghash_ctx, Ek);
 
-  for (size_t i = 0; i < nonce_length; i += 16) {
-    // Mix in IV
-    for (size_t j = 0; j < (nonce_length - i > 16 ? 16 : nonce_length - i); j++) {
-      iv[j] ^= nonce[i + j];
-    }
-    // Update result
-    sli_psa_software_ghash_multiply(HL, HH, iv, iv);
-  }
+  // Mix in IV
+  sli_psa_software_ghash_update(ghash_ctx, iv, nonce, nonce_length);
 
   iv[12] ^= (nonce_length * 8) >> 24;
   iv[13] ^= (nonce_length * 8) >> 16;
   iv[14] ^= (nonce_length * 8) >>  8;
   iv[15] ^= (nonce_length * 8) >>  0;
 
-  sli_psa_software_ghash_multiply(HL, HH, iv, iv);
+  sli_psa_software_ghash_multiply(ghash_ctx, iv, iv);
 
   // Step 3: Calculate first counter block for tag generation
   uint8_t tagbuf[16] = { 0 };
@@ -230,29 +225,12 @@ static psa_status_t sli_se_driver_software_gcm(sl_se_command_context_t *cmd_ctx,
 
   // Step 5: Accumulate additional data
   memset(Ek, 0, sizeof(Ek));
-  for (size_t i = 0; i < additional_data_length; i += 16) {
-    // Mix in additional data as much as we have
-    for (size_t j = 0;
-         j < (additional_data_length - i > 16 ? 16 : additional_data_length - i);
-         j++) {
-      Ek[j] ^= additional_data[i + j];
-    }
-
-    sli_psa_software_ghash_multiply(HL, HH, Ek, Ek);
-  }
+  sli_psa_software_ghash_update(ghash_ctx, Ek, additional_data, additional_data_length);
 
   // Step 6: If we're decrypting, accumulate the ciphertext before it gets transformed
   if (!encrypt_ndecrypt) {
-    for (size_t i = 0; i < plaintext_length; i += 16) {
-      // Mix in ciphertext
-      for (size_t j = 0;
-           j < (plaintext_length - i > 16 ? 16 : plaintext_length - i);
-           j++) {
-        Ek[j] ^= input[i + j];
-      }
-
-      sli_psa_software_ghash_multiply(HL, HH, Ek, Ek);
-    }
+    // Mix in ciphertext
+    sli_psa_software_ghash_update(ghash_ctx, Ek, input, plaintext_length);
   }
 
   // Step 7: transform data using AES-CTR
@@ -272,16 +250,8 @@ static psa_status_t sli_se_driver_software_gcm(sl_se_command_context_t *cmd_ctx,
 
   // Step 8: If we're encrypting, accumulate the ciphertext now
   if (encrypt_ndecrypt) {
-    for (size_t i = 0; i < plaintext_length; i += 16) {
-      // Mix in ciphertext
-      for (size_t j = 0;
-           j < (plaintext_length - i > 16 ? 16 : plaintext_length - i);
-           j++) {
-        Ek[j] ^= output[i + j];
-      }
-
-      sli_psa_software_ghash_multiply(HL, HH, Ek, Ek);
-    }
+    // Mix in ciphertext
+    sli_psa_software_ghash_update(ghash_ctx, Ek, output, plaintext_length);
   }
 
   // Step 9: add len(A) || len(C) block to tag calculation
@@ -305,7 +275,7 @@ static psa_status_t sli_se_driver_software_gcm(sl_se_command_context_t *cmd_ctx,
   Ek[14] ^= bitlen >>  8;
   Ek[15] ^= bitlen >>  0;
 
-  sli_psa_software_ghash_multiply(HL, HH, Ek, Ek);
+  sli_psa_software_ghash_multiply(ghash_ctx, Ek, Ek);
 
   // Step 10: calculate tag value
   for (size_t i = 0; i < tag_length; i++) {
@@ -328,6 +298,40 @@ static psa_status_t sli_se_driver_software_gcm(sl_se_command_context_t *cmd_ctx,
   return PSA_SUCCESS;
 }
 
+// The GHASH multiplication context is derived from the key, and can take
+// several KiB of stack depending on SLI_PSA_SOFTWARE_GHASH_KERNEL. It is
+// wiped whatever the outcome of the operation.
+static psa_status_t sli_se_driver_software_gcm(sl_se_command_context_t *cmd_ctx,
+                                               sl_se_key_descriptor_t *key_desc,
+                                               const uint8_t* nonce,
+                                               size_t nonce_length,
+                                               const uint8_t* additional_data,
+                                               size_t additional_data_length,
+                                               const uint8_t* input,
+                                               uint8_t* output,
+                                               size_t plaintext_length,
+                                               size_t tag_length,
+                                               uint8_t* tag,
+                                               bool encrypt_ndecrypt)
+{
+  sli_psa_software_ghash_context_t ghash_ctx;
+  psa_status_t status = sli_se_driver_software_gcm_with_context(&ghash_ctx,
+                                                                cmd_ctx,
+                                                                key_desc,
+                                                                nonce,
+                                                                nonce_length,
+                                                                additional_data,
+                                                                additional_data_length,
+                                                                input,
+                                                                output,
+                                                                plaintext_length,
+                                                                tag_length,
+                                                                tag,
+                                                                encrypt_ndecrypt);
+  mbedtls_platform_zeroize(&ghash_ctx, sizeof(ghash_ctx));
+  return status;
+}
+
 #endif // SLI_PSA_DRIVER_FEATURE_GCM_IV_CALCULATION
 
 #if defined(SLI_PSA_DRIVER_FEATURE_AEAD_MULTIPART)
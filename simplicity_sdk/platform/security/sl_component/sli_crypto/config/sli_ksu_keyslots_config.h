@@ -15,6 +15,17 @@
 
 // </h>
 
+// <h> KSU KEY slot cache
+
+// <o SL_KSU_KEY_SLOT_CACHE_SIZE> Number of keys kept in the KSU key slot cache.
+// <i> Default: 4
+// <i> Plaintext keys used through SLI_CRYPTO_KEY_LOCATION_KSU_CACHED are imported
+// <i> into a KSU key slot on first use and kept there for later operations.
+// <i> 0 disables the cache.
+#define SL_KSU_KEY_SLOT_CACHE_SIZE   4
+
+// </h>
+
 // <<< end of configuration section >>>
 
 #define SLI_KSU_MAX_KEY_SLOTS              KSU_MAX_KEY_SLOTS
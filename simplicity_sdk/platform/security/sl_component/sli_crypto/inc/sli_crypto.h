@@ -130,6 +130,39 @@ sl_status_t sli_crypto_ccm_zigbee(sli_crypto_descriptor_t     *key_descriptor,
                                   unsigned char               *tag,
                                   size_t                      tag_len);
 
+/// One frame of a batch of Zigbee CCM operations
+typedef struct {
+  sli_crypto_descriptor_t *key_descriptor; ///< AES key descriptor
+  bool                    encrypt;         ///< Encrypt operation
+  const unsigned char     *data_in;        ///< Input buffer of payload data
+  unsigned char           *data_out;       ///< Output buffer of payload data
+  size_t                  length;          ///< Length of input data
+  const unsigned char     *iv;             ///< Nonce, must be 13 bytes
+  const unsigned char     *aad;            ///< Additional Authenticated Data
+  size_t                  aad_len;         ///< Length of buffer aad
+  unsigned char           *tag;            ///< Authentication tag
+  size_t                  tag_len;         ///< Length of authentication tag
+  sl_status_t             status;          ///< Result of the frame, set by the batch
+} sli_crypto_ccm_zigbee_frame_t;
+
+/***************************************************************************//**
+ * @brief                CCM encryption/decryption of a burst of Zigbee frames
+ *
+ * @details              Equivalent to calling @ref sli_crypto_ccm_zigbee on
+ *                       each frame, with the engine acquired once for several
+ *                       frames on RADIOAES. Each frame gets its own result, a
+ *                       failing frame does not stop the batch.
+ *
+ * @param frames         Array of frames
+ * @param frame_count    Number of frames in the array
+ *
+ * @return               SL_STATUS_OK if all the frames were processed and
+ *                       authenticated, otherwise the status of a failing frame
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+sl_status_t sli_crypto_ccm_zigbee_batch(sli_crypto_ccm_zigbee_frame_t frames[],
+                                        size_t                        frame_count);
+
 /***************************************************************************//**
  * @brief                Process a table of BLE RPA device keys and look for a
  *                       match against the supplied hash
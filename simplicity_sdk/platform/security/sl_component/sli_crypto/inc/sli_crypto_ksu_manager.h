@@ -42,10 +42,15 @@
 
 #include <stddef.h>
 
+#if !defined(SL_KSU_KEY_SLOT_CACHE_SIZE)
+#define SL_KSU_KEY_SLOT_CACHE_SIZE 0
+#endif
+
 typedef enum {
   SLI_KSU_SLOT_STATUS_AVAILABLE = 0,
   SLI_KSU_SLOT_STATUS_IN_USE = 1,
-  SLI_KSU_SLOT_STATUS_RESERVED = 2
+  SLI_KSU_SLOT_STATUS_RESERVED = 2,
+  SLI_KSU_SLOT_STATUS_CACHED = 3
 } sli_ksu_key_slot_status_t;
 
 typedef struct sli_ksu_slot{
@@ -59,6 +64,13 @@ enum crypto_engines {
   SLI_CRYPTOMASTER_HASH = 1
 };
 
+/// KSU key slot cache statistics
+typedef struct {
+  uint32_t hits;      ///< Acquisitions served by a cached key slot, i.e. imports avoided
+  uint32_t misses;    ///< Acquisitions that imported the key into a key slot
+  uint32_t evictions; ///< Cached keys deleted to make room for other keys
+} sli_ksu_key_slot_cache_stats_t;
+
 /***************************************************************************//**
  * @brief                Import plaintext key into KSU
  *
@@ -158,4 +170,60 @@ sl_status_t sli_ksu_allocate_key_slot(sl_se_key_descriptor_t *key_desc,
 sl_status_t sli_ksu_key_slot_generate(sl_se_key_descriptor_t *key_desc,
                                       void *user_ref);
 
+#if (SL_KSU_KEY_SLOT_CACHE_SIZE > 0)
+/***************************************************************************//**
+ * @brief                Acquire a KSU key slot holding a plaintext key
+ *
+ * @details              The key is looked up in the key slot cache by its
+ *                       identity. It is imported into a free key slot on a miss,
+ *                       evicting the least recently used cached key that is not
+ *                       in use if needed. The key slot stays valid until it is
+ *                       released with sli_ksu_key_slot_cache_release().
+ *
+ * @param key_desc       Key descriptor with KSU storage method. The key slot
+ *                       is set on success.
+ * @param key_data       Input key data buffer
+ * @param key_data_len   length of input key data
+ * @param key_id         Identity of the key. The key data of a given identity
+ *                       must not change until the identity is invalidated with
+ *                       sli_ksu_key_slot_cache_invalidate().
+ *
+ * @return               SL_STATUS_OK if successful, SL_STATUS_FULL if all the
+ *                       cached key slots are in use, relevant status code on error
+ ******************************************************************************/
+sl_status_t sli_ksu_key_slot_cache_acquire(sl_se_key_descriptor_t *key_desc,
+                                           const uint8_t *key_data,
+                                           size_t key_data_len,
+                                           const void *key_id);
+
+/***************************************************************************//**
+ * @brief                Release a key slot acquired from the key slot cache
+ *
+ * @param key_slot_id    KSU keyslot ID returned by sli_ksu_key_slot_cache_acquire()
+ *
+ * @return               SL_STATUS_OK if successful, relevant status code on error
+ ******************************************************************************/
+sl_status_t sli_ksu_key_slot_cache_release(uint8_t key_slot_id);
+
+/***************************************************************************//**
+ * @brief                Delete a key from the key slot cache
+ *
+ * @param key_id         Identity of the key
+ *
+ * @return               SL_STATUS_OK if successful or if the key is not cached,
+ *                       SL_STATUS_BUSY if the key slot is in use, relevant
+ *                       status code on error
+ ******************************************************************************/
+sl_status_t sli_ksu_key_slot_cache_invalidate(const void *key_id);
+
+/***************************************************************************//**
+ * @brief                Get the key slot cache statistics
+ *
+ * @param stats          Output statistics
+ *
+ * @return               SL_STATUS_OK if successful, relevant status code on error
+ ******************************************************************************/
+sl_status_t sli_ksu_key_slot_cache_get_stats(sli_ksu_key_slot_cache_stats_t *stats);
+#endif // SL_KSU_KEY_SLOT_CACHE_SIZE > 0
+
 #endif // SLI_CRYPTO_KSU_MANAGER_H
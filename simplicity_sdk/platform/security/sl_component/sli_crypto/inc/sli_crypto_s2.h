@@ -30,6 +30,7 @@
 #ifndef SLI_CRYPTO_S2_H
 #define SLI_CRYPTO_S2_H
 
+#include "sl_status.h"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -41,14 +42,37 @@ extern "C" {
 #define SLI_CRYPTO_AES_BLOCK_SIZE  16
 /// Location value for keys stored in plaintext
 #define SLI_CRYPTO_KEY_LOCATION_PLAINTEXT ((sli_crypto_key_location_t)0x00000000UL)
-/// The SLI Crypto API supports only the RADIOAES crypto engine on Series-2
+/// RADIOAES crypto engine, supported by every function of the SLI Crypto API
 #define SLI_CRYPTO_ENGINE_RADIOAES       ((sli_crypto_engine_t)0x00000001UL)
+/// SE mailbox crypto engine, only available on devices with a HSE. Only the
+/// CCM functions can run on this engine, and they return
+/// SL_STATUS_NOT_AVAILABLE when it is requested on other devices.
+#define SLI_CRYPTO_ENGINE_SEMAILBOX      ((sli_crypto_engine_t)0x00000002UL)
+/// CRYPTOACC crypto engine, only available on devices with a VSE. Only the
+/// CCM functions can run on this engine, and they return
+/// SL_STATUS_NOT_AVAILABLE when it is requested on other devices.
+#define SLI_CRYPTO_ENGINE_CRYPTOACC      ((sli_crypto_engine_t)0x00000003UL)
+/// Let the CCM functions pick, on each call, the engine with the lowest
+/// estimated cost for the payload size. An operation the offload engine
+/// rejects before writing any output is retried on RADIOAES. The other
+/// functions use RADIOAES.
+/// See @ref sli_crypto_engine_calibrate.
+#define SLI_CRYPTO_ENGINE_AUTO           ((sli_crypto_engine_t)0x000000FFUL)
 #define SLI_CRYPTO_ENGINE_DEFAULT        (SLI_CRYPTO_ENGINE_RADIOAES)
 
 /// Used to choose a crypto engine.
-/// @ref SLI_CRYPTO_LPWAES.
+/// @ref SLI_CRYPTO_ENGINE_RADIOAES, @ref SLI_CRYPTO_ENGINE_SEMAILBOX,
+/// @ref SLI_CRYPTO_ENGINE_CRYPTOACC or @ref SLI_CRYPTO_ENGINE_AUTO.
 typedef uint32_t sli_crypto_engine_t;
 
+/// Cost model of a crypto engine for a CCM operation, in CPU cycles. The
+/// estimated cost of an operation is setup_cycles plus block_cycles for each
+/// 16-byte block of payload and additional data.
+typedef struct {
+  uint32_t setup_cycles; ///< Fixed cost of an operation.
+  uint32_t block_cycles; ///< Cost of each 16-byte block.
+} sli_crypto_engine_cost_t;
+
 /// Key storage location. Can either
 /// @ref SLI_CRYPTO_KEY_LOCATION_PLAINTEXT
 typedef uint32_t sli_crypto_key_location_t;
@@ -98,6 +122,68 @@ typedef struct {
     },                                                    \
   }
 
+/***************************************************************************//**
+ * @brief                Measure the cost model of RADIOAES and of the offload
+ *                       engine (SE mailbox or CRYPTOACC) of the device
+ *
+ * @details              Runs CCM operations of two payload sizes on each
+ *                       engine and times them with the DWT cycle counter.
+ *                       The measured models replace the default ones used by
+ *                       @ref SLI_CRYPTO_ENGINE_AUTO. Must be called from
+ *                       thread context, while the engines are otherwise idle.
+ *
+ * @return               SL_STATUS_OK if successful,
+ *                       SL_STATUS_NOT_SUPPORTED if the device has no offload
+ *                       engine, relevant status code on other error
+ ******************************************************************************/
+sl_status_t sli_crypto_engine_calibrate(void);
+
+/***************************************************************************//**
+ * @brief                Get the cost model of a crypto engine
+ *
+ * @param engine         @ref SLI_CRYPTO_ENGINE_RADIOAES,
+ *                       @ref SLI_CRYPTO_ENGINE_SEMAILBOX or
+ *                       @ref SLI_CRYPTO_ENGINE_CRYPTOACC
+ * @param cost           Cost model of the engine
+ *
+ * @return               SL_STATUS_OK if successful,
+ *                       SL_STATUS_NOT_SUPPORTED if the engine is not available
+ ******************************************************************************/
+sl_status_t sli_crypto_engine_get_cost(sli_crypto_engine_t      engine,
+                                       sli_crypto_engine_cost_t *cost);
+
+/***************************************************************************//**
+ * @brief                Set the cost model of a crypto engine, for instance
+ *                       to restore the result of an earlier calibration
+ *
+ * @param engine         @ref SLI_CRYPTO_ENGINE_RADIOAES,
+ *                       @ref SLI_CRYPTO_ENGINE_SEMAILBOX or
+ *                       @ref SLI_CRYPTO_ENGINE_CRYPTOACC
+ * @param cost           Cost model of the engine
+ *
+ * @return               SL_STATUS_OK if successful,
+ *                       SL_STATUS_NOT_SUPPORTED if the engine is not available
+ ******************************************************************************/
+sl_status_t sli_crypto_engine_set_cost(sli_crypto_engine_t            engine,
+                                       const sli_crypto_engine_cost_t *cost);
+
+/***************************************************************************//**
+ * @brief                Get the payload length from which an engine is
+ *                       estimated to be faster than an idle RADIOAES
+ *
+ * @param engine         @ref SLI_CRYPTO_ENGINE_SEMAILBOX or
+ *                       @ref SLI_CRYPTO_ENGINE_CRYPTOACC
+ * @param length         Crossover length in bytes, a multiple of
+ *                       @ref SLI_CRYPTO_AES_BLOCK_SIZE
+ *
+ * @return               SL_STATUS_OK if successful,
+ *                       SL_STATUS_NOT_FOUND if the engine is not faster for
+ *                       every payload above some length,
+ *                       SL_STATUS_NOT_SUPPORTED if the engine is not available
+ ******************************************************************************/
+sl_status_t sli_crypto_engine_get_crossover(sli_crypto_engine_t engine,
+                                            size_t              *length);
+
 #ifdef __cplusplus
 }
 #endif
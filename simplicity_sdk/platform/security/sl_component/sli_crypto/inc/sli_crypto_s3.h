@@ -46,6 +46,12 @@ extern "C" {
 #define SLI_CRYPTO_KEY_LOCATION_PLAINTEXT ((sli_crypto_key_location_t)0x00000000UL)
 /// Location value for keys stored in KSU
 #define SLI_CRYPTO_KEY_LOCATION_KSU       ((sli_crypto_key_location_t)0x00000001UL)
+/// Location value for plaintext keys cached in a KSU key slot. The key is
+/// described as a plaintext key and is imported into the KSU on first use.
+/// The descriptor address identifies the key: the descriptor must outlive
+/// its use and its key must not change until sli_crypto_key_cache_invalidate()
+/// is called. Only supported by sli_crypto_gcm() and sli_crypto_ccm().
+#define SLI_CRYPTO_KEY_LOCATION_KSU_CACHED ((sli_crypto_key_location_t)0x00000002UL)
 /// Crypto engine selection value for HostSymCrypt
 /**
  * @note
@@ -67,8 +73,9 @@ typedef uint32_t sli_crypto_key_slot_t;
 typedef uint32_t sli_crypto_engine_t;
 
 /// Key storage location. Can either be
-/// @ref SLI_CRYPTO_KEY_LOCATION_PLAINTEXT or
-/// @ref SLI_CRYPTO_KEY_LOCATION_KSU.
+/// @ref SLI_CRYPTO_KEY_LOCATION_PLAINTEXT,
+/// @ref SLI_CRYPTO_KEY_LOCATION_KSU or
+/// @ref SLI_CRYPTO_KEY_LOCATION_KSU_CACHED.
 typedef uint32_t sli_crypto_key_location_t;
 
 /// Describes where the plaintext key is stored
@@ -279,6 +286,19 @@ sl_status_t sli_crypto_cmac(sli_crypto_descriptor_t *key_descriptor,
                             unsigned int            length,
                             volatile unsigned char  output[SLI_CRYPTO_AES_BLOCK_SIZE]);
 
+/***************************************************************************//**
+ * @brief                Remove a key from the KSU key slot cache
+ *
+ * @details              Must be called before a descriptor using
+ *                       @ref SLI_CRYPTO_KEY_LOCATION_KSU_CACHED is released or
+ *                       its key is changed.
+ *
+ * @param key_descriptor AES key descriptor
+ *
+ * @return               SL_STATUS_OK if successful, relevant status code on error
+ ******************************************************************************/
+sl_status_t sli_crypto_key_cache_invalidate(const sli_crypto_descriptor_t *key_descriptor);
+
 #ifdef __cplusplus
 }
 #endif
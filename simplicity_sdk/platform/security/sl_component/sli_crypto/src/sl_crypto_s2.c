@@ -30,7 +30,415 @@
 #include "em_device.h"
 #include "sli_crypto.h"
 #include "sl_assert.h"
+#include "sl_core.h"
 #include "sli_protocol_crypto.h"
+#include "sli_radioaes_management.h"
+
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+
+// -----------------------------------------------------------------------------
+// Engine dispatch
+//
+// CCM operations can either run on RADIOAES or be offloaded to the other AES
+// engine of the device through its PSA driver. Offloading has a much larger
+// fixed cost (a mailbox command or a driver setup) but a lower cost per
+// block, so it is only worth it for large payloads. The crossover depends on
+// the device and its clocks, hence the calibration routine.
+
+#ifndef SLI_CRYPTO_ENGINE_DISPATCH_ENABLE
+#define SLI_CRYPTO_ENGINE_DISPATCH_ENABLE 1
+#endif
+
+#if SLI_CRYPTO_ENGINE_DISPATCH_ENABLE && defined(SL_CATALOG_PSA_CRYPTO_PRESENT)
+#if defined(SEMAILBOX_PRESENT) && !defined(SLI_EXCLUDE_PSA_SE_SYMCRYPTO_DRIVERS)
+#include "sli_se_transparent_functions.h"
+#define SLI_CRYPTO_OFFLOAD_ENGINE         SLI_CRYPTO_ENGINE_SEMAILBOX
+#define SLI_CRYPTO_OFFLOAD_ENCRYPT_TAG    sli_se_driver_aead_encrypt_tag
+#define SLI_CRYPTO_OFFLOAD_DECRYPT_TAG    sli_se_driver_aead_decrypt_tag
+#ifndef SLI_CRYPTO_ENGINE_OFFLOAD_SETUP_CYCLES
+#define SLI_CRYPTO_ENGINE_OFFLOAD_SETUP_CYCLES   12000
+#endif
+#ifndef SLI_CRYPTO_ENGINE_OFFLOAD_BLOCK_CYCLES
+#define SLI_CRYPTO_ENGINE_OFFLOAD_BLOCK_CYCLES   32
+#endif
+#elif defined(CRYPTOACC_PRESENT)
+#include "sli_cryptoacc_transparent_functions.h"
+#define SLI_CRYPTO_OFFLOAD_ENGINE         SLI_CRYPTO_ENGINE_CRYPTOACC
+#define SLI_CRYPTO_OFFLOAD_ENCRYPT_TAG    sli_cryptoacc_transparent_aead_encrypt_tag
+#define SLI_CRYPTO_OFFLOAD_DECRYPT_TAG    sli_cryptoacc_transparent_aead_decrypt_tag
+#ifndef SLI_CRYPTO_ENGINE_OFFLOAD_SETUP_CYCLES
+#define SLI_CRYPTO_ENGINE_OFFLOAD_SETUP_CYCLES   3000
+#endif
+#ifndef SLI_CRYPTO_ENGINE_OFFLOAD_BLOCK_CYCLES
+#define SLI_CRYPTO_ENGINE_OFFLOAD_BLOCK_CYCLES   28
+#endif
+#endif
+#endif // SLI_CRYPTO_ENGINE_DISPATCH_ENABLE && SL_CATALOG_PSA_CRYPTO_PRESENT
+
+#ifndef SLI_CRYPTO_ENGINE_RADIOAES_SETUP_CYCLES
+#define SLI_CRYPTO_ENGINE_RADIOAES_SETUP_CYCLES  600
+#endif
+#ifndef SLI_CRYPTO_ENGINE_RADIOAES_BLOCK_CYCLES
+#define SLI_CRYPTO_ENGINE_RADIOAES_BLOCK_CYCLES  64
+#endif
+
+// Estimated wait added to the cost of RADIOAES when it is found busy (e.g.
+// processing a radio frame from an interrupt).
+#ifndef SLI_CRYPTO_ENGINE_RADIOAES_BUSY_CYCLES
+#define SLI_CRYPTO_ENGINE_RADIOAES_BUSY_CYCLES   2000
+#endif
+
+// Number of frames of sli_crypto_ccm_zigbee_batch() processed under a single
+// RADIOAES acquire. Bounds the stack used by the batch.
+#ifndef SLI_CRYPTO_CCM_ZIGBEE_BATCH_CHUNK
+#define SLI_CRYPTO_CCM_ZIGBEE_BATCH_CHUNK        4
+#endif
+
+// Payload sizes timed by the calibration routine.
+#define CALIBRATION_SHORT_LENGTH    SLI_CRYPTO_AES_BLOCK_SIZE
+#define CALIBRATION_LONG_LENGTH     (16 * SLI_CRYPTO_AES_BLOCK_SIZE)
+#define CALIBRATION_ROUNDS          4
+#define CALIBRATION_TAG_LENGTH      4
+#define CCM_NONCE_LENGTH            13
+
+#if defined(SLI_CRYPTO_OFFLOAD_ENGINE)
+
+#define ENGINE_COST_RADIOAES 0
+#define ENGINE_COST_OFFLOAD  1
+
+static sli_crypto_engine_cost_t engine_cost[2] = {
+  [ENGINE_COST_RADIOAES] = {
+    .setup_cycles = SLI_CRYPTO_ENGINE_RADIOAES_SETUP_CYCLES,
+    .block_cycles = SLI_CRYPTO_ENGINE_RADIOAES_BLOCK_CYCLES,
+  },
+  [ENGINE_COST_OFFLOAD] = {
+    .setup_cycles = SLI_CRYPTO_ENGINE_OFFLOAD_SETUP_CYCLES,
+    .block_cycles = SLI_CRYPTO_ENGINE_OFFLOAD_BLOCK_CYCLES,
+  },
+};
+
+static uint64_t engine_estimate(size_t index, size_t length)
+{
+  uint64_t blocks = (length + SLI_CRYPTO_AES_BLOCK_SIZE - 1) / SLI_CRYPTO_AES_BLOCK_SIZE;
+  return engine_cost[index].setup_cycles
+         + (blocks * engine_cost[index].block_cycles);
+}
+
+// Pick the engine for a CCM operation over length bytes of payload and
+// additional data.
+static sli_crypto_engine_t select_engine(const sli_crypto_descriptor_t *key_descriptor,
+                                         size_t                        length,
+                                         size_t                        tag_len)
+{
+  // The offload engine needs a plaintext key and does not support the
+  // encryption-only mode of CCM*.
+  if (key_descriptor->location != SLI_CRYPTO_KEY_LOCATION_PLAINTEXT
+      || tag_len < 4 || tag_len > 16 || (tag_len % 2) != 0) {
+    return SLI_CRYPTO_ENGINE_RADIOAES;
+  }
+
+  if (key_descriptor->engine != SLI_CRYPTO_ENGINE_AUTO) {
+    return key_descriptor->engine;
+  }
+
+  // The SE mailbox and the CRYPTOACC are guarded by a lock which cannot be
+  // taken from an interrupt, while RADIOAES supports preemption.
+  if (CORE_InIrqContext()) {
+    return SLI_CRYPTO_ENGINE_RADIOAES;
+  }
+
+  uint64_t radioaes_cycles;
+  uint64_t offload_cycles;
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  radioaes_cycles = engine_estimate(ENGINE_COST_RADIOAES, length);
+  offload_cycles = engine_estimate(ENGINE_COST_OFFLOAD, length);
+  CORE_EXIT_ATOMIC();
+
+  if (sli_radioaes_is_busy()) {
+    radioaes_cycles += SLI_CRYPTO_ENGINE_RADIOAES_BUSY_CYCLES;
+  }
+
+  return (offload_cycles < radioaes_cycles) ? SLI_CRYPTO_OFFLOAD_ENGINE
+         : SLI_CRYPTO_ENGINE_RADIOAES;
+}
+
+static sl_status_t psa_status_to_sl_status(psa_status_t status)
+{
+  switch (status) {
+    case PSA_SUCCESS:
+      return SL_STATUS_OK;
+    case PSA_ERROR_INVALID_SIGNATURE:
+      return SL_STATUS_INVALID_SIGNATURE;
+    case PSA_ERROR_INVALID_ARGUMENT:
+      return SL_STATUS_INVALID_PARAMETER;
+    case PSA_ERROR_NOT_SUPPORTED:
+      return SL_STATUS_NOT_SUPPORTED;
+    default:
+      return SL_STATUS_FAIL;
+  }
+}
+
+// Run a CCM operation with a 128-bit key and a 13-byte nonce on the offload
+// engine.
+static sl_status_t ccm_offload(bool                encrypt,
+                               const unsigned char *key,
+                               const unsigned char *data_in,
+                               unsigned char       *data_out,
+                               size_t              length,
+                               const unsigned char *iv,
+                               const unsigned char *aad,
+                               size_t              aad_len,
+                               unsigned char       *tag,
+                               size_t              tag_len)
+{
+  psa_status_t status;
+  size_t output_length = 0;
+  size_t tag_length = 0;
+  psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+  psa_set_key_type(&attr, PSA_KEY_TYPE_AES);
+  psa_set_key_bits(&attr, 128);
+
+  if (encrypt) {
+    status = SLI_CRYPTO_OFFLOAD_ENCRYPT_TAG(&attr, key, 16,
+                                            PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, tag_len),
+                                            iv, CCM_NONCE_LENGTH,
+                                            aad, aad_len,
+                                            data_in, length,
+                                            data_out, length, &output_length,
+                                            tag, tag_len, &tag_length);
+  } else {
+    status = SLI_CRYPTO_OFFLOAD_DECRYPT_TAG(&attr, key, 16,
+                                            PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, tag_len),
+                                            iv, CCM_NONCE_LENGTH,
+                                            aad, aad_len,
+                                            data_in, length,
+                                            tag, tag_len,
+                                            data_out, length, &output_length);
+  }
+
+  psa_reset_key_attributes(&attr);
+  return psa_status_to_sl_status(status);
+}
+
+// With SLI_CRYPTO_ENGINE_AUTO, an operation the offload engine rejected is
+// retried on RADIOAES. Only errors reported before any output is written are
+// retried: the BLE functions work in place, and any other failure may have
+// left the buffer modified.
+static bool offload_status_is_final(const sli_crypto_descriptor_t *key_descriptor,
+                                    sl_status_t                   status)
+{
+  return (status != SL_STATUS_NOT_SUPPORTED
+          && status != SL_STATUS_INVALID_PARAMETER)
+         || key_descriptor->engine != SLI_CRYPTO_ENGINE_AUTO;
+}
+
+// Time one CCM encryption of length bytes on an engine, keeping the best of a
+// few rounds to filter out interrupts.
+static sl_status_t calibration_measure(size_t index, size_t length, uint32_t *cycles)
+{
+  static unsigned char buffer[CALIBRATION_LONG_LENGTH];
+  static const unsigned char key[16] = { 0 };
+  static const unsigned char iv[CCM_NONCE_LENGTH] = { 0 };
+  unsigned char tag[CALIBRATION_TAG_LENGTH];
+  sl_status_t status = SL_STATUS_OK;
+
+  *cycles = UINT32_MAX;
+  for (size_t round = 0; round < CALIBRATION_ROUNDS; round++) {
+    uint32_t start = DWT->CYCCNT;
+    if (index == ENGINE_COST_RADIOAES) {
+      status = sli_ccm_zigbee(true, buffer, buffer, length, key, iv, NULL, 0,
+                              tag, sizeof(tag));
+    } else {
+      status = ccm_offload(true, key, buffer, buffer, length, iv, NULL, 0,
+                           tag, sizeof(tag));
+    }
+    uint32_t elapsed = DWT->CYCCNT - start;
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    if (elapsed < *cycles) {
+      *cycles = elapsed;
+    }
+  }
+
+  return SL_STATUS_OK;
+}
+
+static sl_status_t engine_cost_index(sli_crypto_engine_t engine, size_t *index)
+{
+  if (engine == SLI_CRYPTO_ENGINE_RADIOAES) {
+    *index = ENGINE_COST_RADIOAES;
+  } else if (engine == SLI_CRYPTO_OFFLOAD_ENGINE) {
+    *index = ENGINE_COST_OFFLOAD;
+  } else {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+  return SL_STATUS_OK;
+}
+
+#endif // SLI_CRYPTO_OFFLOAD_ENGINE
+
+sl_status_t sli_crypto_engine_calibrate(void)
+{
+#if defined(SLI_CRYPTO_OFFLOAD_ENGINE)
+  const uint32_t short_blocks = CALIBRATION_SHORT_LENGTH / SLI_CRYPTO_AES_BLOCK_SIZE;
+  const uint32_t long_blocks = CALIBRATION_LONG_LENGTH / SLI_CRYPTO_AES_BLOCK_SIZE;
+  sli_crypto_engine_cost_t measured[2];
+  sl_status_t status = SL_STATUS_OK;
+
+  if (CORE_InIrqContext()) {
+    return SL_STATUS_ISR;
+  }
+
+  // Enable the cycle counter, restoring the debug configuration afterwards.
+  bool trace_on = (CoreDebug->DEMCR & CoreDebug_DEMCR_TRCENA_Msk) != 0U;
+  bool cyccnt_on = (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0U;
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (size_t index = 0; index < 2 && status == SL_STATUS_OK; index++) {
+    uint32_t short_cycles;
+    uint32_t long_cycles;
+    status = calibration_measure(index, CALIBRATION_SHORT_LENGTH, &short_cycles);
+    if (status == SL_STATUS_OK) {
+      status = calibration_measure(index, CALIBRATION_LONG_LENGTH, &long_cycles);
+    }
+    if (status == SL_STATUS_OK) {
+      // Both points include the CCM header block, which cancels out.
+      uint32_t block_cycles = (long_cycles > short_cycles)
+                              ? (long_cycles - short_cycles) / (long_blocks - short_blocks)
+                              : 0U;
+      uint32_t payload_cycles = block_cycles * short_blocks;
+      measured[index].block_cycles = block_cycles;
+      measured[index].setup_cycles = (short_cycles > payload_cycles)
+                                     ? short_cycles - payload_cycles
+                                     : 0U;
+    }
+  }
+
+  if (!cyccnt_on) {
+    DWT->CTRL &= ~DWT_CTRL_CYCCNTENA_Msk;
+  }
+  if (!trace_on) {
+    CoreDebug->DEMCR &= ~CoreDebug_DEMCR_TRCENA_Msk;
+  }
+
+  if (status == SL_STATUS_OK) {
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    engine_cost[ENGINE_COST_RADIOAES] = measured[ENGINE_COST_RADIOAES];
+    engine_cost[ENGINE_COST_OFFLOAD] = measured[ENGINE_COST_OFFLOAD];
+    CORE_EXIT_ATOMIC();
+  }
+
+  return status;
+#else
+  return SL_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+sl_status_t sli_crypto_engine_get_cost(sli_crypto_engine_t      engine,
+                                       sli_crypto_engine_cost_t *cost)
+{
+  EFM_ASSERT(cost != NULL);
+#if defined(SLI_CRYPTO_OFFLOAD_ENGINE)
+  size_t index;
+  sl_status_t status = engine_cost_index(engine, &index);
+  if (status == SL_STATUS_OK) {
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    *cost = engine_cost[index];
+    CORE_EXIT_ATOMIC();
+  }
+  return status;
+#else
+  if (engine != SLI_CRYPTO_ENGINE_RADIOAES) {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+  cost->setup_cycles = SLI_CRYPTO_ENGINE_RADIOAES_SETUP_CYCLES;
+  cost->block_cycles = SLI_CRYPTO_ENGINE_RADIOAES_BLOCK_CYCLES;
+  return SL_STATUS_OK;
+#endif
+}
+
+sl_status_t sli_crypto_engine_set_cost(sli_crypto_engine_t            engine,
+                                       const sli_crypto_engine_cost_t *cost)
+{
+  EFM_ASSERT(cost != NULL);
+#if defined(SLI_CRYPTO_OFFLOAD_ENGINE)
+  size_t index;
+  sl_status_t status = engine_cost_index(engine, &index);
+  if (status == SL_STATUS_OK) {
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    engine_cost[index] = *cost;
+    CORE_EXIT_ATOMIC();
+  }
+  return status;
+#else
+  (void)engine;
+  (void)cost;
+  return SL_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+sl_status_t sli_crypto_engine_get_crossover(sli_crypto_engine_t engine,
+                                            size_t              *length)
+{
+  EFM_ASSERT(length != NULL);
+#if defined(SLI_CRYPTO_OFFLOAD_ENGINE)
+  if (engine != SLI_CRYPTO_OFFLOAD_ENGINE) {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+
+  sli_crypto_engine_cost_t radioaes;
+  sli_crypto_engine_cost_t offload;
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  radioaes = engine_cost[ENGINE_COST_RADIOAES];
+  offload = engine_cost[ENGINE_COST_OFFLOAD];
+  CORE_EXIT_ATOMIC();
+
+  // Smallest block count n with
+  // offload.setup + n * offload.block < radioaes.setup + n * radioaes.block
+  // for every larger payload. An engine with a higher cost per block always
+  // ends up slower, whatever its setup cost.
+  if (offload.block_cycles > radioaes.block_cycles) {
+    return SL_STATUS_NOT_FOUND;
+  }
+  if (offload.setup_cycles < radioaes.setup_cycles) {
+    *length = 0;
+    return SL_STATUS_OK;
+  }
+  if (offload.block_cycles == radioaes.block_cycles) {
+    return SL_STATUS_NOT_FOUND;
+  }
+  uint32_t setup_delta = offload.setup_cycles - radioaes.setup_cycles;
+  uint32_t block_delta = radioaes.block_cycles - offload.block_cycles;
+  *length = ((size_t)(setup_delta / block_delta) + 1U) * SLI_CRYPTO_AES_BLOCK_SIZE;
+  return SL_STATUS_OK;
+#else
+  (void)engine;
+  return SL_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+// Check that a CCM operation can run on the engine of a key descriptor.
+// Values other than the engines defined in sli_crypto_s2.h select RADIOAES.
+static bool engine_is_available(sli_crypto_engine_t engine)
+{
+  if (engine != SLI_CRYPTO_ENGINE_SEMAILBOX && engine != SLI_CRYPTO_ENGINE_CRYPTOACC) {
+    return true;
+  }
+#if defined(SLI_CRYPTO_OFFLOAD_ENGINE)
+  return engine == SLI_CRYPTO_OFFLOAD_ENGINE;
+#else
+  return false;
+#endif
+}
 
 sl_status_t sli_crypto_init(void)
 {
@@ -57,6 +465,21 @@ sl_status_t sli_crypto_ccm_auth_decrypt_ble(sli_crypto_descriptor_t     *key_des
   EFM_ASSERT(key_descriptor->location == SLI_CRYPTO_KEY_LOCATION_PLAINTEXT);
   EFM_ASSERT(key_descriptor->key.plaintext_key.buffer.pointer != NULL);
 
+  if (!engine_is_available(key_descriptor->engine)) {
+    return SL_STATUS_NOT_AVAILABLE;
+  }
+
+#if defined(SLI_CRYPTO_OFFLOAD_ENGINE)
+  if (select_engine(key_descriptor, length + 1U, 4U) == SLI_CRYPTO_OFFLOAD_ENGINE) {
+    sl_status_t status = ccm_offload(false,
+                                     (const unsigned char *)key_descriptor->key.plaintext_key.buffer.pointer,
+                                     data, data, length, iv, &header, 1U, tag, 4U);
+    if (offload_status_is_final(key_descriptor, status)) {
+      return status;
+    }
+  }
+#endif
+
   return sli_ccm_auth_decrypt_ble(data,
                                   length,
                                   (const unsigned char *)key_descriptor->key.plaintext_key.buffer.pointer,
@@ -82,6 +505,21 @@ sl_status_t sli_crypto_ccm_encrypt_and_tag_ble(sli_crypto_descriptor_t     *key_
   EFM_ASSERT(key_descriptor->location == SLI_CRYPTO_KEY_LOCATION_PLAINTEXT);
   EFM_ASSERT(key_descriptor->key.plaintext_key.buffer.pointer != NULL);
 
+  if (!engine_is_available(key_descriptor->engine)) {
+    return SL_STATUS_NOT_AVAILABLE;
+  }
+
+#if defined(SLI_CRYPTO_OFFLOAD_ENGINE)
+  if (select_engine(key_descriptor, length + 1U, 4U) == SLI_CRYPTO_OFFLOAD_ENGINE) {
+    sl_status_t status = ccm_offload(true,
+                                     (const unsigned char *)key_descriptor->key.plaintext_key.buffer.pointer,
+                                     data, data, length, iv, &header, 1U, tag, 4U);
+    if (offload_status_is_final(key_descriptor, status)) {
+      return status;
+    }
+  }
+#endif
+
   return sli_ccm_encrypt_and_tag_ble(data,
                                      length,
                                      (const unsigned char *)key_descriptor->key.plaintext_key.buffer.pointer,
@@ -110,6 +548,21 @@ sl_status_t sli_crypto_ccm_zigbee(sli_crypto_descriptor_t     *key_descriptor,
   EFM_ASSERT(key_descriptor->location == SLI_CRYPTO_KEY_LOCATION_PLAINTEXT);
   EFM_ASSERT(key_descriptor->key.plaintext_key.buffer.pointer != NULL);
 
+  if (!engine_is_available(key_descriptor->engine)) {
+    return SL_STATUS_NOT_AVAILABLE;
+  }
+
+#if defined(SLI_CRYPTO_OFFLOAD_ENGINE)
+  if (select_engine(key_descriptor, length + aad_len, tag_len) == SLI_CRYPTO_OFFLOAD_ENGINE) {
+    sl_status_t status = ccm_offload(encrypt,
+                                     (const unsigned char *)key_descriptor->key.plaintext_key.buffer.pointer,
+                                     data_in, data_out, length, iv, aad, aad_len, tag, tag_len);
+    if (offload_status_is_final(key_descriptor, status)) {
+      return status;
+    }
+  }
+#endif
+
   return sli_ccm_zigbee(encrypt,
                         data_in,
                         data_out,
@@ -122,6 +575,81 @@ sl_status_t sli_crypto_ccm_zigbee(sli_crypto_descriptor_t     *key_descriptor,
                         tag_len);
 }
 
+/***************************************************************************//**
+ * @brief          CCM encryption/decryption of a burst of Zigbee frames
+ ******************************************************************************/
+sl_status_t sli_crypto_ccm_zigbee_batch(sli_crypto_ccm_zigbee_frame_t frames[],
+                                        size_t                        frame_count)
+{
+  sli_ccm_zigbee_frame_t batch[SLI_CRYPTO_CCM_ZIGBEE_BATCH_CHUNK];
+  sli_crypto_ccm_zigbee_frame_t *batch_frames[SLI_CRYPTO_CCM_ZIGBEE_BATCH_CHUNK];
+  size_t batch_count = 0;
+  sl_status_t status = SL_STATUS_OK;
+
+  EFM_ASSERT(frames != NULL || frame_count == 0);
+
+  for (size_t i = 0; i <= frame_count; i++) {
+    // Run the queued frames when the chunk is full or at the end.
+    if (batch_count == SLI_CRYPTO_CCM_ZIGBEE_BATCH_CHUNK
+        || (i == frame_count && batch_count > 0)) {
+      (void)sli_ccm_zigbee_batch(batch, batch_count);
+      for (size_t j = 0; j < batch_count; j++) {
+        batch_frames[j]->status = batch[j].status;
+        if (batch[j].status != SL_STATUS_OK) {
+          status = batch[j].status;
+        }
+      }
+      batch_count = 0;
+    }
+    if (i == frame_count) {
+      break;
+    }
+
+    sli_crypto_ccm_zigbee_frame_t *frame = &frames[i];
+    EFM_ASSERT(frame->key_descriptor != NULL);
+
+    if (frame->key_descriptor->engine != SLI_CRYPTO_ENGINE_RADIOAES
+        && frame->key_descriptor->engine != SLI_CRYPTO_ENGINE_AUTO) {
+      // Frames forced to another engine are processed on their own. With
+      // SLI_CRYPTO_ENGINE_AUTO the amortized acquire favours RADIOAES.
+      frame->status = sli_crypto_ccm_zigbee(frame->key_descriptor,
+                                            frame->encrypt,
+                                            frame->data_in,
+                                            frame->data_out,
+                                            frame->length,
+                                            frame->iv,
+                                            frame->aad,
+                                            frame->aad_len,
+                                            frame->tag,
+                                            frame->tag_len);
+      if (frame->status != SL_STATUS_OK) {
+        status = frame->status;
+      }
+      continue;
+    }
+
+    EFM_ASSERT(frame->data_in != NULL);
+    EFM_ASSERT(frame->iv != NULL);
+    EFM_ASSERT(frame->key_descriptor->location == SLI_CRYPTO_KEY_LOCATION_PLAINTEXT);
+    EFM_ASSERT(frame->key_descriptor->key.plaintext_key.buffer.pointer != NULL);
+
+    batch[batch_count].encrypt = frame->encrypt;
+    batch[batch_count].key = (const unsigned char *)frame->key_descriptor->key.plaintext_key.buffer.pointer;
+    batch[batch_count].iv = frame->iv;
+    batch[batch_count].aad = frame->aad;
+    batch[batch_count].aad_len = frame->aad_len;
+    batch[batch_count].data_in = frame->data_in;
+    batch[batch_count].data_out = frame->data_out;
+    batch[batch_count].length = frame->length;
+    batch[batch_count].tag = frame->tag;
+    batch[batch_count].tag_len = frame->tag_len;
+    batch_frames[batch_count] = frame;
+    batch_count++;
+  }
+
+  return status;
+}
+
 /***************************************************************************//**
  * @brief          Process a table of BLE RPA device keys and look for a
  *                 match against the supplied hash
@@ -137,13 +665,18 @@ sl_status_t sli_crypto_process_rpa(sli_crypto_descriptor_t     *key_descriptor,
   EFM_ASSERT(irk_index != NULL);
   EFM_ASSERT(key_descriptor->location == SLI_CRYPTO_KEY_LOCATION_PLAINTEXT);
   EFM_ASSERT(key_descriptor->key.plaintext_key.buffer.pointer != NULL);
-  (void)irk_len;
+  // Never look past the irk_len keys of the table, whatever the mask says
+  if (irk_len < 64U) {
+    keymask &= ((uint64_t)1U << irk_len) - 1U;
+  }
   const unsigned char *keytable
     = (const unsigned char *)key_descriptor->key.plaintext_key.buffer.pointer;
-  *irk_index = sli_process_ble_rpa(keytable,
-                                   (uint32_t)keymask,
-                                   prand,
-                                   hash);
+  uint32_t keymask_words[2] = { (uint32_t)keymask, (uint32_t)(keymask >> 32) };
+  *irk_index = sli_process_ble_rpa_batch(keytable,
+                                         keymask_words,
+                                         2U,
+                                         prand,
+                                         hash);
   if (*irk_index == -1) {
     return SL_STATUS_FAIL;
   }
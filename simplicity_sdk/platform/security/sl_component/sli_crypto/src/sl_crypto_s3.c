@@ -32,6 +32,7 @@
 #include "sl_assert.h"
 #include "sl_clock_manager.h"
 #include "sl_code_classification.h"
+#include "sl_core.h"
 #include "sl_se_manager.h"
 #include "sl_se_manager_entropy.h"
 #include "sl_se_manager_types.h"
@@ -46,6 +47,13 @@
 #include "sxsymcrypt/keyref.h"
 #include "sxsymcrypt/statuscodes.h"
 
+#if defined(KSU_PRESENT)
+#include "sli_crypto_ksu_manager.h"
+#if (SL_KSU_KEY_SLOT_CACHE_SIZE > 0)
+#define SLI_CRYPTO_KSU_KEY_CACHE
+#endif
+#endif
+
 #define MASKBITS 128
 typedef union _hostcrypto_seed {
   uint8_t  u8[MASKBITS / 8];
@@ -160,6 +168,96 @@ static sl_status_t sli_crypto_exit(sl_status_t status,
   return status;
 }
 
+/**
+ * @brief
+ *   Get the descriptor to use for a key with the
+ *   SLI_CRYPTO_KEY_LOCATION_KSU_CACHED location. The key slot cache is used
+ *   when possible, otherwise the key is used as a plaintext key.
+ */
+static sl_status_t sli_crypto_key_cache_acquire(const sli_crypto_descriptor_t *key_descriptor,
+                                                sli_crypto_descriptor_t *cached_descriptor)
+{
+  *cached_descriptor = *key_descriptor;
+  cached_descriptor->location = SLI_CRYPTO_KEY_LOCATION_PLAINTEXT;
+
+#if defined(SLI_CRYPTO_KSU_KEY_CACHE)
+  // Keys can't be imported into the KSU from interrupt context.
+  if (CORE_InIrqContext()) {
+    return SL_STATUS_OK;
+  }
+
+  sl_se_key_descriptor_t key_desc = { 0 };
+  switch (key_descriptor->key.plaintext_key.key_size) {
+    case 16:
+      key_desc.type = SL_SE_KEY_TYPE_AES_128;
+      break;
+    case 24:
+      key_desc.type = SL_SE_KEY_TYPE_AES_192;
+      break;
+    case 32:
+      key_desc.type = SL_SE_KEY_TYPE_AES_256;
+      break;
+    default:
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+  key_desc.storage.method = SL_SE_KEY_STORAGE_INTERNAL_KSU;
+  key_desc.storage.location.ksu.id = SL_SE_KSU_ID_HOST;
+  key_desc.storage.location.ksu.crypto_engine_id = SLI_CRYPTOMASTER_AES;
+#if defined(SL_PSA_KEY_LOCATION_KSU_1)
+  // Set allowed users, as done for KSU keys by the PSA driver
+  if (key_descriptor->engine == SLI_CRYPTO_LPWAES) {
+    key_desc.flags |= SL_SE_KEY_FLAG_ASYMMETRIC_BUFFER_HAS_PRIVATE_KEY;
+  } else {
+    key_desc.flags |= SL_SE_KEY_FLAG_ASYMMETRIC_BUFFER_HAS_PUBLIC_KEY;
+  }
+#endif
+
+  sl_status_t status = sli_ksu_key_slot_cache_acquire(&key_desc,
+                                                      key_descriptor->key.plaintext_key.buffer.pointer,
+                                                      key_descriptor->key.plaintext_key.key_size,
+                                                      key_descriptor);
+  if (status == SL_STATUS_FULL || status == SL_STATUS_BUSY) {
+    // All the cached key slots are in use, fall back to the plaintext key.
+    return SL_STATUS_OK;
+  }
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  cached_descriptor->location = SLI_CRYPTO_KEY_LOCATION_KSU;
+  cached_descriptor->key.key_slot = key_desc.storage.location.ksu.keyslot;
+#endif // SLI_CRYPTO_KSU_KEY_CACHE
+
+  return SL_STATUS_OK;
+}
+
+/**
+ * @brief
+ *   Release a descriptor returned by sli_crypto_key_cache_acquire().
+ */
+static void sli_crypto_key_cache_release(const sli_crypto_descriptor_t *cached_descriptor)
+{
+#if defined(SLI_CRYPTO_KSU_KEY_CACHE)
+  if (cached_descriptor->location == SLI_CRYPTO_KEY_LOCATION_KSU) {
+    (void)sli_ksu_key_slot_cache_release((uint8_t)cached_descriptor->key.key_slot);
+  }
+#else
+  (void)cached_descriptor;
+#endif
+}
+
+sl_status_t sli_crypto_key_cache_invalidate(const sli_crypto_descriptor_t *key_descriptor)
+{
+  if (key_descriptor == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+#if defined(SLI_CRYPTO_KSU_KEY_CACHE)
+  return sli_ksu_key_slot_cache_invalidate(key_descriptor);
+#else
+  return SL_STATUS_OK;
+#endif
+}
+
 sl_status_t sli_crypto_gcm(sli_crypto_descriptor_t  *key_descriptor,
                            bool                     encrypt,
                            const unsigned char      *data_in,
@@ -178,6 +276,18 @@ sl_status_t sli_crypto_gcm(sli_crypto_descriptor_t  *key_descriptor,
   struct sxaead aead;
   struct sxkeyref key_ref;
 
+  if (key_descriptor->location == SLI_CRYPTO_KEY_LOCATION_KSU_CACHED) {
+    sli_crypto_descriptor_t cached_descriptor;
+    sl_status_t status = sli_crypto_key_cache_acquire(key_descriptor, &cached_descriptor);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    status = sli_crypto_gcm(&cached_descriptor, encrypt, data_in, data_len, data_out,
+                            iv, aad, aad_len, tag, tag_len);
+    sli_crypto_key_cache_release(&cached_descriptor);
+    return status;
+  }
+
   if (key_descriptor->location == SLI_CRYPTO_KEY_LOCATION_PLAINTEXT) {
     key_ref = sx_keyref_load_material(key_descriptor->key.plaintext_key.key_size,
                                       (const char *)key_descriptor->key.plaintext_key.buffer.pointer);
@@ -320,6 +430,18 @@ sl_status_t sli_crypto_ccm(sli_crypto_descriptor_t  *key_descriptor,
   bool is_isr = false;
   sli_cryptomaster_state_t lpwaes_state;
 
+  if (key_descriptor->location == SLI_CRYPTO_KEY_LOCATION_KSU_CACHED) {
+    sli_crypto_descriptor_t cached_descriptor;
+    sl_status_t status = sli_crypto_key_cache_acquire(key_descriptor, &cached_descriptor);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    status = sli_crypto_ccm(&cached_descriptor, encrypt, data_in, data_len, data_out,
+                            iv, iv_len, aad, aad_len, tag, tag_len);
+    sli_crypto_key_cache_release(&cached_descriptor);
+    return status;
+  }
+
   if (key_descriptor->location == SLI_CRYPTO_KEY_LOCATION_PLAINTEXT) {
     key_ref = sx_keyref_load_material(key_descriptor->key.plaintext_key.key_size,
                                       (const char *)key_descriptor->key.plaintext_key.buffer.pointer);
@@ -691,6 +813,37 @@ sl_status_t sli_crypto_ccm_zigbee(sli_crypto_descriptor_t     *key_descriptor,
                         tag_len);
 }
 
+/***************************************************************************//**
+ * @brief          CCM encryption/decryption of a burst of Zigbee frames
+ ******************************************************************************/
+sl_status_t sli_crypto_ccm_zigbee_batch(sli_crypto_ccm_zigbee_frame_t frames[],
+                                        size_t                        frame_count)
+{
+  sl_status_t status = SL_STATUS_OK;
+
+  EFM_ASSERT(frames != NULL || frame_count == 0);
+
+  // sxsymcrypt runs one operation per frame, each operation selecting the
+  // cryptomaster on its own.
+  for (size_t i = 0; i < frame_count; i++) {
+    frames[i].status = sli_crypto_ccm_zigbee(frames[i].key_descriptor,
+                                             frames[i].encrypt,
+                                             frames[i].data_in,
+                                             frames[i].data_out,
+                                             frames[i].length,
+                                             frames[i].iv,
+                                             frames[i].aad,
+                                             frames[i].aad_len,
+                                             frames[i].tag,
+                                             frames[i].tag_len);
+    if (frames[i].status != SL_STATUS_OK) {
+      status = frames[i].status;
+    }
+  }
+
+  return status;
+}
+
 /***************************************************************************//**
  * @brief          Process a table of BLE RPA device keys and look for a
  *                 match against the supplied hash
@@ -50,6 +50,21 @@ static sli_ksu_slot_t ksu_slots[SLI_KSU_MAX_KEY_SLOTS] = { 0 };
 static sli_psec_osal_lock_t sli_ksu_lock = { 0 };
 #endif
 
+#if (SL_KSU_KEY_SLOT_CACHE_SIZE > 0)
+// Plaintext key imported into a KSU key slot by the key slot cache.
+typedef struct {
+  const void *key_id;              // Identity of the key, NULL if the entry is unused
+  sl_se_key_descriptor_t key_desc; // Descriptor of the KSU key slot
+  size_t key_size;                 // Size of the plaintext key
+  uint32_t last_use;               // Value of the use counter when last acquired
+  uint16_t ref_count;              // Number of users of the key slot
+} sli_ksu_cache_entry_t;
+
+static sli_ksu_cache_entry_t ksu_cache[SL_KSU_KEY_SLOT_CACHE_SIZE] = { 0 };
+static uint32_t ksu_cache_use_counter = 0;
+static sli_ksu_key_slot_cache_stats_t ksu_cache_stats = { 0 };
+#endif
+
 // -----------------------------------------------------------------------------
 // Function Declarations
 
@@ -123,6 +138,92 @@ static inline sl_status_t sli_ksu_lock_release(void)
   return sl_status;
 }
 
+#if (SL_KSU_KEY_SLOT_CACHE_SIZE > 0)
+/**
+ * @brief
+ *   Delete the key of a key slot cache entry and free its KSU slot.
+ *   The KSU lock must be held.
+ */
+static sl_status_t sli_ksu_cache_evict(sli_ksu_cache_entry_t *entry)
+{
+  uint8_t key_slot_id = entry->key_desc.storage.location.ksu.keyslot;
+  sl_se_command_context_t cmd_ctx = SL_SE_COMMAND_CONTEXT_INIT;
+
+  // As in sli_ksu_delete_key(), the slot is freed even if the deletion fails.
+  ksu_slots[key_slot_id].user_ref = NULL;
+  ksu_slots[key_slot_id].state = SLI_KSU_SLOT_STATUS_AVAILABLE;
+  ksu_slots[key_slot_id].crypto_engine_id = 0;
+  entry->key_id = NULL;
+  entry->ref_count = 0;
+
+  sl_status_t sl_status = sl_se_init_command_context(&cmd_ctx);
+  if (sl_status != SL_STATUS_OK) {
+    return sl_status;
+  }
+
+  sl_status = sl_se_delete_key(&cmd_ctx, &entry->key_desc);
+  if (sl_status != SL_STATUS_OK) {
+    sl_se_deinit_command_context(&cmd_ctx);
+    return sl_status;
+  }
+
+  return sl_se_deinit_command_context(&cmd_ctx);
+}
+
+/**
+ * @brief
+ *   Get the least recently used key slot cache entry that is not in use.
+ *   The KSU lock must be held.
+ */
+static sli_ksu_cache_entry_t *sli_ksu_cache_get_lru_entry(void)
+{
+  sli_ksu_cache_entry_t *lru_entry = NULL;
+
+  for (size_t i = 0; i < SL_KSU_KEY_SLOT_CACHE_SIZE; i++) {
+    if (ksu_cache[i].key_id != NULL
+        && ksu_cache[i].ref_count == 0
+        && (lru_entry == NULL
+            // Wrap-safe comparison of the use counter values
+            || (int32_t)(ksu_cache[i].last_use - lru_entry->last_use) < 0)) {
+      lru_entry = &ksu_cache[i];
+    }
+  }
+
+  return lru_entry;
+}
+#endif // SL_KSU_KEY_SLOT_CACHE_SIZE > 0
+
+/**
+ * @brief
+ *   Find available KSU slot. Cached keys that are not in use are evicted
+ *   when all the slots are taken.
+ */
+static sl_status_t sli_ksu_find_available_slot(uint8_t *key_slot_id)
+{
+  // Perform a linear search to find the first empty slot
+  for (size_t i = SLI_KSU_KEY_SLOT_USER_START; i < SLI_KSU_MAX_KEY_SLOTS; i++) {
+    if (ksu_slots[i].user_ref == NULL
+        && ksu_slots[i].state == SLI_KSU_SLOT_STATUS_AVAILABLE) {
+      *key_slot_id = i;
+      return SL_STATUS_OK;
+    }
+  }
+
+#if (SL_KSU_KEY_SLOT_CACHE_SIZE > 0)
+  sli_ksu_cache_entry_t *lru_entry = sli_ksu_cache_get_lru_entry();
+  if (lru_entry != NULL) {
+    *key_slot_id = lru_entry->key_desc.storage.location.ksu.keyslot;
+    ksu_cache_stats.evictions++;
+    // The slot can be reused even if the deletion failed, see sli_ksu_delete_key().
+    (void)sli_ksu_cache_evict(lru_entry);
+    return SL_STATUS_OK;
+  }
+#endif
+
+  // No empty slot found
+  return SL_STATUS_FULL;
+}
+
 /**
  * @brief
  *   Find available key KSU slot in key descriptor
@@ -140,16 +241,13 @@ static inline sl_status_t sli_ksu_find_free_user_slot(sl_se_key_descriptor_t *ke
     return SL_STATUS_ALREADY_EXISTS;
   }
 
-  // Perform a linear search to find the first empty slot
-  for (size_t i = SLI_KSU_KEY_SLOT_USER_START; i < SLI_KSU_MAX_KEY_SLOTS; i++) {
-    if (ksu_slots[i].user_ref == NULL
-        && ksu_slots[i].state == SLI_KSU_SLOT_STATUS_AVAILABLE) {
-      key_desc->storage.location.ksu.keyslot = i;
-      return SL_STATUS_OK;
-    }
+  sl_status_t sl_status = sli_ksu_find_available_slot(&key_slot_id);
+  if (sl_status != SL_STATUS_OK) {
+    return sl_status;
   }
-  // No empty slot found
-  return SL_STATUS_FULL;
+
+  key_desc->storage.location.ksu.keyslot = key_slot_id;
+  return SL_STATUS_OK;
 }
 
 sl_status_t sli_ksu_allocate_key_slot(sl_se_key_descriptor_t *key_desc,
@@ -369,6 +467,19 @@ sl_status_t sli_ksu_delete_key(sl_se_key_descriptor_t *key_desc)
   ksu_slots[key_slot_id].state = SLI_KSU_SLOT_STATUS_AVAILABLE;
   ksu_slots[key_slot_id].crypto_engine_id = 0;
 
+#if (SL_KSU_KEY_SLOT_CACHE_SIZE > 0)
+  // Drop the key slot cache entry of the slot, if any, so that the deleted
+  // key is not handed out again by the cache.
+  for (size_t i = 0; i < SL_KSU_KEY_SLOT_CACHE_SIZE; i++) {
+    if (ksu_cache[i].key_id != NULL
+        && ksu_cache[i].key_desc.storage.location.ksu.keyslot == key_slot_id) {
+      ksu_cache[i].key_id = NULL;
+      ksu_cache[i].ref_count = 0;
+      break;
+    }
+  }
+#endif
+
   sl_se_command_context_t cmd_ctx = SL_SE_COMMAND_CONTEXT_INIT;
 
   sl_status = sl_se_init_command_context(&cmd_ctx);
@@ -497,4 +608,198 @@ sl_status_t sli_ksu_key_slot_copy(sl_se_key_descriptor_t *source_key_desc,
   // Release the KSU manager lock (mutex)
   sli_ksu_lock_release();
   return sl_status;
-}
\ No newline at end of file
+}
+
+#if (SL_KSU_KEY_SLOT_CACHE_SIZE > 0)
+sl_status_t sli_ksu_key_slot_cache_acquire(sl_se_key_descriptor_t *key_desc,
+                                           const uint8_t *key_data,
+                                           size_t key_data_len,
+                                           const void *key_id)
+{
+  if (key_desc == NULL || key_data == NULL || key_data_len == 0
+      || key_id == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  // Acquire the KSU manager lock (mutex) to protect KSU slot operations
+  sl_status_t sl_status = sli_ksu_lock_acquire();
+  if (sl_status != SL_STATUS_OK) {
+    return sl_status;
+  }
+
+  sli_ksu_cache_entry_t *entry = NULL;
+  for (size_t i = 0; i < SL_KSU_KEY_SLOT_CACHE_SIZE; i++) {
+    if (ksu_cache[i].key_id == key_id) {
+      entry = &ksu_cache[i];
+      break;
+    }
+  }
+
+  if (entry != NULL) {
+    // The key slot can only be reused with the same key type, engine and
+    // flags, the latter holding the allowed users of the KSU key.
+    if (entry->key_size == key_data_len
+        && entry->key_desc.type == key_desc->type
+        && entry->key_desc.flags == key_desc->flags
+        && entry->key_desc.storage.location.ksu.crypto_engine_id
+        == key_desc->storage.location.ksu.crypto_engine_id) {
+      // Cache hit, reuse the key slot
+      ksu_cache_stats.hits++;
+      goto exit;
+    }
+
+    // The key was cached for another usage, import it again.
+    if (entry->ref_count > 0) {
+      sl_status = SL_STATUS_BUSY;
+      goto exit;
+    }
+    (void)sli_ksu_cache_evict(entry);
+  } else {
+    // Use a free cache entry, or evict the least recently used key not in use.
+    for (size_t i = 0; i < SL_KSU_KEY_SLOT_CACHE_SIZE; i++) {
+      if (ksu_cache[i].key_id == NULL) {
+        entry = &ksu_cache[i];
+        break;
+      }
+    }
+    if (entry == NULL) {
+      entry = sli_ksu_cache_get_lru_entry();
+      if (entry == NULL) {
+        sl_status = SL_STATUS_FULL;
+        goto exit;
+      }
+      ksu_cache_stats.evictions++;
+      (void)sli_ksu_cache_evict(entry);
+    }
+  }
+
+  ksu_cache_stats.misses++;
+
+  uint8_t key_slot_id = 0;
+  sl_status = sli_ksu_find_available_slot(&key_slot_id);
+  if (sl_status != SL_STATUS_OK) {
+    goto exit;
+  }
+  key_desc->storage.location.ksu.keyslot = key_slot_id;
+
+  // Create a key desc representing the plaintext input key
+  sl_se_key_descriptor_t plaintext_key_desc = *key_desc;
+
+  plaintext_key_desc.storage.method = SL_SE_KEY_STORAGE_EXTERNAL_PLAINTEXT;
+  plaintext_key_desc.storage.location.buffer.pointer = (uint8_t *)key_data;
+  plaintext_key_desc.storage.location.buffer.size = (key_data_len + 3) & ~3;
+
+  sl_se_command_context_t cmd_ctx = SL_SE_COMMAND_CONTEXT_INIT;
+  sl_status = sl_se_init_command_context(&cmd_ctx);
+  if (sl_status != SL_STATUS_OK) {
+    goto exit;
+  }
+
+  // Call SE manager to import the key
+  sl_status = sl_se_import_key(&cmd_ctx, &plaintext_key_desc, key_desc);
+  if (sl_status != SL_STATUS_OK) {
+    sl_se_deinit_command_context(&cmd_ctx);
+    goto exit;
+  }
+
+  sl_status = sl_se_deinit_command_context(&cmd_ctx);
+  if (sl_status != SL_STATUS_OK) {
+    goto exit;
+  }
+
+  // Cached slots are not associated with a user reference.
+  ksu_slots[key_slot_id].user_ref = NULL;
+  ksu_slots[key_slot_id].state = SLI_KSU_SLOT_STATUS_CACHED;
+  ksu_slots[key_slot_id].crypto_engine_id = key_desc->storage.location.ksu.crypto_engine_id;
+
+  entry->key_id = key_id;
+  entry->key_desc = *key_desc;
+  entry->key_size = key_data_len;
+  entry->ref_count = 0;
+
+  exit:
+  if (sl_status == SL_STATUS_OK) {
+    entry->ref_count++;
+    entry->last_use = ++ksu_cache_use_counter;
+    key_desc->storage.location.ksu.keyslot = entry->key_desc.storage.location.ksu.keyslot;
+  }
+
+  // Release the KSU manager lock (mutex)
+  sli_ksu_lock_release();
+  return sl_status;
+}
+
+sl_status_t sli_ksu_key_slot_cache_release(uint8_t key_slot_id)
+{
+  // Acquire the KSU manager lock (mutex) to protect KSU slot operations
+  sl_status_t sl_status = sli_ksu_lock_acquire();
+  if (sl_status != SL_STATUS_OK) {
+    return sl_status;
+  }
+
+  sl_status = SL_STATUS_NOT_FOUND;
+  for (size_t i = 0; i < SL_KSU_KEY_SLOT_CACHE_SIZE; i++) {
+    if (ksu_cache[i].key_id != NULL
+        && ksu_cache[i].key_desc.storage.location.ksu.keyslot == key_slot_id) {
+      if (ksu_cache[i].ref_count == 0) {
+        sl_status = SL_STATUS_INVALID_STATE;
+      } else {
+        ksu_cache[i].ref_count--;
+        sl_status = SL_STATUS_OK;
+      }
+      break;
+    }
+  }
+
+  // Release the KSU manager lock (mutex)
+  sli_ksu_lock_release();
+  return sl_status;
+}
+
+sl_status_t sli_ksu_key_slot_cache_invalidate(const void *key_id)
+{
+  if (key_id == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  // Acquire the KSU manager lock (mutex) to protect KSU slot operations
+  sl_status_t sl_status = sli_ksu_lock_acquire();
+  if (sl_status != SL_STATUS_OK) {
+    return sl_status;
+  }
+
+  for (size_t i = 0; i < SL_KSU_KEY_SLOT_CACHE_SIZE; i++) {
+    if (ksu_cache[i].key_id == key_id) {
+      if (ksu_cache[i].ref_count > 0) {
+        sl_status = SL_STATUS_BUSY;
+      } else {
+        sl_status = sli_ksu_cache_evict(&ksu_cache[i]);
+      }
+      break;
+    }
+  }
+
+  // Release the KSU manager lock (mutex)
+  sli_ksu_lock_release();
+  return sl_status;
+}
+
+sl_status_t sli_ksu_key_slot_cache_get_stats(sli_ksu_key_slot_cache_stats_t *stats)
+{
+  if (stats == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  // Acquire the KSU manager lock (mutex) to protect KSU slot operations
+  sl_status_t sl_status = sli_ksu_lock_acquire();
+  if (sl_status != SL_STATUS_OK) {
+    return sl_status;
+  }
+
+  *stats = ksu_cache_stats;
+
+  // Release the KSU manager lock (mutex)
+  sli_ksu_lock_release();
+  return SL_STATUS_OK;
+}
+#endif // SL_KSU_KEY_SLOT_CACHE_SIZE > 0
@@ -0,0 +1,51 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Pool configuration file.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SLI_MEM_POOL_CONFIG_H
+#define SLI_MEM_POOL_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Memory Pool Settings
+
+// <q SLI_MEM_POOL_LOCK_FREE> Use lock-free memory pools
+// <i> Default: 0
+// <i>
+// <i> When enabled, the pool operations never disable interrupts. The free
+// <i> list head is a tagged block index updated with a compare-and-swap, and
+// <i> a pool can be used concurrently from threads and interrupt handlers.
+// <i> This option changes the layout of sli_mem_pool_handle_t, so it must
+// <i> have the same value in every translation unit.
+#define SLI_MEM_POOL_LOCK_FREE  0
+
+// </h>
+// <<< end of configuration section >>>
+
+#endif /* SLI_MEM_POOL_CONFIG_H */
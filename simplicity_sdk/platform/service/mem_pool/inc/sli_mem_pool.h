@@ -32,6 +32,7 @@
 #define SL_MEM_POOL_H
 
 #include <stdint.h>
+#include "sli_mem_pool_config.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -47,8 +48,16 @@ extern "C"
 
 /// @brief Memory Pool Handle
 #endif // DOXYGEN
+/// When SLI_MEM_POOL_LOCK_FREE is enabled in sli_mem_pool_config.h, the pool
+/// operations never disable interrupts. The free list head is then a tagged
+/// block index updated with a compare-and-swap, and the pool can be used
+/// concurrently from threads and interrupt handlers.
 typedef struct sli_mem_pool_handle{
+#if (SLI_MEM_POOL_LOCK_FREE == 1)
+  volatile uint32_t free_head; ///< Head of free block list: tag in MSBs, block index in LSBs.
+#else
   void* free_block_addr;   ///< Pointer to head of free block list.
+#endif
   void* data;              ///< Pointer to buffer.
   uint16_t block_size;     ///< Size of the blocks.
   uint16_t block_count;    ///< Total number of blocks in pool.
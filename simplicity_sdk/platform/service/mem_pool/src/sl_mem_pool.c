@@ -37,10 +37,91 @@
 #include "sli_mem_pool.h"
 
 #include <stddef.h>
+#include <stdbool.h>
 
 #define SLI_MEM_POOL_OUT_OF_MEMORY     UINTPTR_MAX
 #define SLI_MEM_POOL_REQUIRED_PADDING(obj_size) (((sizeof(size_t) - ((obj_size) % sizeof(size_t))) % sizeof(size_t)))
 
+#if (SLI_MEM_POOL_LOCK_FREE == 1)
+// Free list head layout: ABA tag in the 16 MSBs, index of the first free block in the 16 LSBs.
+#define SLI_MEM_POOL_INDEX_MASK        0x0000FFFFUL
+#define SLI_MEM_POOL_TAG_INCREMENT     0x00010000UL
+#define SLI_MEM_POOL_INDEX_NONE        SLI_MEM_POOL_INDEX_MASK
+
+// Select the compare-and-swap implementation.
+#if defined(__ARM_FEATURE_LDREX) && ((__ARM_FEATURE_LDREX & 0x4) != 0)
+// Cortex-M with exclusive access instructions (ARMv7-M, ARMv8-M mainline).
+#include "cmsis_compiler.h"
+#define SLI_MEM_POOL_CAS_EXCLUSIVE
+#elif !defined(__arm__) && (defined(__GNUC__) || defined(__clang__))
+// Host build, using the C11 memory model atomic builtins.
+#define SLI_MEM_POOL_CAS_ATOMIC_BUILTIN
+#endif
+#endif
+
+#if (SLI_MEM_POOL_LOCK_FREE == 1)
+/***************************************************************************//**
+ * Atomically replaces the free list head if it still holds an expected value.
+ *
+ * @param[in] mem_pool  Pointer to memory pool handle.
+ * @param[in] expected  Expected free list head.
+ * @param[in] desired   New free list head.
+ *
+ * @return true if the free list head was replaced. false otherwise.
+ *
+ * @note On cores without exclusive access instructions (ARMv6-M), the
+ *       compare-and-swap falls back to a short atomic section.
+ ******************************************************************************/
+static bool mem_pool_compare_and_swap(sli_mem_pool_handle_t *mem_pool,
+                                      uint32_t expected,
+                                      uint32_t desired)
+{
+#if defined(SLI_MEM_POOL_CAS_EXCLUSIVE)
+  do {
+    if (__LDREXW((volatile uint32_t *)&mem_pool->free_head) != expected) {
+      __CLREX();
+      return false;
+    }
+  } while (__STREXW(desired, (volatile uint32_t *)&mem_pool->free_head) != 0U);
+  __DMB();
+  return true;
+#elif defined(SLI_MEM_POOL_CAS_ATOMIC_BUILTIN)
+  return __atomic_compare_exchange_n(&mem_pool->free_head,
+                                     &expected,
+                                     desired,
+                                     false,
+                                     __ATOMIC_ACQ_REL,
+                                     __ATOMIC_ACQUIRE);
+#else
+  bool swapped = false;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  if (mem_pool->free_head == expected) {
+    mem_pool->free_head = desired;
+    swapped = true;
+  }
+  CORE_EXIT_ATOMIC();
+
+  return swapped;
+#endif
+}
+
+/***************************************************************************//**
+ * Gets the address of a block from its index.
+ *
+ * @param[in] mem_pool  Pointer to memory pool handle.
+ * @param[in] index     Block index.
+ *
+ * @return Pointer to the block.
+ ******************************************************************************/
+static inline volatile uint32_t *mem_pool_get_block(const sli_mem_pool_handle_t *mem_pool,
+                                                    uint32_t index)
+{
+  return (volatile uint32_t *)((uint8_t *)mem_pool->data + (index * mem_pool->block_size));
+}
+#endif
+
 /***************************************************************************//**
  * Creates a memory pool
  ******************************************************************************/
@@ -54,7 +135,8 @@ void sli_mem_pool_create(sli_mem_pool_handle_t *mem_pool,
   EFM_ASSERT(block_size != 0);
   EFM_ASSERT(buffer_size >= block_count * (block_size + SLI_MEM_POOL_REQUIRED_PADDING(block_size)));
 
-  if ((mem_pool == NULL) || (buffer == NULL)) {
+  // An empty pool would make the free list construction below underflow.
+  if ((mem_pool == NULL) || (buffer == NULL) || (block_count == 0)) {
     EFM_ASSERT(false);
     return;
   }
@@ -62,6 +144,20 @@ void sli_mem_pool_create(sli_mem_pool_handle_t *mem_pool,
   mem_pool->block_size = block_size + (uint16_t)SLI_MEM_POOL_REQUIRED_PADDING(block_size);
   mem_pool->block_count = block_count;
   mem_pool->data = buffer;
+
+#if (SLI_MEM_POOL_LOCK_FREE == 1)
+  // The index of the next free block is saved in each free block. Index 0xFFFF is reserved for OOM.
+  EFM_ASSERT(block_count < SLI_MEM_POOL_INDEX_NONE);
+
+  for (uint32_t i = 0; i < (uint32_t)(block_count - 1); i++) {
+    *mem_pool_get_block(mem_pool, i) = i + 1;
+  }
+
+  // Last element will indicate OOM
+  *mem_pool_get_block(mem_pool, block_count - 1) = SLI_MEM_POOL_INDEX_NONE;
+
+  mem_pool->free_head = 0;
+#else
   mem_pool->free_block_addr = mem_pool->data;
 
   uint32_t block_addr = (uint32_t)mem_pool->data;
@@ -74,6 +170,7 @@ void sli_mem_pool_create(sli_mem_pool_handle_t *mem_pool,
 
   // Last element will indicate OOM
   *(uint32_t *)block_addr = SLI_MEM_POOL_OUT_OF_MEMORY;
+#endif
 }
 
 /***************************************************************************//**
@@ -81,13 +178,34 @@ void sli_mem_pool_create(sli_mem_pool_handle_t *mem_pool,
  ******************************************************************************/
 void* sli_mem_pool_alloc(sli_mem_pool_handle_t *mem_pool)
 {
-  CORE_DECLARE_IRQ_STATE;
-
   if (mem_pool == NULL) {
     EFM_ASSERT(false);
     return NULL;
   }
 
+#if (SLI_MEM_POOL_LOCK_FREE == 1)
+  uint32_t head;
+  uint32_t index;
+  uint32_t next;
+
+  do {
+    head = mem_pool->free_head;
+    index = head & SLI_MEM_POOL_INDEX_MASK;
+    if (index == SLI_MEM_POOL_INDEX_NONE) {
+      return NULL;
+    }
+
+    // The block may be popped and written by a concurrent owner before the swap below.
+    // The value read is then meaningless, but the tag change makes the swap fail.
+    next = *mem_pool_get_block(mem_pool, index) & SLI_MEM_POOL_INDEX_MASK;
+  } while (!mem_pool_compare_and_swap(mem_pool,
+                                      head,
+                                      ((head + SLI_MEM_POOL_TAG_INCREMENT) & ~SLI_MEM_POOL_INDEX_MASK) | next));
+
+  return (void *)mem_pool_get_block(mem_pool, index);
+#else
+  CORE_DECLARE_IRQ_STATE;
+
   CORE_ENTER_ATOMIC();
 
   if ((uint32_t)mem_pool->free_block_addr == SLI_MEM_POOL_OUT_OF_MEMORY) {
@@ -104,6 +222,7 @@ void* sli_mem_pool_alloc(sli_mem_pool_handle_t *mem_pool)
   CORE_EXIT_ATOMIC();
 
   return block_addr;
+#endif
 }
 
 /***************************************************************************//**
@@ -111,10 +230,25 @@ void* sli_mem_pool_alloc(sli_mem_pool_handle_t *mem_pool)
  ******************************************************************************/
 void sli_mem_pool_free(sli_mem_pool_handle_t *mem_pool, void *block)
 {
-  CORE_DECLARE_IRQ_STATE;
-
   EFM_ASSERT(mem_pool != NULL);
 
+#if (SLI_MEM_POOL_LOCK_FREE == 1)
+  uint32_t head;
+  uint32_t index = (uint32_t)(((uintptr_t)block - (uintptr_t)mem_pool->data) / mem_pool->block_size);
+
+  // Validate that the provided address is a block of the buffer
+  EFM_ASSERT((block >= mem_pool->data) && (index < mem_pool->block_count));
+
+  do {
+    head = mem_pool->free_head;
+    // Save the current free block index in this block
+    *(volatile uint32_t *)block = head & SLI_MEM_POOL_INDEX_MASK;
+  } while (!mem_pool_compare_and_swap(mem_pool,
+                                      head,
+                                      ((head + SLI_MEM_POOL_TAG_INCREMENT) & ~SLI_MEM_POOL_INDEX_MASK) | index));
+#else
+  CORE_DECLARE_IRQ_STATE;
+
   // Validate that the provided address is in the buffer range
   EFM_ASSERT((block >= mem_pool->data) && ((uint32_t)block <= ((uint32_t)mem_pool->data + (mem_pool->block_size * mem_pool->block_count))));
 
@@ -125,4 +259,5 @@ void sli_mem_pool_free(sli_mem_pool_handle_t *mem_pool, void *block)
   mem_pool->free_block_addr = block;
 
   CORE_EXIT_ATOMIC();
+#endif
 }
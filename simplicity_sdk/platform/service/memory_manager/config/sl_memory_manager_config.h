@@ -53,6 +53,22 @@
 // <i> Default: 1
 #define SL_MEMORY_MANAGER_POOL_DOUBLE_FREE_PROTECTION_ENABLE 1
 
+// <o SL_MEMORY_MANAGER_POOL_MAGAZINE_SIZE> Memory pool magazine size
+// <2-64:2>
+// <i> Number of free blocks a memory pool magazine can cache for the thread owning it.
+// <i> A magazine refills from and spills to its pool by batches of half this size, in a single atomic section.
+// <i> This setting has no effect on the memory pools power aware version.
+// <i> Default: 8
+#define SL_MEMORY_MANAGER_POOL_MAGAZINE_SIZE  (8)
+
+// <q SL_MEMORY_MANAGER_TLSF_INDEX_ENABLE> Enables the segregated free lists index.
+// <i> Setting this configuration to 1 will maintain a two-level segregated fit (TLSF) index of the free blocks
+// <i> of each heap. The free block search then takes a constant time instead of walking the heap blocks.
+// <i> Long-term blocks are still taken from the start of the found free block and short-term blocks from its end.
+// <i> The index costs about 470 bytes of RAM per heap (600 bytes on devices with more than 512 KB of RAM).
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_TLSF_INDEX_ENABLE 0
+
 // </h>
 
 // <<< end of configuration section >>>
@@ -35,6 +35,7 @@
 #include <stdint.h>
 
 #include "sl_memory_manager_region.h"
+#include "sl_memory_manager_config.h"
 #include "sl_status.h"
 
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
@@ -334,6 +335,32 @@ extern "C" {
  * }
  * @endcode
  *
+ * Each call to sl_memory_pool_alloc() and sl_memory_pool_free() enters an atomic
+ * section. When several threads allocate and free blocks of the same pool at a
+ * high rate, each thread can instead use a memory pool magazine of type
+ * @ref sl_memory_pool_magazine_t "sl_memory_pool_magazine_t{}". A magazine caches
+ * up to SL_MEMORY_MANAGER_POOL_MAGAZINE_SIZE free blocks of a pool for the thread
+ * owning it. It refills from and spills to the pool by batches, so most
+ * sl_memory_pool_magazine_alloc() and sl_memory_pool_magazine_free() calls do not
+ * enter an atomic section. A magazine must only be used by one thread and must
+ * be flushed with sl_memory_pool_magazine_flush() before its pool is deleted.
+ * @code{.c}
+ * sl_memory_pool_magazine_t magazine;
+ *
+ * // Called from the thread owning the magazine.
+ * status = sl_memory_pool_magazine_init(&pool1_handle, &magazine);
+ *
+ * status = sl_memory_pool_magazine_alloc(&magazine, (void **)&ptr8);
+ * if (status != SL_STATUS_OK) {
+ *   // Process the error condition.
+ * }
+ *
+ * status = sl_memory_pool_magazine_free(&magazine, ptr8);
+ *
+ * // Give the cached blocks back to the pool.
+ * status = sl_memory_pool_magazine_flush(&magazine);
+ * @endcode
+ *
  * ### Dynamic Reservation
  *
  * The dynamic reservation is a special construct allowing to reserve a block
@@ -567,6 +594,7 @@ struct sl_memory_heap_t {
   void *free_st_list_head;          ///< Short-term free blocks list head pointer.
   sl_memory_block_attrib_t attrib;  ///< Heap attributes.
   void *retention_control;          ///< Retention control handle.
+  void *free_index;                 ///< Segregated free lists index handle.
   sl_memory_heap_t *next_handle;    ///< Pointer to next heap handle.
 };
 
@@ -630,6 +658,15 @@ typedef struct sl_memory_pool {
   size_t block_size;                   ///< Size of each block.
 } sl_memory_pool_t;
 
+#if !defined(SL_MEMORY_POOL_POWER_AWARE)
+/// @brief Memory pool magazine handle.
+typedef struct sl_memory_pool_magazine {
+  sl_memory_pool_t *pool;                               ///< Pointer to pool handle the cached blocks belong to.
+  uint32_t block_count;                                 ///< Quantity of cached free blocks.
+  void *blocks[SL_MEMORY_MANAGER_POOL_MAGAZINE_SIZE];   ///< Cached free blocks.
+} sl_memory_pool_magazine_t;
+#endif
+
 // ----------------------------------------------------------------------------
 // PROTOTYPES
 
@@ -1051,6 +1088,64 @@ uint32_t sl_memory_pool_get_free_block_count(const sl_memory_pool_t *pool_handle
  ******************************************************************************/
 uint32_t sl_memory_pool_get_used_block_count(const sl_memory_pool_t *pool_handle);
 
+#if !defined(SL_MEMORY_POOL_POWER_AWARE)
+/***************************************************************************//**
+ * Initializes a memory pool magazine.
+ *
+ * @param[in] pool_handle   Handle to the memory pool.
+ * @param[in] magazine      Handle to the memory pool magazine.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note  The magazine starts empty. It takes blocks from the pool on the first
+ *        call to sl_memory_pool_magazine_alloc().
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_init(sl_memory_pool_t *pool_handle,
+                                         sl_memory_pool_magazine_t *magazine);
+
+/***************************************************************************//**
+ * Allocates a block from a memory pool magazine.
+ *
+ * @param[in]  magazine   Handle to the memory pool magazine.
+ * @param[out] block      Pointer to a variable that will receive the address
+ *                        of the allocated block. NULL if the pool is empty.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note  The magazine must only be used by the thread owning it.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_alloc(sl_memory_pool_magazine_t *magazine,
+                                          void **block);
+
+/***************************************************************************//**
+ * Frees a block to a memory pool magazine.
+ *
+ * @param[in] magazine  Handle to the memory pool magazine.
+ * @param[in] block     Pointer to the block to free. The block can have been
+ *                      allocated from the pool directly or from any magazine
+ *                      of that pool.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note  The magazine must only be used by the thread owning it.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_free(sl_memory_pool_magazine_t *magazine,
+                                         void *block);
+
+/***************************************************************************//**
+ * Gives all the blocks cached in a memory pool magazine back to its pool.
+ *
+ * @param[in] magazine  Handle to the memory pool magazine.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note  The blocks cached in magazines are not counted by
+ *        sl_memory_pool_get_free_block_count(). All the magazines of a pool
+ *        must be flushed before deleting the pool.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_flush(sl_memory_pool_magazine_t *magazine);
+#endif
+
 /***************************************************************************//**
  * Populates an sl_memory_heap_info_t{} structure with the current status of
  * the general-purpose heap.
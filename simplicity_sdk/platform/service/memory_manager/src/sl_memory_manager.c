@@ -694,7 +694,9 @@ sl_status_t sl_memory_heap_reserve_no_retention(sl_memory_heap_t *heap,
 
     // Update heap start metadata. Available heap size reduced from reserved block size aligned.
     data_payload_start = (void *)((uint8_t *)free_st_list_head + SLI_BLOCK_METADATA_SIZE_BYTE);
+    SLI_MEMORY_FREE_INDEX_REMOVE(heap, free_st_list_head);
     sli_block_len_dword_encode(free_st_list_head, ((uint64_t *)*block - (uint64_t *)data_payload_start));
+    SLI_MEMORY_FREE_INDEX_INSERT(heap, free_st_list_head);
 
     // Ensure there is still enough space after alignment. See Note #1.
     block_len_dw = sli_block_len_dword_decode(free_st_list_head);
@@ -847,6 +849,9 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
   // Prepare found block.
   allocated_blk = current_block_metadata;
 
+  // Found block is no longer free. It is indexed again below if it is split.
+  SLI_MEMORY_FREE_INDEX_REMOVE(heap, current_block_metadata);
+
   // Update counter of free blocks.
   heap->free_blocks_number--;
 
@@ -869,6 +874,7 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
       sli_memory_metadata_init(new_free_blk);
       block_len_dw = sli_block_len_dword_decode(current_block_metadata);
       sli_block_len_dword_encode(new_free_blk, (block_len_dw - SLI_BLOCK_LEN_BYTE_TO_DWORD(size_real + SLI_BLOCK_METADATA_SIZE_BYTE)));
+      SLI_MEMORY_FREE_INDEX_INSERT(heap, new_free_blk);
 
       sli_block_offset_prev_dword_encode(new_free_blk, SLI_BLOCK_LEN_BYTE_TO_DWORD(new_free_blk_offset));
 
@@ -917,6 +923,7 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
       // Update original found block which becomes a free block.
       new_free_blk = current_block_metadata;
       sli_block_len_dword_encode(new_free_blk, SLI_BLOCK_LEN_BYTE_TO_DWORD(block_size_remaining - SLI_BLOCK_METADATA_SIZE_BYTE));
+      SLI_MEMORY_FREE_INDEX_INSERT(heap, new_free_blk);
 
       sli_block_offset_next_dword_encode(new_free_blk, sli_block_offset_prev_dword_decode(allocated_blk));
 
@@ -1069,6 +1076,7 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
         && (reservations_size_prev == 0)) {
       // Merge current block to free with previous adjacent block.
       free_block = metadata_prev_blk;
+      SLI_MEMORY_FREE_INDEX_REMOVE(block_heap, free_block);
       total_size_free_block_dw += prev_blk_len_dw + SLI_BLOCK_METADATA_SIZE_DWORD;
 
       // 2 free blocks have been merged, account for 1 free block only.
@@ -1111,6 +1119,7 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
       DECREMENT_BANK_COUNTER(block_heap, (uint8_t*)next_block, (uint8_t*)next_block + SLI_BLOCK_METADATA_SIZE_BYTE - 1);
 
       // Merge block with next adjacent block.
+      SLI_MEMORY_FREE_INDEX_REMOVE(block_heap, next_block);
       block_len_dw = sli_block_len_dword_decode(next_block);
       total_size_free_block_dw += block_len_dw + SLI_BLOCK_METADATA_SIZE_DWORD;
       // Invalidate the next block metadata.
@@ -1133,6 +1142,7 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
   // Update accordingly the metadata block considered as free.
   sli_block_len_dword_encode(free_block, (total_size_free_block_dw - SLI_BLOCK_METADATA_SIZE_DWORD));
   free_block->block_in_use = 0;
+  SLI_MEMORY_FREE_INDEX_INSERT(block_heap, free_block);
   if (next_block != NULL) {
     // Update implicit double linked-list.
     sli_block_offset_next_dword_encode(free_block, SLI_BLOCK_LEN_BYTE_TO_DWORD((size_t)next_block - (size_t)free_block));
@@ -1318,6 +1328,7 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
 
         // Remove free block metadata from bank counter as free block will be merged with adjacent block or removed.
         DECREMENT_BANK_COUNTER(heap, (uint8_t*)next_block, (uint8_t*)next_block + SLI_BLOCK_METADATA_SIZE_BYTE - 1);
+        SLI_MEMORY_FREE_INDEX_REMOVE(heap, next_block);
 
         if (next_block_len_remaining >= SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE) {
           // Enough space left in next block to leave a smaller free block.
@@ -1351,6 +1362,7 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
           sli_update_free_list_heads(heap, adjusted_next_block, next_block, false);
           // Ensure old next block metadata is invalid.
           sli_memory_metadata_init(next_block);
+          SLI_MEMORY_FREE_INDEX_INSERT(heap, adjusted_next_block);
         } else {
           // Not enough space in next block, simply append all next block to current one
           // by updating all required blocks' metadata.
@@ -1464,6 +1476,8 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
         // Compute adjusted adjacent free block location.
         sli_block_metadata_t *adjusted_next_block = (sli_block_metadata_t *)((uint8_t *)current_block + SLI_BLOCK_METADATA_SIZE_BYTE + size_real);
 
+        SLI_MEMORY_FREE_INDEX_REMOVE(heap, next_block);
+
         // Update all relevant metadata fields of current block, next block, next next block (if applicable).
         sli_block_len_dword_encode(current_block, SLI_BLOCK_LEN_BYTE_TO_DWORD(size_real));
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
@@ -1498,6 +1512,9 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
 
         // Ensure old next block metadata is invalid.
         sli_memory_metadata_init(next_block);
+
+        // Index the merged free block once the old next block metadata, which may lie in its data payload, is cleared.
+        SLI_MEMORY_FREE_INDEX_INSERT(heap, adjusted_next_block);
       } else {
         // Next block is in use and cannot be merged with the newly unallocated portion.
         create_new_block = true;
@@ -1522,6 +1539,7 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
         sli_memory_metadata_init(adjusted_next_block);
         sli_block_len_dword_encode(adjusted_next_block, SLI_BLOCK_LEN_BYTE_TO_DWORD(current_block_remaining_len - SLI_BLOCK_METADATA_SIZE_BYTE));
         sli_block_offset_prev_dword_encode(adjusted_next_block, sli_block_offset_next_dword_decode(current_block));
+        SLI_MEMORY_FREE_INDEX_INSERT(heap, adjusted_next_block);
 
         // Increment bank counter for new free block metadata.
         INCREMENT_BANK_COUNTER(heap, (uint8_t *)adjusted_next_block, (uint8_t *)adjusted_next_block + SLI_BLOCK_METADATA_SIZE_BYTE - 1);
@@ -1808,7 +1826,13 @@ static sli_block_metadata_t *memory_manage_data_alignment(sl_memory_heap_t *heap
     // Merge lost space because of the alignment into the previous block. It helps to keep
     // all computations in malloc()/free() valid. For ST split block, the lost space is back into
     // a free block space.
+    if (prev_block->block_in_use == 0) {
+      SLI_MEMORY_FREE_INDEX_REMOVE(heap, prev_block);
+    }
     sli_block_len_dword_encode(prev_block, (block_len_dw + align_offset));
+    if (prev_block->block_in_use == 0) {
+      SLI_MEMORY_FREE_INDEX_INSERT(heap, prev_block);
+    }
   } else {
     // Special case where the block data payload being aligned is at the heap start. A special flag in the block metadata
     // is used to identify this special block in sl_memory_free() and accordingly perform the merge with previous adjacent block.
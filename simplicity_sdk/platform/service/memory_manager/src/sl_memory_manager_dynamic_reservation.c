@@ -141,6 +141,7 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
     if ((prev_block->block_in_use == 0) && (reserved_block_offset < SLI_BLOCK_RESERVATION_MIN_SIZE_DWORD)) {
       // New freed block's previous block is free, so merge both free blocks.
       new_free_block = prev_block;
+      SLI_MEMORY_FREE_INDEX_REMOVE(heap, new_free_block);
       prev_block = (prev_block == heap->base_addr)
                    ? NULL
                    : (sli_block_metadata_t *)((uint64_t *)prev_block - sli_block_offset_prev_dword_decode(prev_block));
@@ -165,6 +166,7 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
     if ((next_block->block_in_use == 0) && (reserved_block_offset < SLI_BLOCK_RESERVATION_MIN_SIZE_DWORD)) {
       // New freed block's following block is free, so merge both free blocks.
       new_free_block_length += sli_block_len_dword_decode(next_block) + reserved_block_offset + SLI_BLOCK_METADATA_SIZE_DWORD;
+      SLI_MEMORY_FREE_INDEX_REMOVE(heap, next_block);
       // Invalidate the next block metadata.
       sli_block_len_dword_encode(next_block, 0);
       // 2 free blocks have been merged, account for 1 free block only.
@@ -183,6 +185,7 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
   // Update the new free metadata block accordingly.
   sli_memory_metadata_init(new_free_block);
   sli_block_len_dword_encode(new_free_block, new_free_block_length);
+  SLI_MEMORY_FREE_INDEX_INSERT(heap, new_free_block);
 
   if (next_block != NULL) {
     sli_block_offset_next_dword_encode(new_free_block, ((uint64_t *)next_block - (uint64_t *)new_free_block));
@@ -358,6 +361,9 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
   // SLI_BLOCK_METADATA_SIZE_BYTE is added to the free block length to get the real remaining size as size_adjusted contains the metadata size.
   block_size_remaining = (current_block_len + SLI_BLOCK_METADATA_SIZE_BYTE) - size_adjusted;
 
+  // Found block is no longer free. It is indexed again below if it is split.
+  SLI_MEMORY_FREE_INDEX_REMOVE(heap, free_block_metadata);
+
   heap->free_blocks_number--;
 
   // Split free and reserved blocks if possible.
@@ -366,6 +372,7 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
 
     // Changes size of free block.
     sli_block_len_dword_encode(free_block_metadata, (block_len_dw - SLI_BLOCK_LEN_BYTE_TO_DWORD(size_adjusted)));
+    SLI_MEMORY_FREE_INDEX_INSERT(heap, free_block_metadata);
 
     // Create a new block = reserved block returned to requester. This new block is the nearest to the heap end.
     reserved_blk = (sli_block_metadata_t *)((uint8_t *)free_block_metadata + block_size_remaining);
@@ -50,6 +50,9 @@
 #define SLI_MEM_POOL_OUT_OF_MEMORY     UINTPTR_MAX
 #define SLI_MEM_POOL_REQUIRED_PADDING(obj_size) (((sizeof(size_t) - ((obj_size) % sizeof(size_t))) % sizeof(size_t)))
 
+// Quantity of blocks moved between a magazine and its pool in one atomic section.
+#define SLI_MEM_POOL_MAGAZINE_BATCH_SIZE  (SL_MEMORY_MANAGER_POOL_MAGAZINE_SIZE / 2)
+
 #if (defined(SL_MEMORY_MANAGER_POOL_DOUBLE_FREE_PROTECTION_ENABLE) && (SL_MEMORY_MANAGER_POOL_DOUBLE_FREE_PROTECTION_ENABLE == 1))
 /***************************************************************************//**
  * Checks if a value looks like a valid free list pointer.
@@ -112,6 +115,71 @@ static bool sli_block_is_in_free_list(const sl_memory_pool_t *pool_handle,
   return false;
 }
 #endif // (defined(SL_MEMORY_MANAGER_POOL_DOUBLE_FREE_PROTECTION_ENABLE) && (SL_MEMORY_MANAGER_POOL_DOUBLE_FREE_PROTECTION_ENABLE == 1))
+
+/***************************************************************************//**
+ * Moves a batch of free blocks from the pool to an empty magazine.
+ *
+ * @param[in] magazine  Pointer to the memory pool magazine handle.
+ ******************************************************************************/
+static void sli_magazine_refill(sl_memory_pool_magazine_t *magazine)
+{
+  sl_memory_pool_t *pool_handle = magazine->pool;
+  uint32_t block_count = 0;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+
+  while ((block_count < SLI_MEM_POOL_MAGAZINE_BATCH_SIZE)
+         && ((size_t)pool_handle->block_free != SLI_MEM_POOL_OUT_OF_MEMORY)) {
+    void *block_addr = pool_handle->block_free;
+
+    pool_handle->block_free = (void *)*(size_t *)block_addr;
+    magazine->blocks[block_count] = block_addr;
+    block_count++;
+  }
+
+  CORE_EXIT_ATOMIC();
+
+  magazine->block_count = block_count;
+}
+
+/***************************************************************************//**
+ * Moves the most recently cached blocks of a magazine back to the pool.
+ *
+ * @param[in] magazine     Pointer to the memory pool magazine handle.
+ * @param[in] block_count  Quantity of blocks to move.
+ *
+ * @note The blocks are chained together before entering the atomic section
+ *       so that the pool free list is updated in constant time.
+ ******************************************************************************/
+static void sli_magazine_spill(sl_memory_pool_magazine_t *magazine,
+                               uint32_t block_count)
+{
+  sl_memory_pool_t *pool_handle = magazine->pool;
+  uint32_t first = magazine->block_count - block_count;
+  void *head;
+  void *tail;
+  CORE_DECLARE_IRQ_STATE;
+
+  if (block_count == 0) {
+    return;
+  }
+
+  head = magazine->blocks[first];
+  tail = magazine->blocks[magazine->block_count - 1];
+
+  for (uint32_t i = first; i < (magazine->block_count - 1); i++) {
+    *(size_t *)magazine->blocks[i] = (size_t)magazine->blocks[i + 1];
+  }
+
+  CORE_ENTER_ATOMIC();
+  *(size_t *)tail = (size_t)pool_handle->block_free;
+  pool_handle->block_free = head;
+  CORE_EXIT_ATOMIC();
+
+  magazine->block_count = first;
+}
+
 /***************************************************************************//**
  * Creates a memory pool.
  ******************************************************************************/
@@ -366,3 +434,138 @@ sl_status_t sl_memory_heap_create_pool(sl_memory_heap_t *heap,
 
   return status;
 }
+
+/***************************************************************************//**
+ * Initializes a memory pool magazine.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_init(sl_memory_pool_t *pool_handle,
+                                         sl_memory_pool_magazine_t *magazine)
+{
+  if ((pool_handle == NULL) || (magazine == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  magazine->pool = pool_handle;
+  magazine->block_count = 0;
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Allocates a block from a memory pool magazine.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_alloc(sl_memory_pool_magazine_t *magazine,
+                                          void **block)
+{
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+  void * volatile return_address = sli_memory_profiler_get_return_address();
+#endif
+
+  if ((magazine == NULL) || (magazine->pool == NULL) || (block == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  // No block allocated yet.
+  *block = NULL;
+
+  if (magazine->block_count == 0) {
+    sli_magazine_refill(magazine);
+  }
+
+  if (magazine->block_count == 0) {
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+    sli_memory_profiler_track_alloc_with_ownership(magazine->pool, NULL, magazine->pool->block_size, return_address);
+#endif
+    return SL_STATUS_EMPTY;
+  }
+
+  magazine->block_count--;
+  void *block_addr = magazine->blocks[magazine->block_count];
+
+#if defined(MEMORY_MANAGER_TEST_CONDITIONS)
+  // Clear the first word of the allocated block so it doesn't look like
+  // a free list pointer. See sl_memory_pool_alloc().
+  *(size_t *)block_addr = 0;
+#endif
+
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+  sli_memory_profiler_track_alloc_with_ownership(magazine->pool, block_addr, magazine->pool->block_size, return_address);
+#endif
+
+  *block = block_addr;
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Frees a block to a memory pool magazine.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_free(sl_memory_pool_magazine_t *magazine,
+                                         void *block)
+{
+  sl_memory_pool_t *pool_handle;
+
+  if ((magazine == NULL) || (magazine->pool == NULL) || (block == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  pool_handle = magazine->pool;
+
+  // Validate that the provided address is in the pool payload range.
+  if ((block < pool_handle->block_address)
+      || ((size_t)block >= ((size_t)pool_handle->block_address + (pool_handle->block_size * pool_handle->block_count)))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+#if (defined(SL_MEMORY_MANAGER_POOL_DOUBLE_FREE_PROTECTION_ENABLE) && (SL_MEMORY_MANAGER_POOL_DOUBLE_FREE_PROTECTION_ENABLE == 1))
+  // The blocks cached in this magazine are checked without any atomic section.
+  for (uint32_t i = 0; i < magazine->block_count; i++) {
+    if (magazine->blocks[i] == block) {
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+  }
+
+  // Same hybrid check as sl_memory_pool_free() for the blocks in the pool free list.
+  // Blocks cached in other magazines are not detected.
+  if (sli_looks_like_free_list_ptr(pool_handle, *(size_t *)block)) {
+    bool is_free;
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    is_free = sli_block_is_in_free_list(pool_handle, block);
+    CORE_EXIT_ATOMIC();
+
+    if (is_free) {
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+  }
+#endif // (defined(SL_MEMORY_MANAGER_POOL_DOUBLE_FREE_PROTECTION_ENABLE) && (SL_MEMORY_MANAGER_POOL_DOUBLE_FREE_PROTECTION_ENABLE == 1))
+
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+  sli_memory_profiler_track_free(pool_handle, block);
+#endif
+
+  // Keep room for this block and the next ones by giving half of the cached blocks back to the pool.
+  if (magazine->block_count == SL_MEMORY_MANAGER_POOL_MAGAZINE_SIZE) {
+    sli_magazine_spill(magazine, SLI_MEM_POOL_MAGAZINE_BATCH_SIZE);
+  }
+
+  magazine->blocks[magazine->block_count] = block;
+  magazine->block_count++;
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Gives all the blocks cached in a memory pool magazine back to its pool.
+ ******************************************************************************/
+sl_status_t sl_memory_pool_magazine_flush(sl_memory_pool_magazine_t *magazine)
+{
+  if ((magazine == NULL) || (magazine->pool == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  sli_magazine_spill(magazine, magazine->block_count);
+
+  return SL_STATUS_OK;
+}
@@ -106,6 +106,26 @@ extern "C" {
 #define SLI_MEMORY_MANAGER_SUPPORT_ALLOCATION_FALLBACK
 #endif
 
+#if defined(SL_MEMORY_MANAGER_TLSF_INDEX_ENABLE) && (SL_MEMORY_MANAGER_TLSF_INDEX_ENABLE == 1)
+// Internal define for the two-level segregated fit (TLSF) index of free blocks.
+#define SLI_MEMORY_MANAGER_TLSF_INDEX
+#endif
+
+// TLSF index geometry. Block lengths are classified in double words. The first level is the
+// power of 2 of the length, the second level splits each power of 2 range in linear sub-ranges.
+// Lengths smaller than the second level count are all classified in the first level 0.
+#define SLI_TLSF_SL_INDEX_COUNT_LOG2    3u
+#define SLI_TLSF_SL_INDEX_COUNT         (1u << SLI_TLSF_SL_INDEX_COUNT_LOG2)
+#if defined(SLI_LARGE_BLOCK_SUPPORT)
+#define SLI_TLSF_LEN_DWORD_NBR_BITS     20u
+#else
+#define SLI_TLSF_LEN_DWORD_NBR_BITS     16u
+#endif
+#define SLI_TLSF_FL_INDEX_COUNT         (SLI_TLSF_LEN_DWORD_NBR_BITS - SLI_TLSF_SL_INDEX_COUNT_LOG2 + 1u)
+
+// Value of a TLSF free list link that does not point to any block.
+#define SLI_TLSF_LINK_NONE              0xFFFFFFFFu
+
 // Masks for extracting block type and attributes from allocation parameters
 #define SLI_MEMORY_BLOCK_TYPE_MASK         0x00000001U
 #define SLI_MEMORY_BLOCK_ATTRIBUTE_MASK    0xFFFFFFFEU
@@ -157,6 +177,14 @@ extern "C" {
 #define DECREMENT_BANK_COUNTER(heap, start_addr, end_addr) (void)heap
 #endif
 
+#if defined(SLI_MEMORY_MANAGER_TLSF_INDEX)
+#define SLI_MEMORY_FREE_INDEX_INSERT(heap, block) sli_memory_free_index_insert(heap, block)
+#define SLI_MEMORY_FREE_INDEX_REMOVE(heap, block) sli_memory_free_index_remove(heap, block)
+#else
+#define SLI_MEMORY_FREE_INDEX_INSERT(heap, block) (void)heap
+#define SLI_MEMORY_FREE_INDEX_REMOVE(heap, block) (void)heap
+#endif
+
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
 #define SLI_MEMORY_STAT_HEAP_INCREASE(_heap, _inc)          \
   do {                                                      \
@@ -201,6 +229,21 @@ typedef struct {
   uint16_t offset_neighbour_next;         // Offset to next neighbor, in double words.
 } sli_block_metadata_t;
 
+// Links of a free block in its TLSF free list. The links are stored in the free block data payload
+// right after the metadata, so they don't increase the metadata size. Links are offsets from the
+// heap base address, in double words. The smallest free block payload (1 double word) can hold them.
+typedef struct {
+  uint32_t prev;                          // Offset of previous free block in the same size class.
+  uint32_t next;                          // Offset of next free block in the same size class.
+} sli_free_block_links_t;
+
+// TLSF index of the free blocks of a heap.
+typedef struct {
+  uint32_t fl_bitmap;                                                         // Non-empty first level classes.
+  uint8_t sl_bitmap[SLI_TLSF_FL_INDEX_COUNT];                                 // Non-empty second level classes.
+  uint32_t list_head[SLI_TLSF_FL_INDEX_COUNT][SLI_TLSF_SL_INDEX_COUNT];       // Free lists heads offsets.
+} sli_memory_free_index_t;
+
 /// @brief Pool free count list structure.
 struct sli_memory_pool_free_cnt_entry {
   uint16_t free_cnt;                      ///< The number of free blocks available in this free count entry.
@@ -335,6 +378,32 @@ void sli_update_free_list_heads(sl_memory_heap_t *heap,
                                 const sli_block_metadata_t *condition_block,
                                 bool search);
 
+#if defined(SLI_MEMORY_MANAGER_TLSF_INDEX)
+/***************************************************************************//**
+ * Inserts a free block in the segregated free lists index of a heap.
+ *
+ * @param[in]  heap   Heap handle.
+ * @param[in]  block  Pointer to free block metadata.
+ *
+ * @note  Free blocks with an empty data payload are not indexed.
+ ******************************************************************************/
+void sli_memory_free_index_insert(sl_memory_heap_t *heap,
+                                  sli_block_metadata_t *block);
+
+/***************************************************************************//**
+ * Removes a free block from the segregated free lists index of a heap.
+ *
+ * @param[in]  heap   Heap handle.
+ * @param[in]  block  Pointer to free block metadata.
+ *
+ * @note  The block length must be the same as when the block was inserted.
+ *        A free block must be removed before its length is changed, and
+ *        inserted again afterwards.
+ ******************************************************************************/
+void sli_memory_free_index_remove(sl_memory_heap_t *heap,
+                                  sli_block_metadata_t *block);
+#endif
+
 /***************************************************************************//**
  * Creates a new heap instance.
  *
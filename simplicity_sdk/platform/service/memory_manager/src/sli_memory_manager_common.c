@@ -77,10 +77,251 @@ sl_memory_reservation_t *sli_reservation_handle_ptr_table[SLI_MAX_RESERVATION_CO
 sl_memory_reservation_t sli_reservation_no_retention_table[SLI_MAX_RESERVATION_COUNT] = { 0 };
 #endif
 
+#if defined(SLI_MEMORY_MANAGER_TLSF_INDEX)
+// Free blocks indexes, one per heap type.
+static sli_memory_free_index_t sli_general_purpose_heap_free_index SL_FAST_DATA;
+#if defined(SL_CATALOG_MEMORY_MANAGER_PSRAM_PRESENT)
+static sli_memory_free_index_t sli_psram_heap_free_index SL_FAST_DATA;
+#endif
+#if defined(SL_CATALOG_MEMORY_MANAGER_DTCM_PRESENT)
+static sli_memory_free_index_t sli_dtcm_heap_free_index SL_FAST_DATA;
+#endif
+#endif
+
 /*******************************************************************************
  ***************************   LOCAL FUNCTIONS   *******************************
  ******************************************************************************/
 
+/***************************************************************************//**
+ * Checks if a free block can hold a block of a given size and alignment.
+ *
+ * @param[in]  block              Pointer to free block metadata.
+ * @param[in]  size               Size of the block, in bytes.
+ * @param[in]  block_align        Required alignment for the block, in bytes.
+ * @param[in]  type               Type of block (long-term or short term).
+ * @param[in]  block_reservation  Indicates if the free block is for a dynamic
+ *                                reservation.
+ * @param[out] size_adjusted      Size of the block adjusted with the alignment.
+ *
+ * @return     true if the free block fits. false otherwise.
+ ******************************************************************************/
+static bool memory_block_fit(sli_block_metadata_t *block,
+                             size_t size,
+                             size_t block_align,
+                             sl_memory_block_type_t type,
+                             bool block_reservation,
+                             size_t *size_adjusted)
+{
+  void *data_payload = NULL;
+  size_t block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(block));
+  size_t data_payload_offset;
+  bool is_aligned = false;
+
+  // For a block reservation, add the metadata's size to the free blocks' available memory space.
+  block_len += block_reservation ? SLI_BLOCK_METADATA_SIZE_BYTE : 0;
+
+  if ((block->block_in_use) || (block_len < size)) {
+    return false;
+  }
+
+  if (type == BLOCK_TYPE_LONG_TERM) {
+    // Check alignment requested and ensure size of found block can accommodate worst case alignment.
+    // For LT, alignment requirement can be verified here whether the block is split or not.
+    data_payload = (void *)((uint8_t *)block + SLI_BLOCK_METADATA_SIZE_BYTE);
+    is_aligned = SLI_ADDR_IS_ALIGNED(data_payload, block_align);
+    data_payload_offset = (uintptr_t)data_payload % block_align;
+
+    if (is_aligned || (block_len >= (size + data_payload_offset))) {
+      // Compute remaining block size given an alignment handling or not.
+      *size_adjusted = is_aligned ? size : (size + data_payload_offset);
+      return true;
+    }
+  } else {
+    if (block_align == SLI_BLOCK_ALLOC_MIN_ALIGN) {
+      // If alignment is 8 bytes (default min alignment), take the requested adjusted size.
+      *size_adjusted = size;
+    } else {
+      // If non 8-byte alignment, search the more optimized size accounting for the required alignment.
+      uint8_t *block_end = (uint8_t *)((uint64_t *)block + SLI_BLOCK_METADATA_SIZE_DWORD + sli_block_len_dword_decode(block));
+
+      data_payload = (void *)(block_end - size);
+      data_payload = (void *)SLI_ALIGN_ROUND_DOWN(((uintptr_t)data_payload), block_align);
+      *size_adjusted = (size_t)(block_end - (uint8_t *)data_payload);
+    }
+
+    if (block_len >= *size_adjusted) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+#if defined(SLI_MEMORY_MANAGER_TLSF_INDEX)
+/***************************************************************************//**
+ * Gets the position of the most significant bit set.
+ *
+ * @param[in]  value  Non-zero value.
+ *
+ * @return     Position of the most significant bit set.
+ ******************************************************************************/
+__STATIC_INLINE uint32_t memory_free_index_fls(uint32_t value)
+{
+  return (SLI_DEF_INT_32_NBR_BITS - 1u) - __CLZ(value);
+}
+
+/***************************************************************************//**
+ * Gets the TLSF size class of a block length.
+ *
+ * @param[in]  len_dw  Block length, in double words.
+ * @param[out] fl      First level index.
+ * @param[out] sl      Second level index.
+ ******************************************************************************/
+static void memory_free_index_mapping(uint32_t len_dw,
+                                      uint32_t *fl,
+                                      uint32_t *sl)
+{
+  if (len_dw < SLI_TLSF_SL_INDEX_COUNT) {
+    // Small lengths are linearly classified in the first level 0.
+    *fl = 0;
+    *sl = len_dw;
+  } else {
+    uint32_t msb = memory_free_index_fls(len_dw);
+
+    *fl = msb - SLI_TLSF_SL_INDEX_COUNT_LOG2 + 1u;
+    *sl = (len_dw >> (msb - SLI_TLSF_SL_INDEX_COUNT_LOG2)) ^ SLI_TLSF_SL_INDEX_COUNT;
+  }
+}
+
+/***************************************************************************//**
+ * Gets the links of a free block.
+ *
+ * @param[in]  block  Pointer to free block metadata.
+ *
+ * @return     Pointer to the free block links stored in its data payload.
+ ******************************************************************************/
+__STATIC_INLINE sli_free_block_links_t *memory_free_index_links(sli_block_metadata_t *block)
+{
+  return (sli_free_block_links_t *)((uint8_t *)block + SLI_BLOCK_METADATA_SIZE_BYTE);
+}
+
+/***************************************************************************//**
+ * Converts a free list link to a block metadata pointer.
+ *
+ * @param[in]  heap  Heap handle.
+ * @param[in]  link  Offset from the heap base address, in double words.
+ *
+ * @return     Pointer to block metadata.
+ ******************************************************************************/
+__STATIC_INLINE sli_block_metadata_t *memory_free_index_link_to_block(const sl_memory_heap_t *heap,
+                                                                      uint32_t link)
+{
+  return (sli_block_metadata_t *)((uint64_t *)heap->base_addr + link);
+}
+
+/***************************************************************************//**
+ * Finds a free block with a length of at least the requested length.
+ *
+ * @param[in]  heap    Heap handle.
+ * @param[in]  len_dw  Requested length, in double words.
+ * @param[in]  type    Type of block (long-term or short-term).
+ *
+ * @return     Pointer to free block metadata. NULL if no block is large enough.
+ *
+ * @note (1) The requested length is rounded up to the next size class so that
+ *           any block of the found class is large enough (good-fit). This keeps
+ *           the search to a few bitmap operations.
+ *
+ * @note (2) Like the first-fit search, long-term blocks are placed as close as
+ *           possible to the heap start and short-term blocks as close as
+ *           possible to the heap end. The blocks of the found size class are
+ *           walked to pick the one with the lowest (long-term) or highest
+ *           (short-term) address.
+ ******************************************************************************/
+static sli_block_metadata_t *memory_free_index_search(const sl_memory_heap_t *heap,
+                                                      uint32_t len_dw,
+                                                      sl_memory_block_type_t type)
+{
+  const sli_memory_free_index_t *index = (const sli_memory_free_index_t *)heap->free_index;
+  uint32_t fl;
+  uint32_t sl;
+  uint32_t sl_map;
+  uint32_t link;
+  uint32_t best_link;
+
+  // Round up the length to the next size class. See Note #1.
+  if (len_dw >= SLI_TLSF_SL_INDEX_COUNT) {
+    len_dw += (1u << (memory_free_index_fls(len_dw) - SLI_TLSF_SL_INDEX_COUNT_LOG2)) - 1u;
+  }
+  memory_free_index_mapping(len_dw, &fl, &sl);
+  if (fl >= SLI_TLSF_FL_INDEX_COUNT) {
+    return NULL;
+  }
+
+  // Search a non-empty list in the same first level, then in the next first levels.
+  sl_map = index->sl_bitmap[fl] & (0xFFu << sl);
+  if (sl_map == 0) {
+    uint32_t fl_map = index->fl_bitmap & (0xFFFFFFFFu << (fl + 1u));
+
+    if (fl_map == 0) {
+      return NULL;
+    }
+    fl = SL_CTZ(fl_map);
+    sl_map = index->sl_bitmap[fl];
+  }
+  sl = SL_CTZ(sl_map);
+
+  // Keep the long-term/short-term placement among the blocks of the size class. See Note #2.
+  // Links are offsets from the heap base, so they compare like the block addresses.
+  best_link = index->list_head[fl][sl];
+  link = memory_free_index_links(memory_free_index_link_to_block(heap, best_link))->next;
+  while (link != SLI_TLSF_LINK_NONE) {
+    if ((type == BLOCK_TYPE_LONG_TERM) ? (link < best_link) : (link > best_link)) {
+      best_link = link;
+    }
+    link = memory_free_index_links(memory_free_index_link_to_block(heap, link))->next;
+  }
+
+  return memory_free_index_link_to_block(heap, best_link);
+}
+
+/***************************************************************************//**
+ * Initializes the free lists index of a heap.
+ *
+ * @param[in]  heap  Heap handle.
+ ******************************************************************************/
+static void memory_free_index_init(sl_memory_heap_t *heap)
+{
+  sli_memory_free_index_t *index;
+
+  switch (heap->attrib) {
+#if defined(SL_CATALOG_MEMORY_MANAGER_PSRAM_PRESENT)
+    case SL_MEMORY_HEAP_ALLOC_EXTERNAL_RAM:
+      index = &sli_psram_heap_free_index;
+      break;
+#endif
+#if defined(SL_CATALOG_MEMORY_MANAGER_DTCM_PRESENT)
+    case SL_MEMORY_HEAP_ALLOC_CPU_RAM:
+      index = &sli_dtcm_heap_free_index;
+      break;
+#endif
+    default:
+      index = &sli_general_purpose_heap_free_index;
+      break;
+  }
+
+  index->fl_bitmap = 0;
+  for (uint32_t fl = 0; fl < SLI_TLSF_FL_INDEX_COUNT; fl++) {
+    index->sl_bitmap[fl] = 0;
+    for (uint32_t sl = 0; sl < SLI_TLSF_SL_INDEX_COUNT; sl++) {
+      index->list_head[fl][sl] = SLI_TLSF_LINK_NONE;
+    }
+  }
+
+  heap->free_index = (void *)index;
+}
+#endif
+
 #if defined(SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES)
 /***************************************************************************//**
  * Gets the index in sli_reservation_handle_ptr_table[] by block address.
@@ -198,6 +439,14 @@ void sli_memory_metadata_init(sli_block_metadata_t *block_metadata)
  *           alignment (size_real + block_align) cannot be taken by default
  *           as it may imply loosing too many bytes in internal fragmentation
  *           due to the alignment requirement.
+ *
+ * @note (3) When the segregated free lists index is enabled, the block is
+ *           searched in the index with the worst alignment size. Any block
+ *           returned by the index can then hold the requested size whatever
+ *           its address. Among the blocks of the found size class, the one
+ *           closest to the heap start (long-term) or end (short-term) is
+ *           used, and the type selects which end of that block is used by the
+ *           caller.
  ******************************************************************************/
 size_t sli_memory_find_free_block(sl_memory_heap_t *heap,
                                   size_t size,
@@ -207,59 +456,34 @@ size_t sli_memory_find_free_block(sl_memory_heap_t *heap,
                                   sli_block_metadata_t **block)
 {
   sli_block_metadata_t *current_block_metadata = NULL;
-  sli_block_metadata_t *free_lt_list_head = (sli_block_metadata_t *)heap->free_lt_list_head;
-  sli_block_metadata_t *free_st_list_head = (sli_block_metadata_t *)heap->free_st_list_head;
-  void *data_payload = NULL;
   size_t size_adjusted = 0;
-  size_t current_block_len;
   size_t block_align = (align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? SLI_BLOCK_ALLOC_MIN_ALIGN : align;
-  size_t data_payload_offset;
-  bool is_aligned = false;
 
   *block = NULL;
 
-  current_block_metadata = (type == BLOCK_TYPE_LONG_TERM) ? free_lt_list_head : free_st_list_head;
-  if (current_block_metadata == NULL) {
-    return 0;
-  }
+#if defined(SLI_MEMORY_MANAGER_TLSF_INDEX)
+  // Search the segregated free lists for a block that fits the worst case alignment. See Note #3.
+  size_t size_worst = size + (block_align - SLI_BLOCK_ALLOC_MIN_ALIGN);
 
-  current_block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(current_block_metadata));
+  size_worst -= block_reservation ? SLI_BLOCK_METADATA_SIZE_BYTE : 0;
+  current_block_metadata = memory_free_index_search(heap, (uint32_t)SLI_BLOCK_LEN_BYTE_TO_DWORD(size_worst), type);
+  if ((current_block_metadata != NULL)
+      && memory_block_fit(current_block_metadata, size, block_align, type, block_reservation, &size_adjusted)) {
+    *block = current_block_metadata;
+    return size_adjusted;
+  }
+  // No free block larger than the worst case. Fall back on the first-fit search below,
+  // as a block of a smaller size class may still fit the exact alignment.
+#endif
 
-  // For a block reservation, add the metadata's size to the free blocks' available memory space. See Note #2.
-  current_block_len += block_reservation ? SLI_BLOCK_METADATA_SIZE_BYTE : 0;
+  current_block_metadata = (type == BLOCK_TYPE_LONG_TERM)
+                           ? (sli_block_metadata_t *)heap->free_lt_list_head
+                           : (sli_block_metadata_t *)heap->free_st_list_head;
 
   // Try to find a block to allocate (first-fit).
   while (current_block_metadata != NULL) {
-    if ((!current_block_metadata->block_in_use) && (current_block_len >= size)) {
-      if (type == BLOCK_TYPE_LONG_TERM) {
-        // Check alignment requested and ensure size of found block can accommodate worst case alignment.
-        // For LT, alignment requirement can be verified here whether the block is split or not.
-        data_payload = (void *)((uint8_t *)current_block_metadata + SLI_BLOCK_METADATA_SIZE_BYTE);
-        is_aligned = SLI_ADDR_IS_ALIGNED(data_payload, block_align);
-        data_payload_offset = (uintptr_t)data_payload % block_align;
-
-        if (is_aligned || (current_block_len >= (size + data_payload_offset))) {
-          // Compute remaining block size given an alignment handling or not.
-          size_adjusted = is_aligned ? size : (size + data_payload_offset);
-          break;
-        }
-      } else {
-        if (block_align == SLI_BLOCK_ALLOC_MIN_ALIGN) {
-          // If alignment is 8 bytes (default min alignment), take the requested adjusted size.
-          size_adjusted = size;
-        } else {
-          // If non 8-byte alignment, search the more optimized size accounting for the required alignment. See Note #3.
-          uint8_t *block_end = (uint8_t *)((uint64_t *)current_block_metadata + SLI_BLOCK_METADATA_SIZE_DWORD + sli_block_len_dword_decode(current_block_metadata));
-
-          data_payload = (void *)(block_end - size);
-          data_payload = (void *)SLI_ALIGN_ROUND_DOWN(((uintptr_t)data_payload), block_align);
-          size_adjusted = (size_t)(block_end - (uint8_t *)data_payload);
-        }
-
-        if (current_block_len >= size_adjusted) {
-          break;
-        }
-      }
+    if (memory_block_fit(current_block_metadata, size, block_align, type, block_reservation, &size_adjusted)) {
+      break;
     }
 
     // Get next block.
@@ -276,9 +500,6 @@ size_t sli_memory_find_free_block(sl_memory_heap_t *heap,
       // Short-term browsing direction goes from end to start of heap.
       current_block_metadata = (sli_block_metadata_t *)((uint64_t *)current_block_metadata - sli_block_offset_prev_dword_decode(current_block_metadata));
     }
-
-    current_block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(current_block_metadata));
-    current_block_len += block_reservation ? SLI_BLOCK_METADATA_SIZE_BYTE : 0;
   }
 
   *block = current_block_metadata;
@@ -380,6 +601,79 @@ void sli_update_free_list_heads(sl_memory_heap_t *heap,
   heap->free_st_list_head = (void *)free_st_list_head;
 }
 
+#if defined(SLI_MEMORY_MANAGER_TLSF_INDEX)
+/***************************************************************************//**
+ * Inserts a free block in the segregated free lists index of a heap.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_MEMORY_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+void sli_memory_free_index_insert(sl_memory_heap_t *heap,
+                                  sli_block_metadata_t *block)
+{
+  sli_memory_free_index_t *index = (sli_memory_free_index_t *)heap->free_index;
+  sli_free_block_links_t *links;
+  uint32_t len_dw = sli_block_len_dword_decode(block);
+  uint32_t link = (uint32_t)((uint64_t *)block - (uint64_t *)heap->base_addr);
+  uint32_t fl;
+  uint32_t sl;
+
+  if (len_dw == 0) {
+    return; // No room in data payload for the links, block is not indexed.
+  }
+
+  memory_free_index_mapping(len_dw, &fl, &sl);
+
+  // Push block at the head of its size class list.
+  links = memory_free_index_links(block);
+  links->prev = SLI_TLSF_LINK_NONE;
+  links->next = index->list_head[fl][sl];
+  if (links->next != SLI_TLSF_LINK_NONE) {
+    memory_free_index_links(memory_free_index_link_to_block(heap, links->next))->prev = link;
+  }
+  index->list_head[fl][sl] = link;
+
+  index->fl_bitmap |= SL_DEF_BIT(fl);
+  index->sl_bitmap[fl] |= (uint8_t)SL_DEF_BIT(sl);
+}
+
+/***************************************************************************//**
+ * Removes a free block from the segregated free lists index of a heap.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_MEMORY_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+void sli_memory_free_index_remove(sl_memory_heap_t *heap,
+                                  sli_block_metadata_t *block)
+{
+  sli_memory_free_index_t *index = (sli_memory_free_index_t *)heap->free_index;
+  const sli_free_block_links_t *links;
+  uint32_t len_dw = sli_block_len_dword_decode(block);
+  uint32_t fl;
+  uint32_t sl;
+
+  if (len_dw == 0) {
+    return; // Block was not indexed.
+  }
+
+  memory_free_index_mapping(len_dw, &fl, &sl);
+
+  links = memory_free_index_links(block);
+  if (links->prev != SLI_TLSF_LINK_NONE) {
+    memory_free_index_links(memory_free_index_link_to_block(heap, links->prev))->next = links->next;
+  } else {
+    index->list_head[fl][sl] = links->next;
+  }
+  if (links->next != SLI_TLSF_LINK_NONE) {
+    memory_free_index_links(memory_free_index_link_to_block(heap, links->next))->prev = links->prev;
+  }
+
+  // Update bitmaps if the size class list became empty.
+  if (index->list_head[fl][sl] == SLI_TLSF_LINK_NONE) {
+    index->sl_bitmap[fl] &= (uint8_t)~SL_DEF_BIT(sl);
+    if (index->sl_bitmap[fl] == 0) {
+      index->fl_bitmap &= ~SL_DEF_BIT(fl);
+    }
+  }
+}
+#endif
+
 /***************************************************************************//**
  * Creates a new heap instance.
  *
@@ -428,6 +722,7 @@ sl_status_t sli_memory_create_heap(void *base_addr,
   heap->high_watermark = 0;
   heap->free_blocks_number = 0;
   heap->attrib = attrib;
+  heap->free_index = NULL;
   heap->next_handle = NULL;
 
   // At first, all the heap is available to long-term/short-term blocks.
@@ -441,6 +736,11 @@ sl_status_t sli_memory_create_heap(void *base_addr,
   sli_block_len_dword_encode(free_lt_list_head, (SLI_BLOCK_LEN_BYTE_TO_DWORD(size - SLI_BLOCK_METADATA_SIZE_BYTE)));
   heap->free_blocks_number++;
 
+#if defined(SLI_MEMORY_MANAGER_TLSF_INDEX)
+  memory_free_index_init(heap);
+  sli_memory_free_index_insert(heap, free_lt_list_head);
+#endif
+
 #if defined(SL_CATALOG_BANK_RETENTION_CONTROL_PRESENT) ||  \
     defined(SL_CATALOG_BANK_RETENTION_CONTROL_STUBBED_PRESENT)
   sli_memory_manager_hal_init(heap);
@@ -77,6 +77,20 @@
 // <i> Default: 0
 #define SL_SLEEPTIMER_DEBUGRUN  0
 
+// <q SL_SLEEPTIMER_TIMER_WHEEL_ENABLE> Use a hierarchical timer wheel to keep the running timers.
+// <i> By default, the running timers are kept in a single sorted delta list. Starting and stopping a timer
+// <i> then walks the list inside a critical section. The timer wheel makes these operations constant time
+// <i> at the cost of about 600 bytes of RAM. It is recommended when many timers run at the same time.
+// <i> Default: 0
+#define SL_SLEEPTIMER_TIMER_WHEEL_ENABLE  0
+
+// <q SL_SLEEPTIMER_TIMER_COALESCING_ENABLE> Enable timer expiration coalescing.
+// <i> Allows to give each timer a slack, the delay after its timeout that is tolerated for its expiration.
+// <i> The timer interrupt is then delayed within the slack of the first timers to fire every timer that
+// <i> expired in a single pass, reducing the number of wakeups. Statistics on the wakeups avoided are kept.
+// <i> Default: 0
+#define SL_SLEEPTIMER_TIMER_COALESCING_ENABLE  0
+
 #endif /* SLEEPTIMER_CONFIG_H */
 
 // <<< end of configuration section >>>
@@ -42,6 +42,7 @@
 #include "sl_status.h"
 #include "sl_common.h"
 #include "sl_code_classification.h"
+#include "sl_sleeptimer_config.h"
 
 /// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
 #define SL_SLEEPTIMER_NO_HIGH_PRECISION_HF_CLOCKS_REQUIRED_FLAG (0x01)
@@ -81,10 +82,13 @@ struct sl_sleeptimer_timer_handle {
   sl_sleeptimer_timer_handle_t *next;      ///< Pointer to next element in list.
   sl_sleeptimer_timer_callback_t callback; ///< Function to call when timer expires.
   uint32_t timeout_periodic;               ///< Periodic timeout.
-  uint32_t delta;                          ///< Delay relative to previous element in list.
+  uint32_t delta;                          ///< Delay relative to previous element in list. Expiration tick count with the timer wheel.
   uint32_t timeout_expected_tc;            ///< Expected tick count of the next timeout (only used for periodic timer).
   uint16_t conversion_error;               ///< The error when converting ms to ticks (thousandths of ticks)
   uint16_t accumulated_error;              ///< Accumulated conversion error (thousandths of ticks)
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+  uint32_t slack;                          ///< Tolerated expiration delay after timeout, in ticks.
+#endif
 };
 
 /// @brief Month enum.
@@ -127,6 +131,15 @@ typedef  struct  time_date {
   sl_sleeptimer_time_zone_offset_t time_zone; ///< Offset, in seconds, from UTC
 } sl_sleeptimer_date_t;
 
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+/// @brief Timer expiration coalescing statistics.
+typedef struct {
+  uint32_t wakeup_count;           ///< Number of timer interrupts that processed expired timers.
+  uint32_t expiration_count;       ///< Number of timer expirations processed.
+  uint32_t wakeups_avoided_count;  ///< Number of timer expirations delayed within their slack to be processed with other timers.
+} sl_sleeptimer_coalescing_stats_t;
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -289,6 +302,42 @@ SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_handle_t *handle,
                                                    uint32_t *time);
 
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+/***************************************************************************//**
+ * Sets the slack of a running timer.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param slack Delay after the timer timeout during which the timer can expire,
+ *        in timer ticks.
+ *
+ * @note The slack is reset to 0 each time the timer is started or restarted.
+ *       It applies to all the following expirations of a periodic timer.
+ *
+ * @note The timer never expires before its timeout. When timers expire, the
+ *       timer interrupt is delayed up to the smallest slack among them so
+ *       that the timers expiring in the meantime are processed in the same
+ *       interrupt.
+ *
+ * @return SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_set_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                          uint32_t slack);
+
+/***************************************************************************//**
+ * Gets the timer expiration coalescing statistics.
+ *
+ * @param stats Pointer to the statistics structure to fill.
+ *
+ * @return SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_get_coalescing_stats(sl_sleeptimer_coalescing_stats_t *stats);
+
+/***************************************************************************//**
+ * Resets the timer expiration coalescing statistics.
+ ******************************************************************************/
+void sl_sleeptimer_reset_coalescing_stats(void);
+#endif
+
 /**************************************************************************//**
  * Gets the time remaining until the first timer with the matching set of flags
  * expires.
@@ -1130,6 +1179,10 @@ uint16_t sl_sleeptimer_get_clock_accuracy(void);
 ///   @ref sl_sleeptimer_get_timer_time_remaining() @n
 ///    Get the time remaining before the timer expires.
 ///
+///   @ref sl_sleeptimer_set_timer_slack() @n
+///    Set the delay tolerated after a timer timeout, to coalesce timer expirations.
+///    Only available when SL_SLEEPTIMER_TIMER_COALESCING_ENABLE is set.
+///
 ///   @ref sl_sleeptimer_delay_millisecond() @n
 ///    Delay for the given number of milliseconds. This is an "active wait" delay function.
 ///
@@ -36,6 +36,9 @@
 #include "sli_sleeptimer_hal.h"
 #include "sl_atomic.h"
 #include "sl_sleeptimer_config.h"
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+#include "sli_sleeptimer_timer_wheel.h"
+#endif
 
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
 #include "sl_component_catalog.h"
@@ -100,8 +103,10 @@ static uint32_t calculated_sec_count = 0;
 // Timer frequency in Hz.
 static uint32_t timer_frequency;
 
+#if !SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
 // Head of timer list.
 static sl_sleeptimer_timer_handle_t *timer_head;
+#endif
 
 // Count at last update of delta of first timer.
 static volatile sl_sleeptimer_tick_count_t last_delta_update_count;
@@ -118,6 +123,14 @@ static uint32_t max_millisecond_conversion;
 // Sleep on ISR exit flag.
 static volatile bool sleep_on_isr_exit = false;
 
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+// Timer expiration coalescing statistics.
+static sl_sleeptimer_coalescing_stats_t coalescing_stats;
+
+// Number of timers delayed within their slack until the programmed timer interrupt.
+static uint32_t coalescing_deferred_count;
+#endif
+
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
                                     sl_sleeptimer_tick_count_t timeout);
@@ -125,9 +138,17 @@ static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle);
 
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+__STATIC_INLINE sl_sleeptimer_timer_handle_t *get_first_timer(void);
+
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static sl_status_t set_comparator_for_next_timer(void);
 
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_tick_count_t get_coalesced_delta(uint32_t *deferred_count);
+#endif
+
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static void update_delta_list(void);
 
@@ -192,7 +213,11 @@ sl_status_t sl_sleeptimer_init(void)
 
   CORE_ENTER_ATOMIC();
   if (!is_sleeptimer_initialized) {
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+    sli_sleeptimer_timer_wheel_init();
+#else
     timer_head  = NULL;
+#endif
     last_delta_update_count = 0u;
     overflow_counter = 0u;
     sleeptimer_hal_init_timer();
@@ -465,9 +490,14 @@ sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
   update_delta_list();
 
   // If first timer in list, update timer comparator.
-  if (timer_head == handle) {
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+  // With coalescing, the timer interrupt and the timers it delays can depend on any timer.
+  set_comparator = true;
+#else
+  if (get_first_timer() == handle) {
     set_comparator = true;
   }
+#endif
 
   error = delta_list_remove_timer(handle);
   if (error != SL_STATUS_OK) {
@@ -501,6 +531,10 @@ sl_status_t sl_sleeptimer_is_timer_running(const sl_sleeptimer_timer_handle_t *h
   } else {
     *running = false;
     CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+    (void)current;
+    *running = sli_sleeptimer_timer_wheel_find(handle, NULL);
+#else
     current = timer_head;
     while (current != NULL && !*running) {
       if (current == handle) {
@@ -509,6 +543,7 @@ sl_status_t sl_sleeptimer_is_timer_running(const sl_sleeptimer_timer_handle_t *h
         current = current->next;
       }
     }
+#endif
     CORE_EXIT_ATOMIC();
   }
   return SL_STATUS_OK;
@@ -530,6 +565,14 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_han
   CORE_ENTER_ATOMIC();
 
   update_delta_list();
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  (void)current;
+  if (!sli_sleeptimer_timer_wheel_find(handle, time)) {
+    CORE_EXIT_ATOMIC();
+
+    return SL_STATUS_NOT_READY;
+  }
+#else
   *time  = handle->delta;
 
   // Retrieve timer in list and add the deltas.
@@ -544,6 +587,7 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_han
 
     return SL_STATUS_NOT_READY;
   }
+#endif
 
   // Substract time since last compare match.
   if (*time > sleeptimer_hal_get_counter() - last_delta_update_count) {
@@ -557,6 +601,71 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_han
   return SL_STATUS_OK;
 }
 
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+/**************************************************************************//**
+ * Sets the slack of a running timer.
+ *****************************************************************************/
+sl_status_t sl_sleeptimer_set_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                          uint32_t slack)
+{
+  CORE_DECLARE_IRQ_STATE;
+  bool is_running = false;
+
+  if (handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_CRITICAL();
+  sl_sleeptimer_is_timer_running(handle, &is_running);
+  if (!is_running) {
+    CORE_EXIT_CRITICAL();
+
+    return SL_STATUS_NOT_READY;
+  }
+
+  handle->slack = slack;
+
+  // The timer interrupt may be delayed or brought earlier.
+  update_delta_list();
+  set_comparator_for_next_timer();
+  CORE_EXIT_CRITICAL();
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * Gets the timer expiration coalescing statistics.
+ *****************************************************************************/
+sl_status_t sl_sleeptimer_get_coalescing_stats(sl_sleeptimer_coalescing_stats_t *stats)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (stats == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+  *stats = coalescing_stats;
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * Resets the timer expiration coalescing statistics.
+ *****************************************************************************/
+void sl_sleeptimer_reset_coalescing_stats(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  coalescing_stats.wakeup_count = 0u;
+  coalescing_stats.expiration_count = 0u;
+  coalescing_stats.wakeups_avoided_count = 0u;
+  CORE_EXIT_ATOMIC();
+}
+#endif
+
 /**************************************************************************//**
  * Gets the time remaining until the first timer with the matching set of flags
  * expires.
@@ -569,6 +678,25 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
   uint32_t time = 0;
 
   CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  // Retrieve first timer with option flags requirement.
+  current = sli_sleeptimer_timer_wheel_get_first((option_flags == SL_SLEEPTIMER_ANY_FLAG) ? 0u : 0xFFFFu,
+                                                 (option_flags == SL_SLEEPTIMER_ANY_FLAG) ? 0u : option_flags,
+                                                 UINT32_MAX,
+                                                 &time);
+  if (current != NULL) {
+    // Substract time since last compare match.
+    if (time > (sleeptimer_hal_get_counter() - last_delta_update_count)) {
+      time -= (sleeptimer_hal_get_counter() - last_delta_update_count);
+    } else {
+      time = 0;
+    }
+    *time_remaining = time;
+    CORE_EXIT_ATOMIC();
+
+    return SL_STATUS_OK;
+  }
+#else
   // Parse list and retrieve first timer with option flags requirement.
   current = timer_head;
   while (current != NULL) {
@@ -590,6 +718,7 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
     }
     current = current->next;
   }
+#endif
   CORE_EXIT_ATOMIC();
 
   return SL_STATUS_EMPTY;
@@ -612,6 +741,22 @@ void sli_sleeptimer_get_remaining_time_of_first_timers(uint8_t timer_count,
   uint32_t bitfield_timers = (1UL << timer_count) - 1;
 
   CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  // Retrieve first timer with each option flags requirement.
+  for (uint8_t i = 0; i < timer_count; i++) {
+    current = sli_sleeptimer_timer_wheel_get_first((option_flags[i] == SL_SLEEPTIMER_ANY_FLAG) ? 0u : 0xFFFFu,
+                                                   (option_flags[i] == SL_SLEEPTIMER_ANY_FLAG) ? 0u : option_flags[i],
+                                                   UINT32_MAX,
+                                                   &time);
+    if (current != NULL) {
+      // Substract time since last compare match.
+      uint32_t time_since_last_delta_update = sleeptimer_hal_get_counter() - last_delta_update_count;
+      time_remaining[i] = time > time_since_last_delta_update ? time - time_since_last_delta_update : 0;
+      status[i] = SL_STATUS_OK;
+      bitfield_timers &= ~(1UL << i);
+    }
+  }
+#else
   // Parse list and retrieve first timer with option flags requirement.
   current = timer_head;
   while (current != NULL) {
@@ -636,6 +781,7 @@ void sli_sleeptimer_get_remaining_time_of_first_timers(uint8_t timer_count,
     }
     current = current->next;
   }
+#endif
   CORE_EXIT_ATOMIC();
   // Mark any remaining timers as empty.
   for (uint8_t i = 0; i < timer_count; i++) {
@@ -668,7 +814,7 @@ bool sli_sleeptimer_is_power_manager_timer_next_to_expire(void)
   // Make sure that the Power Manager Sleeptimer is actually expired in addition
   // to being the next timer.
   if (next_timer_is_power_manager
-      && ((sl_sleeptimer_get_tick_count() - timer_head->timeout_expected_tc) > MIN_DIFF_BETWEEN_COUNT_AND_EXPIRATION)) {
+      && ((sl_sleeptimer_get_tick_count() - get_first_timer()->timeout_expected_tc) > MIN_DIFF_BETWEEN_COUNT_AND_EXPIRATION)) {
     next_timer_is_power_manager = false;
   }
 
@@ -1333,12 +1479,23 @@ void process_timer_irq(uint8_t local_flag)
 
     uint32_t nb_timer_expire = 0u;
     uint16_t option_flags = 0;
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+    uint32_t nb_timer_deferred;
+#endif
 
     CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+    // Timer callbacks can program the comparator again.
+    nb_timer_deferred = coalescing_deferred_count;
+#endif
     // Make sure the timers list is up to date with the time elapsed since the last update
     update_delta_list();
 
     // Process all timers that have expired.
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+    // Timers with higher priority are processed first.
+    while ((current = sli_sleeptimer_timer_wheel_get_expired()) != NULL) {
+#else
     while (timer_head && (timer_head->delta == 0)) {
       sl_sleeptimer_timer_handle_t *temp = timer_head;
       current = timer_head;
@@ -1350,6 +1507,7 @@ void process_timer_irq(uint8_t local_flag)
         }
         temp = temp->next;
       }
+#endif
       CORE_EXIT_ATOMIC();
 
       process_expired_timer(current);
@@ -1364,6 +1522,16 @@ void process_timer_irq(uint8_t local_flag)
       update_delta_list();
     }
 
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+    if (nb_timer_expire > 0u) {
+      coalescing_stats.wakeup_count++;
+      coalescing_stats.expiration_count += nb_timer_expire;
+      // Only the timers delayed into their slack window avoided a wakeup,
+      // not the ones that happened to expire at the same tick.
+      coalescing_stats.wakeups_avoided_count += (nb_timer_deferred < nb_timer_expire) ? nb_timer_deferred : nb_timer_expire;
+    }
+#endif
+
     // If the only timer expired is the internal Power Manager one,
     // from the Sleeptimer perspective, the system can go back to sleep after the ISR handling.
     sleep_on_isr_exit = false;
@@ -1422,6 +1590,9 @@ static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
   }
 #endif
 
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  sli_sleeptimer_timer_wheel_insert(handle, local_handle_delta);
+#else
   handle->delta = local_handle_delta;
 
   if (timer_head != NULL) {
@@ -1452,6 +1623,7 @@ static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
     timer_head = handle;
     handle->next = NULL;
   }
+#endif
 }
 
 /*******************************************************************************
@@ -1463,13 +1635,16 @@ static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
  ******************************************************************************/
 static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
 {
-  sl_sleeptimer_timer_handle_t *prev = NULL;
-  sl_sleeptimer_timer_handle_t *current = timer_head;
-
   if (handle == NULL) {
     return SL_STATUS_NULL_POINTER;
   }
 
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  return sli_sleeptimer_timer_wheel_remove(handle);
+#else
+  sl_sleeptimer_timer_handle_t *prev = NULL;
+  sl_sleeptimer_timer_handle_t *current = timer_head;
+
   // Retrieve timer in delta list.
   while (current != NULL && current != handle) {
     prev = current;
@@ -1492,6 +1667,21 @@ static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
   }
 
   return SL_STATUS_OK;
+#endif
+}
+
+/*******************************************************************************
+ * Gets the first timer to expire.
+ *
+ * @return Pointer to handle to first timer. NULL if no timer is running.
+ ******************************************************************************/
+__STATIC_INLINE sl_sleeptimer_timer_handle_t *get_first_timer(void)
+{
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  return sli_sleeptimer_timer_wheel_get_first(0u, 0u, UINT32_MAX, NULL);
+#else
+  return timer_head;
+#endif
 }
 
 /*******************************************************************************
@@ -1499,15 +1689,30 @@ static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
  ******************************************************************************/
 static sl_status_t set_comparator_for_next_timer(void)
 {
-  if (timer_head) {
-    if (timer_head->delta > 0) {
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  sl_sleeptimer_tick_count_t first_delta = 0u;
+  sl_sleeptimer_timer_handle_t *first = sli_sleeptimer_timer_wheel_get_first(0u, 0u, UINT32_MAX, &first_delta);
+#else
+  sl_sleeptimer_timer_handle_t *first = timer_head;
+  sl_sleeptimer_tick_count_t first_delta = (first != NULL) ? first->delta : 0u;
+#endif
+
+  if (first) {
+    if (first_delta > 0) {
       sl_sleeptimer_tick_count_t compare_value;
 
-      compare_value = last_delta_update_count + timer_head->delta;
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+      // Delay the interrupt within the slack of the first timers to expire.
+      first_delta = get_coalesced_delta(&coalescing_deferred_count);
+#endif
+      compare_value = last_delta_update_count + first_delta;
 
       sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
       sleeptimer_hal_set_compare(compare_value);
     } else {
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+      coalescing_deferred_count = 0u;
+#endif
       // In case timer has already expire, don't attempt to set comparator. Just
       // trigger compare match interrupt.
       sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
@@ -1517,15 +1722,66 @@ static sl_status_t set_comparator_for_next_timer(void)
     return SL_STATUS_OK;
   }
 
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+  coalescing_deferred_count = 0u;
+#endif
   return SL_STATUS_NULL_POINTER;
 }
 
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+/*******************************************************************************
+ * Gets the delay until the timer interrupt, relative to the last delta list
+ * update. It is the earliest timeout plus slack among the timers. Only the
+ * timers expiring before the interrupt are examined.
+ *
+ * @param deferred_count Pointer to the number of timers whose timeout is
+ *        before the interrupt, and which are therefore delayed within their
+ *        slack.
+ *
+ * @return Delay until the timer interrupt, in ticks.
+ ******************************************************************************/
+static sl_sleeptimer_tick_count_t get_coalesced_delta(uint32_t *deferred_count)
+{
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  return sli_sleeptimer_timer_wheel_get_coalesced_delay(deferred_count);
+#else
+  sl_sleeptimer_timer_handle_t *current = timer_head;
+  sl_sleeptimer_tick_count_t delta = 0u;
+  sl_sleeptimer_tick_count_t wakeup_delta = UINT32_MAX;
+
+  while ((current != NULL) && (current->delta <= (wakeup_delta - delta))) {
+    delta += current->delta;
+    if (current->slack < (wakeup_delta - delta)) {
+      wakeup_delta = delta + current->slack;
+    }
+    current = current->next;
+  }
+
+  *deferred_count = 0u;
+  delta = 0u;
+  current = timer_head;
+  while ((current != NULL) && (current->delta < (wakeup_delta - delta))) {
+    delta += current->delta;
+    (*deferred_count)++;
+    current = current->next;
+  }
+
+  return wakeup_delta;
+#endif
+}
+#endif
+
 /*******************************************************************************
  * Updates timer list's deltas.
  ******************************************************************************/
 static void update_delta_list(void)
 {
   sl_sleeptimer_tick_count_t current_cnt = sleeptimer_hal_get_counter();
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  // Expire the timers and spread the timers getting close to expiration
+  // according to the time elapsed since the last update.
+  sli_sleeptimer_timer_wheel_advance(current_cnt - last_delta_update_count);
+#else
   sl_sleeptimer_timer_handle_t *timer_handle = timer_head;
   sl_sleeptimer_tick_count_t time_diff = current_cnt - last_delta_update_count;
 
@@ -1541,6 +1797,7 @@ static void update_delta_list(void)
     }
     timer_handle = timer_handle->next;
   }
+#endif
 
   last_delta_update_count = current_cnt;
 }
@@ -1577,6 +1834,9 @@ static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
   handle->timeout_periodic = timeout_periodic;
   handle->callback = callback;
   handle->option_flags = option_flags;
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+  handle->slack = 0u;
+#endif
   if (timeout_periodic == 0) {
     handle->timeout_expected_tc = sleeptimer_hal_get_counter() + timeout_initial;
   } else {
@@ -1611,9 +1871,14 @@ static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
   delta_list_insert_timer(handle, timeout_initial);
 
   // If first timer, update timer comparator.
-  if (timer_head == handle) {
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+  // With coalescing, the timer can also have to fire before the delayed first timer.
+  set_comparator_for_next_timer();
+#else
+  if (get_first_timer() == handle) {
     set_comparator_for_next_timer();
   }
+#endif
 
   CORE_EXIT_CRITICAL();
 
@@ -1688,6 +1953,20 @@ static void process_expired_timer(sl_sleeptimer_timer_handle_t *timer)
  ******************************************************************************/
 static void update_next_timer_to_expire_is_power_manager(void)
 {
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+  uint32_t first_delta;
+
+  next_timer_to_expire_is_power_manager = false;
+
+  // Look for the power manager's timer among the timers expiring within a tick of the first one.
+  if ((sli_sleeptimer_timer_wheel_get_first(0u, 0u, UINT32_MAX, &first_delta) != NULL)
+      && (sli_sleeptimer_timer_wheel_get_first(SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG,
+                                               SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG,
+                                               (first_delta < UINT32_MAX) ? (first_delta + 1u) : first_delta,
+                                               NULL) != NULL)) {
+    next_timer_to_expire_is_power_manager = true;
+  }
+#else
   sl_sleeptimer_timer_handle_t *current = timer_head;
   uint32_t delta_diff_with_first = 0;
 
@@ -1704,6 +1983,7 @@ static void update_next_timer_to_expire_is_power_manager(void)
       delta_diff_with_first += current->delta;
     }
   }
+#endif
 }
 
 /**************************************************************************//**
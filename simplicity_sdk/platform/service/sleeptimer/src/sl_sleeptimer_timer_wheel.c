@@ -0,0 +1,704 @@
+/***************************************************************************//**
+ * @file
+ * @brief SLEEPTIMER hierarchical timer wheel implementation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "em_device.h"
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_config.h"
+#include "sli_sleeptimer.h"
+#include "sli_sleeptimer_timer_wheel.h"
+
+#if SL_SLEEPTIMER_TIMER_WHEEL_ENABLE
+
+/*******************************************************************************
+ * The wheel keeps its own 64 bits time, advanced by the sleeptimer each time
+ * the timers are updated. A running timer stores the 32 LSBs of its expiration
+ * tick in its delta field.
+ *
+ * A timer that is not expired is kept at the level of the most significant
+ * 4 bits group (nibble) where its expiration tick differs from the wheel time,
+ * in the slot given by that nibble of the expiration tick. Timers of a lower
+ * level always expire before the timers of a higher level, and the timers of a
+ * slot expire before the timers of the next slots of the same level. The first
+ * slot of a level contains timers that are at most 16 slots away.
+ *
+ * When the wheel time advances, the timers of the slots it went past are
+ * expired and the timers of the slot it reaches at the highest changed level
+ * are spread on the lower levels. Each timer is moved at most once per level,
+ * so the cost of an advance does not depend on the number of running timers.
+ *
+ * The expired timers are kept in a separate list, in processing order, until
+ * they are processed.
+ *
+ * The first timer of each level is cached for the lookups made each time a
+ * timer is started or stopped, so that they do not go through the slot lists.
+ * A cached timer that is removed is looked for again on the next lookup only.
+ ******************************************************************************/
+
+#define SLOT_MASK                 (SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT - 1u)
+#define EXPIRED_LIST_INDEX        (SLI_SLEEPTIMER_TIMER_WHEEL_LEVEL_COUNT * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT)
+#define LEVEL_SHIFT(level)        ((level) * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT_LOG2)
+#define EXPIRED_LEVEL             SLI_SLEEPTIMER_TIMER_WHEEL_LEVEL_COUNT
+#define CLASS_COUNT               2u
+
+// Timer lists of each slot of each level, followed by the expired timers list.
+// The expired timers list is kept in processing order: by priority, then by
+// expiration tick.
+static sl_sleeptimer_timer_handle_t *timer_wheel_slots[EXPIRED_LIST_INDEX + 1u];
+
+// Last timer of the expired timers list.
+static sl_sleeptimer_timer_handle_t *timer_wheel_expired_tail;
+
+// Bitmap of the non empty slots of each level.
+static uint16_t timer_wheel_bitmap[SLI_SLEEPTIMER_TIMER_WHEEL_LEVEL_COUNT];
+
+// Wheel time, in ticks.
+static uint64_t timer_wheel_time;
+
+// The first timer of each level is cached for the classes of timers looked up
+// each time a timer is started or stopped: all the timers, and the timers of
+// the power manager. A timer belongs to a class when it has all its flags set.
+static const uint16_t timer_wheel_class_flags[CLASS_COUNT] = {
+  0u,
+  SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG
+};
+
+// First timer to expire of each class at each level, followed by a timer of
+// each class in the expired timers list. An entry is only meaningful when its
+// bit is set in timer_wheel_first_valid, NULL then means that there is no
+// timer of the class. Invalid entries are computed again when looked up.
+static sl_sleeptimer_timer_handle_t *timer_wheel_first[CLASS_COUNT][EXPIRED_LEVEL + 1u];
+static uint16_t timer_wheel_first_valid[CLASS_COUNT];
+
+/*******************************************************************************
+ * Gets the index of the most significant bit set.
+ *
+ * @param value Value to search. Must not be 0.
+ *
+ * @return Index of the most significant bit set.
+ ******************************************************************************/
+__STATIC_INLINE uint32_t timer_wheel_fls(uint64_t value)
+{
+  uint32_t value_msb = (uint32_t)(value >> 32);
+
+  if (value_msb != 0u) {
+    return 63UL - __CLZ(value_msb);
+  }
+
+  return 31UL - __CLZ((uint32_t)value);
+}
+
+/*******************************************************************************
+ * Gets the expiration tick of a timer that is not expired.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return Expiration tick.
+ ******************************************************************************/
+__STATIC_INLINE uint64_t timer_wheel_get_expiration(const sl_sleeptimer_timer_handle_t *handle)
+{
+  return timer_wheel_time + (uint32_t)(handle->delta - (uint32_t)timer_wheel_time);
+}
+
+/*******************************************************************************
+ * Gets the index of the slot for an expiration tick.
+ *
+ * @param expiration Expiration tick. Must be after the wheel time.
+ *
+ * @return Slot index.
+ ******************************************************************************/
+__STATIC_INLINE uint32_t timer_wheel_get_slot_index(uint64_t expiration)
+{
+  uint32_t level = timer_wheel_fls(expiration ^ timer_wheel_time) / SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT_LOG2;
+
+  return (level * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT)
+         + ((uint32_t)(expiration >> LEVEL_SHIFT(level)) & SLOT_MASK);
+}
+
+/*******************************************************************************
+ * Checks if a timer belongs to a class.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param class_index Class index.
+ *
+ * @return true if the timer belongs to the class.
+ ******************************************************************************/
+__STATIC_INLINE bool timer_wheel_is_in_class(const sl_sleeptimer_timer_handle_t *handle,
+                                             uint32_t class_index)
+{
+  return (handle->option_flags & timer_wheel_class_flags[class_index]) == timer_wheel_class_flags[class_index];
+}
+
+/*******************************************************************************
+ * Checks if an expired timer must be processed before another one.
+ *
+ * @param handle Pointer to handle to expired timer.
+ * @param other Pointer to handle to other expired timer.
+ *
+ * @return true if handle must be processed first.
+ ******************************************************************************/
+__STATIC_INLINE bool timer_wheel_is_processed_before(const sl_sleeptimer_timer_handle_t *handle,
+                                                     const sl_sleeptimer_timer_handle_t *other)
+{
+  return (handle->priority < other->priority)
+         || ((handle->priority == other->priority) && ((int32_t)(handle->delta - other->delta) < 0));
+}
+
+/*******************************************************************************
+ * Inserts a timer in the expired timers list, in processing order. Timers
+ * usually expire in processing order and are appended to the list.
+ *
+ * @param handle Pointer to handle to timer.
+ ******************************************************************************/
+static void timer_wheel_push_expired(sl_sleeptimer_timer_handle_t *handle)
+{
+  sl_sleeptimer_timer_handle_t **link = &timer_wheel_slots[EXPIRED_LIST_INDEX];
+
+  if ((timer_wheel_expired_tail != NULL)
+      && !timer_wheel_is_processed_before(handle, timer_wheel_expired_tail)) {
+    link = &timer_wheel_expired_tail->next;
+  } else {
+    while ((*link != NULL) && !timer_wheel_is_processed_before(handle, *link)) {
+      link = &(*link)->next;
+    }
+  }
+
+  handle->next = *link;
+  *link = handle;
+  if (handle->next == NULL) {
+    timer_wheel_expired_tail = handle;
+  }
+
+  // The first timer of the list is read directly, any timer of the other classes will do.
+  for (uint32_t i = 1u; i < CLASS_COUNT; i++) {
+    if (((timer_wheel_first_valid[i] & (1u << EXPIRED_LEVEL)) != 0u)
+        && (timer_wheel_first[i][EXPIRED_LEVEL] == NULL)
+        && timer_wheel_is_in_class(handle, i)) {
+      timer_wheel_first[i][EXPIRED_LEVEL] = handle;
+    }
+  }
+}
+
+/*******************************************************************************
+ * Adds a timer at the head of a slot list.
+ *
+ * @param index Slot index.
+ * @param handle Pointer to handle to timer.
+ ******************************************************************************/
+static void timer_wheel_push(uint32_t index,
+                             sl_sleeptimer_timer_handle_t *handle)
+{
+  uint32_t level = index / SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT;
+
+  if (index == EXPIRED_LIST_INDEX) {
+    timer_wheel_push_expired(handle);
+    return;
+  }
+
+  handle->next = timer_wheel_slots[index];
+  timer_wheel_slots[index] = handle;
+  timer_wheel_bitmap[level] |= (uint16_t)(1u << (index & SLOT_MASK));
+
+  // Timers pushed on the wheel all expire after the wheel time.
+  for (uint32_t i = 0u; i < CLASS_COUNT; i++) {
+    sl_sleeptimer_timer_handle_t *first = timer_wheel_first[i][level];
+
+    if (((timer_wheel_first_valid[i] & (1u << level)) != 0u)
+        && timer_wheel_is_in_class(handle, i)
+        && ((first == NULL)
+            || ((uint32_t)(handle->delta - (uint32_t)timer_wheel_time) < (uint32_t)(first->delta - (uint32_t)timer_wheel_time)))) {
+      timer_wheel_first[i][level] = handle;
+    }
+  }
+}
+
+/*******************************************************************************
+ * Detaches the whole list of a slot.
+ *
+ * @param index Slot index. Must not be the expired timers list.
+ *
+ * @return Head of the slot list.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t *timer_wheel_detach(uint32_t index)
+{
+  sl_sleeptimer_timer_handle_t *head = timer_wheel_slots[index];
+  uint32_t level = index / SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT;
+
+  timer_wheel_slots[index] = NULL;
+  timer_wheel_bitmap[level] &= (uint16_t)~(1u << (index & SLOT_MASK));
+
+  for (uint32_t i = 0u; i < CLASS_COUNT; i++) {
+    timer_wheel_first_valid[i] &= (uint16_t)~(1u << level);
+  }
+
+  return head;
+}
+
+/*******************************************************************************
+ * Moves all the timers of a slot to the expired timers list.
+ *
+ * @param index Slot index.
+ ******************************************************************************/
+static void timer_wheel_expire_slot(uint32_t index)
+{
+  sl_sleeptimer_timer_handle_t *current = timer_wheel_detach(index);
+
+  while (current != NULL) {
+    sl_sleeptimer_timer_handle_t *next = current->next;
+
+    timer_wheel_push_expired(current);
+    current = next;
+  }
+}
+
+/*******************************************************************************
+ * Gets the first timer of a class at a level, computing it again if needed.
+ *
+ * @param class_index Class index.
+ * @param level Level, or EXPIRED_LEVEL for the expired timers list.
+ *
+ * @return Pointer to handle to first timer of the class at the level. NULL if
+ *         none.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t *timer_wheel_get_first_of_class(uint32_t class_index,
+                                                                    uint32_t level)
+{
+  sl_sleeptimer_timer_handle_t *first = NULL;
+  sl_sleeptimer_timer_handle_t *current;
+
+  if (level == EXPIRED_LEVEL) {
+    current = timer_wheel_slots[EXPIRED_LIST_INDEX];
+    if (class_index == 0u) {
+      return current;
+    }
+    if ((timer_wheel_first_valid[class_index] & (1u << level)) != 0u) {
+      return timer_wheel_first[class_index][level];
+    }
+    while ((current != NULL) && !timer_wheel_is_in_class(current, class_index)) {
+      current = current->next;
+    }
+    first = current;
+  } else {
+    uint32_t bitmap = timer_wheel_bitmap[level];
+
+    if (bitmap == 0u) {
+      return NULL;
+    }
+    if ((timer_wheel_first_valid[class_index] & (1u << level)) != 0u) {
+      return timer_wheel_first[class_index][level];
+    }
+
+    // The slots expire in order, the first one holding a timer of the class holds the first one.
+    while ((first == NULL) && (bitmap != 0u)) {
+      current = timer_wheel_slots[(level * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT) + SL_CTZ(bitmap)];
+      while (current != NULL) {
+        if (timer_wheel_is_in_class(current, class_index)
+            && ((first == NULL)
+                || ((uint32_t)(current->delta - (uint32_t)timer_wheel_time) < (uint32_t)(first->delta - (uint32_t)timer_wheel_time)))) {
+          first = current;
+        }
+        current = current->next;
+      }
+      bitmap &= bitmap - 1u;
+    }
+  }
+
+  timer_wheel_first[class_index][level] = first;
+  timer_wheel_first_valid[class_index] |= (uint16_t)(1u << level);
+
+  return first;
+}
+
+/*******************************************************************************
+ * Retrieves the slot list containing a timer.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param index Pointer to the index of the slot containing the timer.
+ *
+ * @return Pointer to the link pointing to the timer. NULL if the timer is not
+ *         in the wheel.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t **timer_wheel_lookup(const sl_sleeptimer_timer_handle_t *handle,
+                                                         uint32_t *index)
+{
+  sl_sleeptimer_timer_handle_t **link;
+
+  // Expired timers can't be located from their expiration tick.
+  *index = EXPIRED_LIST_INDEX;
+  link = &timer_wheel_slots[EXPIRED_LIST_INDEX];
+  while (*link != NULL) {
+    if (*link == handle) {
+      return link;
+    }
+    link = &(*link)->next;
+  }
+
+  // A timer that is not expired always expires after the wheel time.
+  if (handle->delta == (uint32_t)timer_wheel_time) {
+    return NULL;
+  }
+
+  *index = timer_wheel_get_slot_index(timer_wheel_get_expiration(handle));
+  link = &timer_wheel_slots[*index];
+  while (*link != NULL) {
+    if (*link == handle) {
+      return link;
+    }
+    link = &(*link)->next;
+  }
+
+  return NULL;
+}
+
+/*******************************************************************************
+ * Initializes the timer wheel.
+ ******************************************************************************/
+void sli_sleeptimer_timer_wheel_init(void)
+{
+  for (uint32_t i = 0; i <= EXPIRED_LIST_INDEX; i++) {
+    timer_wheel_slots[i] = NULL;
+  }
+  for (uint32_t i = 0; i < SLI_SLEEPTIMER_TIMER_WHEEL_LEVEL_COUNT; i++) {
+    timer_wheel_bitmap[i] = 0u;
+  }
+  for (uint32_t i = 0; i < CLASS_COUNT; i++) {
+    for (uint32_t level = 0; level <= EXPIRED_LEVEL; level++) {
+      timer_wheel_first[i][level] = NULL;
+    }
+    timer_wheel_first_valid[i] = (uint16_t)((1u << (EXPIRED_LEVEL + 1u)) - 1u);
+  }
+  timer_wheel_expired_tail = NULL;
+  timer_wheel_time = 0u;
+}
+
+/*******************************************************************************
+ * Advances the wheel time.
+ ******************************************************************************/
+void sli_sleeptimer_timer_wheel_advance(uint32_t elapsed)
+{
+  uint64_t new_time = timer_wheel_time + elapsed;
+  uint32_t level;
+  uint32_t slot_old;
+  uint32_t slot_new;
+  sl_sleeptimer_timer_handle_t *current;
+
+  if (elapsed == 0u) {
+    return;
+  }
+
+  level = timer_wheel_fls(timer_wheel_time ^ new_time) / SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT_LOG2;
+
+  // All the timers of the lower levels expire before the new wheel time.
+  for (uint32_t i = 0; i < level; i++) {
+    while (timer_wheel_bitmap[i] != 0u) {
+      timer_wheel_expire_slot((i * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT) + SL_CTZ(timer_wheel_bitmap[i]));
+    }
+  }
+
+  // So do the timers of the slots the wheel time went past on the highest changed level.
+  slot_old = (uint32_t)(timer_wheel_time >> LEVEL_SHIFT(level)) & SLOT_MASK;
+  slot_new = (uint32_t)(new_time >> LEVEL_SHIFT(level)) & SLOT_MASK;
+  for (uint32_t slot = slot_old + 1u; slot < slot_new; slot++) {
+    if ((timer_wheel_bitmap[level] & (1u << slot)) != 0u) {
+      timer_wheel_expire_slot((level * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT) + slot);
+    }
+  }
+
+  // The timers of the slot reached are spread on the lower levels relatively to the new wheel time.
+  current = timer_wheel_detach((level * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT) + slot_new);
+  while (current != NULL) {
+    sl_sleeptimer_timer_handle_t *next = current->next;
+    uint64_t expiration = timer_wheel_get_expiration(current);
+
+    if (expiration <= new_time) {
+      timer_wheel_push(EXPIRED_LIST_INDEX, current);
+    } else {
+      uint64_t time_saved = timer_wheel_time;
+
+      timer_wheel_time = new_time;
+      timer_wheel_push(timer_wheel_get_slot_index(expiration), current);
+      timer_wheel_time = time_saved;
+    }
+    current = next;
+  }
+
+  timer_wheel_time = new_time;
+}
+
+/*******************************************************************************
+ * Inserts a timer in the wheel.
+ ******************************************************************************/
+void sli_sleeptimer_timer_wheel_insert(sl_sleeptimer_timer_handle_t *handle,
+                                       uint32_t timeout)
+{
+  uint64_t expiration = timer_wheel_time + timeout;
+
+  handle->delta = (uint32_t)expiration;
+
+  if (timeout == 0u) {
+    timer_wheel_push(EXPIRED_LIST_INDEX, handle);
+  } else {
+    timer_wheel_push(timer_wheel_get_slot_index(expiration), handle);
+  }
+}
+
+/*******************************************************************************
+ * Removes a timer from the wheel.
+ ******************************************************************************/
+sl_status_t sli_sleeptimer_timer_wheel_remove(sl_sleeptimer_timer_handle_t *handle)
+{
+  uint32_t index;
+  uint32_t level;
+  sl_sleeptimer_timer_handle_t **link = timer_wheel_lookup(handle, &index);
+
+  if (link == NULL) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  *link = handle->next;
+  level = index / SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT;
+  if (index == EXPIRED_LIST_INDEX) {
+    if (handle == timer_wheel_expired_tail) {
+      // Only happens when stopping the last expired timer before it is processed.
+      timer_wheel_expired_tail = timer_wheel_slots[EXPIRED_LIST_INDEX];
+      while ((timer_wheel_expired_tail != NULL) && (timer_wheel_expired_tail->next != NULL)) {
+        timer_wheel_expired_tail = timer_wheel_expired_tail->next;
+      }
+    }
+  } else if (timer_wheel_slots[index] == NULL) {
+    timer_wheel_bitmap[level] &= (uint16_t)~(1u << (index & SLOT_MASK));
+  }
+
+  // The first timer of the level is looked for again only when needed.
+  for (uint32_t i = 0u; i < CLASS_COUNT; i++) {
+    if (timer_wheel_first[i][level] == handle) {
+      timer_wheel_first_valid[i] &= (uint16_t)~(1u << level);
+    }
+  }
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Looks up a timer in the wheel.
+ ******************************************************************************/
+bool sli_sleeptimer_timer_wheel_find(const sl_sleeptimer_timer_handle_t *handle,
+                                     uint32_t *remaining)
+{
+  uint32_t index;
+
+  if (timer_wheel_lookup(handle, &index) == NULL) {
+    return false;
+  }
+
+  if (remaining != NULL) {
+    *remaining = (index == EXPIRED_LIST_INDEX) ? 0u : (handle->delta - (uint32_t)timer_wheel_time);
+  }
+
+  return true;
+}
+
+/*******************************************************************************
+ * Gets the first timer to expire whose option flags match a given value.
+ ******************************************************************************/
+sl_sleeptimer_timer_handle_t *sli_sleeptimer_timer_wheel_get_first(uint16_t flags_mask,
+                                                                   uint16_t flags_value,
+                                                                   uint32_t limit,
+                                                                   uint32_t *remaining)
+{
+  sl_sleeptimer_timer_handle_t *first = NULL;
+  sl_sleeptimer_timer_handle_t *current;
+  uint32_t first_remaining = 0u;
+
+  // The first timers of the cached classes are found without going through the slot lists.
+  // Expired timers come first, then the timers of the lower levels.
+  for (uint32_t i = 0u; i < CLASS_COUNT; i++) {
+    if ((flags_mask == timer_wheel_class_flags[i]) && (flags_value == timer_wheel_class_flags[i])) {
+      first = timer_wheel_get_first_of_class(i, EXPIRED_LEVEL);
+      for (uint32_t level = 0u; (first == NULL) && (level < SLI_SLEEPTIMER_TIMER_WHEEL_LEVEL_COUNT); level++) {
+        first = timer_wheel_get_first_of_class(i, level);
+        if (first != NULL) {
+          first_remaining = first->delta - (uint32_t)timer_wheel_time;
+        }
+      }
+
+      if ((first == NULL) || (first_remaining > limit)) {
+        return NULL;
+      }
+      if (remaining != NULL) {
+        *remaining = first_remaining;
+      }
+
+      return first;
+    }
+  }
+
+  // Other flags are looked for through the timers. Expired timers come first.
+  // Keep the one that expired the earliest.
+  current = timer_wheel_slots[EXPIRED_LIST_INDEX];
+  while (current != NULL) {
+    if ((current->option_flags & flags_mask) == flags_value) {
+      if ((first == NULL)
+          || ((uint32_t)((uint32_t)timer_wheel_time - current->delta) > (uint32_t)((uint32_t)timer_wheel_time - first->delta))) {
+        first = current;
+      }
+    }
+    current = current->next;
+  }
+
+  // Then look through the slots in expiration order. The first slot holding a matching timer
+  // contains the first matching timer to expire.
+  for (uint32_t level = 0; (first == NULL) && (level < SLI_SLEEPTIMER_TIMER_WHEEL_LEVEL_COUNT); level++) {
+    uint32_t bitmap = timer_wheel_bitmap[level];
+
+    while ((first == NULL) && (bitmap != 0u)) {
+      uint32_t slot = SL_CTZ(bitmap);
+      uint64_t slot_start = ((timer_wheel_time >> LEVEL_SHIFT(level + 1u)) << LEVEL_SHIFT(level + 1u))
+                            | ((uint64_t)slot << LEVEL_SHIFT(level));
+
+      if ((slot_start - timer_wheel_time) > limit) {
+        return NULL;
+      }
+
+      current = timer_wheel_slots[(level * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT) + slot];
+      while (current != NULL) {
+        uint32_t current_remaining = current->delta - (uint32_t)timer_wheel_time;
+
+        if (((current->option_flags & flags_mask) == flags_value)
+            && (current_remaining <= limit)
+            && ((first == NULL) || (current_remaining < first_remaining))) {
+          first = current;
+          first_remaining = current_remaining;
+        }
+        current = current->next;
+      }
+      bitmap &= bitmap - 1u;
+    }
+  }
+
+  if ((first != NULL) && (remaining != NULL)) {
+    *remaining = first_remaining;
+  }
+
+  return first;
+}
+
+/*******************************************************************************
+ * Gets the expired timer to process first.
+ ******************************************************************************/
+sl_sleeptimer_timer_handle_t *sli_sleeptimer_timer_wheel_get_expired(void)
+{
+  return timer_wheel_slots[EXPIRED_LIST_INDEX];
+}
+
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+/*******************************************************************************
+ * Counts the timers of the wheel expiring before a delay.
+ *
+ * @param delay Delay from the wheel time, in ticks.
+ *
+ * @return Number of timers expiring strictly before the delay.
+ ******************************************************************************/
+static uint32_t timer_wheel_count_before(uint32_t delay)
+{
+  uint32_t count = 0u;
+
+  for (uint32_t level = 0; level < SLI_SLEEPTIMER_TIMER_WHEEL_LEVEL_COUNT; level++) {
+    uint32_t bitmap = timer_wheel_bitmap[level];
+
+    while (bitmap != 0u) {
+      uint32_t slot = SL_CTZ(bitmap);
+      uint64_t slot_start = ((timer_wheel_time >> LEVEL_SHIFT(level + 1u)) << LEVEL_SHIFT(level + 1u))
+                            | ((uint64_t)slot << LEVEL_SHIFT(level));
+      sl_sleeptimer_timer_handle_t *current;
+
+      if ((slot_start - timer_wheel_time) >= delay) {
+        return count;
+      }
+
+      current = timer_wheel_slots[(level * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT) + slot];
+      while (current != NULL) {
+        if ((uint32_t)(current->delta - (uint32_t)timer_wheel_time) < delay) {
+          count++;
+        }
+        current = current->next;
+      }
+      bitmap &= bitmap - 1u;
+    }
+  }
+
+  return count;
+}
+
+/*******************************************************************************
+ * Gets the earliest timeout plus slack among the timers of the wheel.
+ ******************************************************************************/
+uint32_t sli_sleeptimer_timer_wheel_get_coalesced_delay(uint32_t *deferred_count)
+{
+  uint32_t wakeup_delay = UINT32_MAX;
+
+  *deferred_count = 0u;
+  if (timer_wheel_slots[EXPIRED_LIST_INDEX] != NULL) {
+    return 0u;
+  }
+
+  // Only the slots starting before the current wakeup can bring it earlier.
+  for (uint32_t level = 0; level < SLI_SLEEPTIMER_TIMER_WHEEL_LEVEL_COUNT; level++) {
+    uint32_t bitmap = timer_wheel_bitmap[level];
+
+    while (bitmap != 0u) {
+      uint32_t slot = SL_CTZ(bitmap);
+      uint64_t slot_start = ((timer_wheel_time >> LEVEL_SHIFT(level + 1u)) << LEVEL_SHIFT(level + 1u))
+                            | ((uint64_t)slot << LEVEL_SHIFT(level));
+      sl_sleeptimer_timer_handle_t *current;
+
+      if ((slot_start - timer_wheel_time) > wakeup_delay) {
+        *deferred_count = timer_wheel_count_before(wakeup_delay);
+        return wakeup_delay;
+      }
+
+      current = timer_wheel_slots[(level * SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT) + slot];
+      while (current != NULL) {
+        uint32_t current_delay = current->delta - (uint32_t)timer_wheel_time;
+
+        if ((current_delay <= wakeup_delay) && (current->slack < (wakeup_delay - current_delay))) {
+          wakeup_delay = current_delay + current->slack;
+        }
+        current = current->next;
+      }
+      bitmap &= bitmap - 1u;
+    }
+  }
+
+  *deferred_count = timer_wheel_count_before(wakeup_delay);
+  return wakeup_delay;
+}
+#endif
+
+#endif /* SL_SLEEPTIMER_TIMER_WHEEL_ENABLE */
@@ -0,0 +1,156 @@
+/***************************************************************************//**
+ * @file
+ * @brief SLEEPTIMER hierarchical timer wheel definition.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SLI_SLEEPTIMER_TIMER_WHEEL_H
+#define SLI_SLEEPTIMER_TIMER_WHEEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sl_sleeptimer.h"
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Each level of the wheel splits the range of the level above in 16 slots.
+#define SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT_LOG2  4u
+#define SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT       (1u << SLI_SLEEPTIMER_TIMER_WHEEL_SLOT_COUNT_LOG2)
+
+// 9 levels cover any expiration up to 2^32 - 1 ticks away from the wheel time.
+#define SLI_SLEEPTIMER_TIMER_WHEEL_LEVEL_COUNT      9u
+
+/*******************************************************************************
+ * Initializes the timer wheel. All the timers are dropped and the wheel time
+ * is reset.
+ *
+ * @note All the timer wheel functions must be called inside a critical or an
+ *       atomic section.
+ ******************************************************************************/
+void sli_sleeptimer_timer_wheel_init(void);
+
+/*******************************************************************************
+ * Advances the wheel time. Timers reaching their expiration tick are moved to
+ * the expired timers list.
+ *
+ * @param elapsed Number of ticks elapsed since the last advance.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+void sli_sleeptimer_timer_wheel_advance(uint32_t elapsed);
+
+/*******************************************************************************
+ * Inserts a timer in the wheel.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param timeout Timer timeout from the wheel time, in ticks. A timer with a
+ *        timeout of 0 is inserted directly in the expired timers list.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+void sli_sleeptimer_timer_wheel_insert(sl_sleeptimer_timer_handle_t *handle,
+                                       uint32_t timeout);
+
+/*******************************************************************************
+ * Removes a timer from the wheel.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return SL_STATUS_OK if successful. SL_STATUS_INVALID_STATE if the timer is
+ *         not in the wheel.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+sl_status_t sli_sleeptimer_timer_wheel_remove(sl_sleeptimer_timer_handle_t *handle);
+
+/*******************************************************************************
+ * Looks up a timer in the wheel.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param remaining Pointer to the ticks remaining from the wheel time until the
+ *        timer expires. 0 for an expired timer. Can be NULL.
+ *
+ * @return true if the timer is in the wheel. false otherwise.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+bool sli_sleeptimer_timer_wheel_find(const sl_sleeptimer_timer_handle_t *handle,
+                                     uint32_t *remaining);
+
+/*******************************************************************************
+ * Gets the first timer to expire whose option flags match a given value.
+ * The first expired timer is the first one to be processed.
+ *
+ * @note Looking up any timer (flags_mask and flags_value of 0) or the power
+ *       manager early wakeup timers (flags_mask and flags_value of
+ *       SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG) doesn't go
+ *       through the timer lists. Other lookups do.
+ *
+ * @param flags_mask Mask applied to the timers option flags. 0 matches any timer.
+ * @param flags_value Option flags value expected after applying the mask.
+ * @param limit Only the timers expiring within this number of ticks from the
+ *        wheel time are considered.
+ * @param remaining Pointer to the ticks remaining from the wheel time until the
+ *        timer found expires. 0 for an expired timer. Can be NULL.
+ *
+ * @return Pointer to handle to first matching timer. NULL if none.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+sl_sleeptimer_timer_handle_t *sli_sleeptimer_timer_wheel_get_first(uint16_t flags_mask,
+                                                                   uint16_t flags_value,
+                                                                   uint32_t limit,
+                                                                   uint32_t *remaining);
+
+/*******************************************************************************
+ * Gets the expired timer to process first. Timers with a higher priority are
+ * processed first, then the ones that expired earlier.
+ *
+ * @return Pointer to handle to expired timer. NULL if no timer expired.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+sl_sleeptimer_timer_handle_t *sli_sleeptimer_timer_wheel_get_expired(void);
+
+#if SL_SLEEPTIMER_TIMER_COALESCING_ENABLE
+/*******************************************************************************
+ * Gets the earliest timeout plus slack among the timers of the wheel.
+ *
+ * @param deferred_count Pointer to the number of timers whose timeout is
+ *        before the earliest tolerated expiration, and which are therefore
+ *        delayed within their slack.
+ *
+ * @return Ticks from the wheel time until the earliest tolerated expiration.
+ *         0 if a timer already expired. UINT32_MAX if the wheel is empty.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+uint32_t sli_sleeptimer_timer_wheel_get_coalesced_delay(uint32_t *deferred_count);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SLI_SLEEPTIMER_TIMER_WHEEL_H */
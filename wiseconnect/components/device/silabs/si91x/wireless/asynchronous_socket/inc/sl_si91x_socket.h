@@ -381,6 +381,40 @@ int sl_si91x_sendto_async(int socket,
                           socklen_t to_addr_len,
                           sl_si91x_socket_data_transfer_complete_handler_t callback);
 
+/**
+ * @brief 
+ * Transmits a message gathered from several fragments to another socket asynchronously, and receives acknowledgement through the registered callback.
+ * 
+ * @details
+ * The fragments are copied once, straight into the frame sent to the NWP, so the caller does not need to stage them in a contiguous buffer.
+ * The function can also be called from an unconnected socket, typically like a UDP socket.
+ * 
+ * @param[in] socket 
+ * The socket ID or file descriptor for the specified socket.
+ * @param[in] iov 
+ *  Array of @ref sl_si91x_socket_iovec_t fragments making up the data to send to remote peer, in order.
+ * @param[in] iov_count 
+ *  Number of fragments in iov.
+ * @param[in] flags 
+ *  Controls the transmission of the data.
+ * @param[in] to_addr 
+ *  Address of type @ref sockaddr to which datagrams are to be sent.
+ * @param[in] to_addr_len
+ *  Length of the socket address of type @ref socklen_t in bytes.
+ * @param[in] callback 
+ *  A function pointer of type @ref sl_si91x_socket_data_transfer_complete_handler_t that is called after complete data transfer.
+ * @return int 
+ * @note The flags parameter is not currently supported.
+ * @note The total length of the fragments is limited like the buffer length of @ref sl_si91x_sendto_async.
+ */
+int sl_si91x_sendto_vector_async(int socket,
+                                 const sl_si91x_socket_iovec_t *iov,
+                                 uint32_t iov_count,
+                                 int32_t flags,
+                                 const struct sockaddr *to_addr,
+                                 socklen_t to_addr_len,
+                                 sl_si91x_socket_data_transfer_complete_handler_t callback);
+
 /**
  * @brief Sends data that is larger than the Maximum Segment Size (MSS).
  *
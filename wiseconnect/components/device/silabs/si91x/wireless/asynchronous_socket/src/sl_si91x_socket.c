@@ -358,12 +358,16 @@ int sl_si91x_send_large_data(int socket, const uint8_t *buffer, size_t buffer_le
 
 // Helper: Validate socket and buffer arguments
 static int sli_si91x_validate_sendto_async_args(const sli_si91x_socket_t *si91x_socket,
-                                                const uint8_t *buffer,
+                                                const sl_si91x_socket_iovec_t *iov,
+                                                uint32_t iov_count,
                                                 const struct sockaddr *to_addr)
 {
   SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket == NULL, EBADF);
   SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket->type == SOCK_STREAM && si91x_socket->state != CONNECTED, ENOTCONN);
-  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(buffer == NULL, EFAULT);
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(iov == NULL, EFAULT);
+  for (uint32_t i = 0; i < iov_count; i++) {
+    SLI_SET_ERRNO_AND_RETURN_IF_TRUE(iov[i].data == NULL, EFAULT);
+  }
   if (si91x_socket->socket_bitmap & SLI_SI91X_SOCKET_FEAT_TCP_ACK_INDICATION) {
     SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket->is_waiting_on_ack == true, EWOULDBLOCK);
   }
@@ -481,17 +485,36 @@ int sl_si91x_sendto_async(int socket,
                           socklen_t to_addr_len,
                           sl_si91x_socket_data_transfer_complete_handler_t callback)
 {
+  const sl_si91x_socket_iovec_t iov = { .data = buffer, .length = buffer_length };
+
+  return sl_si91x_sendto_vector_async(socket, &iov, 1, flags, to_addr, to_addr_len, callback);
+}
+
+int sl_si91x_sendto_vector_async(int socket,
+                                 const sl_si91x_socket_iovec_t *iov,
+                                 uint32_t iov_count,
+                                 int32_t flags,
+                                 const struct sockaddr *to_addr,
+                                 socklen_t to_addr_len,
+                                 sl_si91x_socket_data_transfer_complete_handler_t callback)
+{
 
   UNUSED_PARAMETER(flags);
   sl_status_t status                      = SL_STATUS_OK;
   sli_si91x_socket_t *si91x_socket        = sli_get_si91x_socket(socket);
   sli_si91x_socket_send_request_t request = { 0 };
+  sl_wifi_buffer_t *tx_buffer             = NULL;
+  uint8_t *payload                        = NULL;
+  size_t buffer_length                    = 0;
 
   // Validate arguments
-  int err = sli_si91x_validate_sendto_async_args(si91x_socket, buffer, to_addr);
+  int err = sli_si91x_validate_sendto_async_args(si91x_socket, iov, iov_count, to_addr);
   if (err) {
     return err;
   }
+  for (uint32_t i = 0; i < iov_count; i++) {
+    buffer_length += iov[i].length;
+  }
 
   // Set the data transfer callback for this socket
   si91x_socket->data_transfer_callback = callback;
@@ -510,8 +533,15 @@ int sl_si91x_sendto_async(int socket,
   sli_si91x_setup_request_address(si91x_socket, to_addr, to_addr_len, &request);
   request.length = buffer_length;
 
-  // Send the socket data
-  status = sli_si91x_driver_send_socket_data(&request, buffer, 0);
+  // Gather the data straight into the frame, then hand the frame over as is
+  status = sli_si91x_driver_allocate_socket_data(&request, &tx_buffer, (void **)&payload);
+  if (status == SL_STATUS_OK) {
+    for (uint32_t i = 0; i < iov_count; i++) {
+      memcpy(payload, iov[i].data, iov[i].length);
+      payload += iov[i].length;
+    }
+    status = sli_si91x_driver_send_socket_buffer(tx_buffer, 0);
+  }
   if (status != SL_STATUS_OK && (si91x_socket->socket_bitmap & SLI_SI91X_SOCKET_FEAT_TCP_ACK_INDICATION)) {
     si91x_socket->is_waiting_on_ack = false;
   }
@@ -82,6 +82,38 @@ typedef struct {
 #ifndef SL_SI91X_EVENT_HANDLER_STACK_SIZE
 #define SL_SI91X_EVENT_HANDLER_STACK_SIZE 1536
 #endif
+
+/**
+ * Lets the buffer manager move quota between buffer types at runtime. When a buffer type has used up its quota,
+ * one buffer of quota is taken from the buffer type with the most unused quota, so traffic that needs more data
+ * buffers can use the idle command buffers. No buffer type goes below the minimum quota of 10 buffers.
+ * 0 keeps the quotas of sl_wifi_buffer_configuration_t.
+ */
+#ifndef SL_WIFI_BUFFER_QUOTA_REBALANCE_ENABLE
+#define SL_WIFI_BUFFER_QUOTA_REBALANCE_ENABLE 0
+#endif
+
+/// Number of Wi-Fi buffer types tracked by the buffer manager
+#define SLI_SI91X_BUFFER_TYPE_COUNT (SL_WIFI_SCAN_RESULT_BUFFER + 1)
+
+/// Usage statistics of one Wi-Fi buffer type
+typedef struct {
+  uint8_t quota;                ///< Current quota, differs from the configured one once rebalanced
+  uint8_t allocated;            ///< Number of buffers currently allocated
+  uint8_t high_watermark;       ///< Highest number of buffers allocated at once
+  uint32_t allocation_count;    ///< Number of successful allocations
+  uint32_t allocation_failures; ///< Number of allocations that timed out without a buffer
+  uint32_t wait_count;          ///< Number of successful allocations that had to wait for a buffer
+  uint32_t total_wait_time_ms;  ///< Total time waited by successful allocations, in milliseconds
+  uint32_t max_wait_time_ms;    ///< Longest time waited by a successful allocation, in milliseconds
+  uint32_t quota_borrowed;      ///< Number of quota buffers taken from other buffer types
+  uint32_t quota_lent;          ///< Number of quota buffers given to other buffer types
+} sli_si91x_buffer_type_statistics_t;
+
+/// Snapshot of the buffer manager usage statistics
+typedef struct {
+  sli_si91x_buffer_type_statistics_t type[SLI_SI91X_BUFFER_TYPE_COUNT]; ///< Statistics indexed by sl_wifi_buffer_type_t
+} sli_si91x_buffer_statistics_t;
 typedef bool (*sli_si91x_wifi_buffer_comparator)(const sl_wifi_buffer_t *buffer, const void *userdata);
 typedef uint32_t sl_si91x_host_timestamp_t;
 
@@ -251,6 +283,18 @@ sl_status_t sli_si91x_host_allocate_buffer(sl_wifi_buffer_t **buffer,
                                            uint32_t buffer_size,
                                            uint32_t wait_duration_ms);
 
+/**
+ * @brief Get a consistent snapshot of the buffer manager usage statistics
+ * @param statistics Pointer to the snapshot to fill
+ * @return SL_STATUS_OK, or SL_STATUS_NULL_POINTER if statistics is NULL
+ */
+sl_status_t sli_si91x_host_get_buffer_statistics(sli_si91x_buffer_statistics_t *statistics);
+
+/**
+ * @brief Reset the buffer manager usage counters. The high watermarks restart from the current allocations
+ */
+void sli_si91x_host_reset_buffer_statistics(void);
+
 // Helper functions for command packet processing
 /**
  * @brief Set flags for command packet based on wait period and command type
@@ -610,6 +654,54 @@ void sli_flush_tx_packet(sli_wifi_command_queue_t *queue,
                          uint16_t frame_status,
                          uint32_t event_mask);
 
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+/**
+ * @brief Checks whether the next command of a queue can be sent while other commands are in flight.
+ *
+ * Only non sequential queues are pipelined. The next command is held back when the pipeline is full, when a
+ * command with the same frame type is already in flight, since the responses could not be told apart, or when
+ * either command blocks the global queue.
+ *
+ * @param[in] queue Pointer to the Wi-Fi command queue structure.
+ * @return true if the next command can be written to the bus, false otherwise.
+ */
+bool sli_wifi_command_queue_can_pipeline(const sli_wifi_command_queue_t *queue);
+
+/**
+ * @brief Saves the trace of the command in flight before the trace of a new command is written in the queue.
+ *
+ * @param[in,out] queue Pointer to the Wi-Fi command queue structure.
+ */
+void sli_wifi_command_queue_save_trace(sli_wifi_command_queue_t *queue);
+
+/**
+ * @brief Makes the in flight command matching a response frame type the traced command of the queue.
+ *
+ * The response handlers only look at the queue trace, so this is called before handling a response.
+ *
+ * @param[in,out] queue      Pointer to the Wi-Fi command queue structure.
+ * @param[in]     frame_type Frame type of the received response.
+ */
+void sli_wifi_command_queue_select_trace(sli_wifi_command_queue_t *queue, uint16_t frame_type);
+
+/**
+ * @brief Drops the pipelined commands whose response did not arrive within their command timeout.
+ *
+ * The callers waiting on these commands have already timed out, so this frees their entries for new commands.
+ *
+ * @param[in,out] queue Pointer to the Wi-Fi command queue structure.
+ */
+void sli_wifi_command_queue_expire_traces(sli_wifi_command_queue_t *queue);
+
+/**
+ * @brief Makes a pipelined command the traced command of the queue once the traced command completed.
+ *
+ * @param[in,out] queue Pointer to the Wi-Fi command queue structure.
+ * @return true if a pipelined command was restored, false otherwise.
+ */
+bool sli_wifi_command_queue_restore_trace(sli_wifi_command_queue_t *queue);
+#endif
+
 #ifdef SLI_SI91X_OFFLOAD_NETWORK_STACK
 /**
  * @brief 
@@ -223,6 +223,40 @@ sl_status_t sli_si91x_driver_send_socket_data(const sli_si91x_socket_send_reques
                                               const void *data,
                                               uint32_t wait_time);
 
+/***************************************************************************/ /**
+ * @brief
+ *   Allocate a socket data buffer and fill its socket command header, so that the payload can be written in place.
+ * @param[in] request
+ *   @ref sli_si91x_socket_send_request_t Pointer to socket command packet. The length sets the payload size.
+ * @param[out] buffer
+ *   Allocated buffer, to be passed to @ref sli_si91x_driver_send_socket_buffer.
+ * @param[out] payload
+ *   Pointer to the payload area of the buffer, request->length bytes long.
+ * @pre Pre-conditions:
+ * - 
+ *   @ref sl_si91x_driver_init should be called before this API.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sli_si91x_driver_allocate_socket_data(const sli_si91x_socket_send_request_t *request,
+                                                  sl_wifi_buffer_t **buffer,
+                                                  void **payload);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Queue a buffer allocated by @ref sli_si91x_driver_allocate_socket_data for transmission, without copying it.
+ * @param[in] buffer
+ *   Buffer to send. The ownership is transferred to the driver.
+ * @param[in] wait_time
+ *   Timeout  for the command response.
+ * @pre Pre-conditions:
+ * - 
+ *   @ref sl_si91x_driver_init should be called before this API.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sli_si91x_driver_send_socket_buffer(sl_wifi_buffer_t *buffer, uint32_t wait_time);
+
 /***************************************************************************/ /**
  * @brief
  *   Send a Bluetooth command.
@@ -505,6 +505,12 @@ typedef struct {
 } sli_si91x_socket_send_request_t;
 #pragma pack()
 
+/// Si91x socket data fragment, used to gather the payload of a send data on socket request
+typedef struct {
+  const void *data; ///< Pointer to the fragment data
+  uint32_t length;  ///< Length of the fragment in bytes
+} sl_si91x_socket_iovec_t;
+
 /// socket accept request structure
 #pragma pack(1)
 typedef struct {
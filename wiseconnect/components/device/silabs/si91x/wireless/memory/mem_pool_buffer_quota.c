@@ -38,13 +38,17 @@
 #include <string.h>
 #include "sl_rsi_utility.h"
 
-#define SLI_BUFFER_TYPE    4
+#define SLI_BUFFER_TYPE    SLI_SI91X_BUFFER_TYPE_COUNT
 #define SLI_WATERMARKLEVEL 10
+// Unused quota a buffer type keeps when lending quota to another buffer type
+#define SLI_QUOTA_REBALANCE_HEADROOM 2
 static sli_mem_pool_handle_t mem_pool;
 static const sl_wifi_buffer_configuration_t *configuration;
 void *allocated_wifi_buffer                       = NULL;
 static uint8_t buffer_allocation[SLI_BUFFER_TYPE] = { 0, 0, 0, 0 };
 static uint8_t quota[SLI_BUFFER_TYPE];
+// Usage counters, only accessed inside critical sections
+static sli_si91x_buffer_type_statistics_t buffer_statistics[SLI_BUFFER_TYPE];
 
 #ifndef SL_WIFI_BUFFERS_FREE_WAIT_TIME
 #define SL_WIFI_BUFFERS_FREE_WAIT_TIME 1000 // wait for 1 second to free all the wi-fi buffer
@@ -54,6 +58,9 @@ static uint8_t quota[SLI_BUFFER_TYPE];
 static void sl_si91x_convert_config_structure_to_array(const sl_wifi_buffer_configuration_t *config);
 static sl_status_t sl_si91x_check_for_valid_config(const sl_wifi_buffer_configuration_t *config);
 static bool sl_si91x_check_for_buffer_empty(void);
+#if SL_WIFI_BUFFER_QUOTA_REBALANCE_ENABLE
+static void sli_si91x_rebalance_quota(sl_wifi_buffer_type_t type);
+#endif
 /*---------------------------------------------------------------------------------*/
 
 sl_status_t sli_si91x_host_init_buffer_manager(const sl_wifi_buffer_configuration_t *config)
@@ -65,6 +72,7 @@ sl_status_t sli_si91x_host_init_buffer_manager(const sl_wifi_buffer_configuratio
   VERIFY_STATUS_AND_RETURN(result);
   configuration     = config;
   void *pool_buffer = configuration->buffer_memory;
+  memset(buffer_statistics, 0, sizeof(buffer_statistics));
   uint8_t block_count =
     configuration->tx_buffer_quota + configuration->rx_buffer_quota + configuration->control_buffer_quota;
   uint32_t buffer_size = configuration->block_size * block_count;
@@ -124,15 +132,37 @@ sl_status_t sli_si91x_host_allocate_buffer(sl_wifi_buffer_t **buffer,
   }
   uint32_t start_time = osKernelGetTickCount();
   uint32_t delay      = 150;
+  uint32_t wait_time  = 0;
+  bool waited         = false;
   *buffer             = NULL;
+  CORE_DECLARE_IRQ_STATE;
   do {
-    CORE_DECLARE_IRQ_STATE;
+    if (waited) {
+      wait_time = sl_si91x_host_elapsed_time(start_time);
+    }
     CORE_ENTER_CRITICAL();
+#if SL_WIFI_BUFFER_QUOTA_REBALANCE_ENABLE
+    if (buffer_allocation[type] >= quota[type]) {
+      sli_si91x_rebalance_quota(type);
+    }
+#endif
     // Atomically check quota, allocate, and update counter
     if (buffer_allocation[type] < quota[type]) {
       *buffer = sli_mem_pool_alloc(&mem_pool);
       if (*buffer != NULL) {
         buffer_allocation[type]++; // Update counter immediately
+        sli_si91x_buffer_type_statistics_t *statistics = &buffer_statistics[type];
+        statistics->allocation_count++;
+        if (buffer_allocation[type] > statistics->high_watermark) {
+          statistics->high_watermark = buffer_allocation[type];
+        }
+        if (waited) {
+          statistics->wait_count++;
+          statistics->total_wait_time_ms += wait_time;
+          if (wait_time > statistics->max_wait_time_ms) {
+            statistics->max_wait_time_ms = wait_time;
+          }
+        }
         CORE_EXIT_CRITICAL();
         // Initialize buffer outside critical section
         (*buffer)->type      = (uint8_t)type;
@@ -143,14 +173,43 @@ sl_status_t sli_si91x_host_allocate_buffer(sl_wifi_buffer_t **buffer,
     }
     CORE_EXIT_CRITICAL();
     osDelay(SLI_SYSTEM_US_TO_TICKS(delay));
-    delay = (delay < 2000) ? (delay * 3) / 2 : 2000;
+    delay  = (delay < 2000) ? (delay * 3) / 2 : 2000;
+    waited = true;
   } while (sl_si91x_host_elapsed_time(start_time) <= wait_duration_ms);
   if (*buffer == NULL) {
+    CORE_ENTER_CRITICAL();
+    buffer_statistics[type].allocation_failures++;
+    CORE_EXIT_CRITICAL();
     return SL_STATUS_ALLOCATION_FAILED;
   }
   return SL_STATUS_OK;
 }
 
+sl_status_t sli_si91x_host_get_buffer_statistics(sli_si91x_buffer_statistics_t *statistics)
+{
+  SL_VERIFY_POINTER_OR_RETURN(statistics, SL_STATUS_NULL_POINTER);
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_CRITICAL();
+  for (int i = 0; i < SLI_BUFFER_TYPE; i++) {
+    statistics->type[i]           = buffer_statistics[i];
+    statistics->type[i].quota     = quota[i];
+    statistics->type[i].allocated = buffer_allocation[i];
+  }
+  CORE_EXIT_CRITICAL();
+  return SL_STATUS_OK;
+}
+
+void sli_si91x_host_reset_buffer_statistics(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_CRITICAL();
+  memset(buffer_statistics, 0, sizeof(buffer_statistics));
+  for (int i = 0; i < SLI_BUFFER_TYPE; i++) {
+    buffer_statistics[i].high_watermark = buffer_allocation[i];
+  }
+  CORE_EXIT_CRITICAL();
+}
+
 void *sl_si91x_host_get_buffer_data(sl_wifi_buffer_t *buffer, uint16_t offset, uint16_t *data_length)
 {
   if (offset >= buffer->length) {
@@ -200,6 +259,41 @@ static sl_status_t sl_si91x_check_for_valid_config(const sl_wifi_buffer_configur
   return SL_STATUS_OK;
 }
 
+#if SL_WIFI_BUFFER_QUOTA_REBALANCE_ENABLE
+// Must be called inside a critical section. The quotas add up to the pool block count, so the pool has a free
+// block whenever another buffer type has unused quota.
+static void sli_si91x_rebalance_quota(sl_wifi_buffer_type_t type)
+{
+  int donor            = -1;
+  uint8_t donor_unused = SLI_QUOTA_REBALANCE_HEADROOM;
+
+  // Buffer types without a configured quota are left out
+  if ((quota[type] == 0) || (quota[type] == UINT8_MAX)) {
+    return;
+  }
+
+  // Borrow from the buffer type with the most unused quota, keeping its minimum quota and some headroom
+  for (int i = 0; i < SLI_BUFFER_TYPE; i++) {
+    if ((i == (int)type) || (quota[i] <= SLI_WATERMARKLEVEL) || (buffer_allocation[i] >= quota[i])) {
+      continue;
+    }
+    uint8_t unused = quota[i] - buffer_allocation[i];
+    if (unused > donor_unused) {
+      donor        = i;
+      donor_unused = unused;
+    }
+  }
+  if (donor < 0) {
+    return;
+  }
+
+  quota[donor]--;
+  quota[type]++;
+  buffer_statistics[donor].quota_lent++;
+  buffer_statistics[type].quota_borrowed++;
+}
+#endif
+
 static bool sl_si91x_check_for_buffer_empty(void)
 {
   CORE_DECLARE_IRQ_STATE;
@@ -316,6 +316,34 @@ sli_si91x_socket_t *sli_si91x_get_socket_from_id(int socket_id,
 sl_status_t sli_si91x_send_socket_data(sli_si91x_socket_t *si91x_socket,
                                        const sli_si91x_socket_send_request_t *request,
                                        const void *data);
+
+/**
+ * A internal function to allocate a socket data buffer with its send request header filled,
+ * so that the payload can be written in place and queued with sli_si91x_send_socket_buffer()
+ * @param si91x_socket Socket the buffer is accounted to
+ * @param request Send request, its length sets the payload size
+ * @param buffer Allocated buffer
+ * @param payload Pointer to the payload area of the buffer
+ */
+sl_status_t sli_si91x_allocate_socket_data(sli_si91x_socket_t *si91x_socket,
+                                           const sli_si91x_socket_send_request_t *request,
+                                           sl_wifi_buffer_t **buffer,
+                                           void **payload);
+
+/**
+ * A internal function to queue a buffer from sli_si91x_allocate_socket_data() without copying it.
+ * The ownership of the buffer is transferred to the driver
+ * @param si91x_socket Socket to send the data on
+ * @param buffer Buffer to send
+ */
+sl_status_t sli_si91x_send_socket_buffer(sli_si91x_socket_t *si91x_socket, sl_wifi_buffer_t *buffer);
+
+/**
+ * A internal function to release a buffer from sli_si91x_allocate_socket_data() that is not sent
+ * @param si91x_socket Socket the buffer is accounted to
+ * @param buffer Buffer to release
+ */
+void sli_si91x_free_socket_data(sli_si91x_socket_t *si91x_socket, sl_wifi_buffer_t *buffer);
 int32_t sli_get_socket_command_from_host_packet(sl_wifi_buffer_t *buffer);
 
 void sli_si91x_set_socket_event(uint32_t event_mask);
@@ -1380,22 +1380,23 @@ sl_status_t sli_si91x_send_socket_command(sli_si91x_socket_t *socket,
   }
 }
 
-sl_status_t sli_si91x_send_socket_data(sli_si91x_socket_t *si91x_socket,
-                                       const sli_si91x_socket_send_request_t *request,
-                                       const void *data)
+sl_status_t sli_si91x_allocate_socket_data(sli_si91x_socket_t *si91x_socket,
+                                           const sli_si91x_socket_send_request_t *request,
+                                           sl_wifi_buffer_t **buffer,
+                                           void **payload)
 {
-  sl_wifi_buffer_t *buffer        = NULL;
   sl_wifi_system_packet_t *packet = NULL;
   sli_si91x_socket_send_request_t *send;
 
-  sl_status_t status     = SL_STATUS_OK;
-  uint16_t header_length = (request->data_offset - sizeof(sli_si91x_socket_send_request_t));
-  uint32_t data_length   = request->length;
+  sl_status_t status = SL_STATUS_OK;
 
-  if (data == NULL) {
+  if ((si91x_socket == NULL) || (request == NULL) || (buffer == NULL) || (payload == NULL)) {
     return SL_STATUS_NULL_POINTER;
   }
 
+  uint16_t header_length = (request->data_offset - sizeof(sli_si91x_socket_send_request_t));
+  uint32_t data_length   = request->length;
+
   uint32_t start = osKernelGetTickCount();
   while (si91x_socket->data_buffer_limit != 0 && si91x_socket->data_buffer_count >= si91x_socket->data_buffer_limit) {
     osDelay(SLI_SYSTEM_MS_TO_TICKS(2));
@@ -1406,32 +1407,56 @@ sl_status_t sli_si91x_send_socket_data(sli_si91x_socket_t *si91x_socket,
 
   // Allocate a buffer for the socket data with appropriate size
   status = sli_si91x_host_allocate_buffer(
-    &buffer,
+    buffer,
     SL_WIFI_TX_FRAME_BUFFER,
     sizeof(sl_wifi_system_packet_t) + sizeof(sli_si91x_socket_send_request_t) + header_length + data_length,
     SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
   VERIFY_STATUS_AND_RETURN(status);
 
-  packet = sli_wifi_host_get_buffer_data(buffer, 0, NULL);
+  packet = sli_wifi_host_get_buffer_data(*buffer, 0, NULL);
   if (packet == NULL) {
-    sli_si91x_host_free_buffer(buffer);
+    sli_si91x_host_free_buffer(*buffer);
+    *buffer = NULL;
     return SL_STATUS_WIFI_BUFFER_ALLOC_FAIL;
   }
 
   // Atomic protection for data_buffer_count to prevent race condition
-  CORE_irqState_t state1 = CORE_EnterAtomic();
+  CORE_irqState_t state = CORE_EnterAtomic();
   ++si91x_socket->data_buffer_count;
-  CORE_ExitAtomic(state1);
+  CORE_ExitAtomic(state);
 
   memset(packet->desc, 0, sizeof(packet->desc));
 
   send = (sli_si91x_socket_send_request_t *)packet->data;
   memcpy(send, request, sizeof(sli_si91x_socket_send_request_t));
-  memcpy((send->send_buffer + header_length), data, data_length);
 
   // Fill frame type
   packet->length = (sizeof(sli_si91x_socket_send_request_t) + header_length + data_length) & 0xFFF;
 
+  *payload = send->send_buffer + header_length;
+  return SL_STATUS_OK;
+}
+
+void sli_si91x_free_socket_data(sli_si91x_socket_t *si91x_socket, sl_wifi_buffer_t *buffer)
+{
+  if ((si91x_socket == NULL) || (buffer == NULL)) {
+    return;
+  }
+
+  // Atomic protection for data_buffer_count to prevent race condition
+  CORE_irqState_t state = CORE_EnterAtomic();
+  --si91x_socket->data_buffer_count;
+  CORE_ExitAtomic(state);
+
+  sli_si91x_host_free_buffer(buffer);
+}
+
+sl_status_t sli_si91x_send_socket_buffer(sli_si91x_socket_t *si91x_socket, sl_wifi_buffer_t *buffer)
+{
+  if ((si91x_socket == NULL) || (buffer == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
   CORE_irqState_t state = CORE_EnterAtomic();
   sli_wifi_append_to_buffer_queue(&si91x_socket->tx_data_queue, buffer);
   tx_socket_data_queues_status |= (1 << si91x_socket->index);
@@ -1441,6 +1466,27 @@ sl_status_t sli_si91x_send_socket_data(sli_si91x_socket_t *si91x_socket,
   return SL_STATUS_OK;
 }
 
+sl_status_t sli_si91x_send_socket_data(sli_si91x_socket_t *si91x_socket,
+                                       const sli_si91x_socket_send_request_t *request,
+                                       const void *data)
+{
+  sl_wifi_buffer_t *buffer = NULL;
+  void *payload            = NULL;
+  sl_status_t status;
+
+  if ((request == NULL) || (data == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  status = sli_si91x_allocate_socket_data(si91x_socket, request, &buffer, &payload);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  // Write the payload straight into the frame
+  memcpy(payload, data, request->length);
+
+  return sli_si91x_send_socket_buffer(si91x_socket, buffer);
+}
+
 /**
  * @brief Helper: Find socket ID by port number and LISTEN state
  * */
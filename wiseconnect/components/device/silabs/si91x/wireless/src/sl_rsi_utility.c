@@ -538,95 +538,6 @@ sl_status_t sli_fw_status_storage_index_init(void)
   return status;
 }
 
-// Function to update a existing entry or create new entry for scan results database
-static sli_scan_info_t *sli_update_or_create_scan_info_element(const sli_scan_info_t *info)
-{
-  sli_scan_info_t **scan_db_head = sli_get_scan_info_database();
-  sli_scan_info_t *element       = NULL;
-  sli_scan_info_t *prev          = NULL;
-
-  element = *scan_db_head;
-  while (NULL != element) {
-    if (0 == memcmp(info->bssid, element->bssid, SLI_WIFI_HARDWARE_ADDRESS_LENGTH)) {
-      element->seen_count++;
-      element->channel       = info->channel;
-      element->security_mode = info->security_mode;
-      element->rssi          = info->rssi;
-      element->network_type  = info->network_type;
-      memcpy(element->ssid, info->ssid, 34);
-
-      // Remove the element from its current position so it can be re-inserted in sorted order
-      if (NULL == prev) {
-        *scan_db_head = element->next;
-      } else {
-        prev->next = element->next;
-      }
-      element->next = NULL;
-      return element;
-    }
-    prev    = element;
-    element = element->next;
-  }
-
-  if (NULL == element) {
-    element = (sli_scan_info_t *)malloc(sizeof(sli_scan_info_t));
-    if (element == NULL) {
-      return NULL;
-    }
-    memcpy(element, info, sizeof(sli_scan_info_t));
-    element->seen_count = 1;
-    element->next       = NULL;
-    return element;
-  }
-
-  return NULL;
-}
-
-// Function to store a given scan info element in scan results database
-static void sli_store_scan_info_element(const sli_scan_info_t *info)
-{
-  sli_scan_info_t *element       = NULL;
-  sli_scan_info_t *head          = NULL;
-  sli_scan_info_t *tail          = NULL;
-  sli_scan_info_t **scan_db_head = sli_get_scan_info_database();
-
-  if (NULL == info) {
-    return;
-  }
-
-  element = sli_update_or_create_scan_info_element(info);
-  if (NULL == element) {
-    return;
-  }
-
-  if (NULL == *scan_db_head) {
-    *scan_db_head = element;
-    return;
-  }
-
-  tail = *scan_db_head;
-  while (NULL != tail) {
-    if (element->rssi < tail->rssi) {
-      element->next = tail;
-      if (NULL == head) {
-        *scan_db_head = element;
-      } else {
-        head->next = element;
-      }
-      break;
-    }
-
-    head = tail;
-    tail = tail->next;
-
-    if (NULL == tail) {
-      head->next = element;
-    }
-  }
-
-  return;
-}
-
 // Function to identify Authentication Key Management Type
 static uint32_t sli_get_key_management_info(const sli_wlan_cipher_suite_t *akms, uint16_t akmsc)
 {
@@ -839,7 +750,7 @@ void sli_handle_wifi_beacon(sl_wifi_system_packet_t *packet)
       }
       // Ensure transient flag is never stored (defensive if more code sets it later)
       scan_info.wpa_vendor_ie_seen = false;
-      sli_store_scan_info_element(&scan_info);
+      sli_wifi_update_scan_info_database(&scan_info);
     } break;
     default:
       return;
@@ -1024,6 +935,9 @@ sl_status_t sl_si91x_platform_init(void)
     cmd_queues[i].mutex                = osMutexNew(NULL);
     cmd_queues[i].flag                 = (1 << i);
     cmd_queues[i].is_queue_initialized = true;
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+    cmd_queues[i].pipelined_command_count = 0;
+#endif
   }
 
   // Create malloc/free mutex
@@ -1173,6 +1087,127 @@ void sli_reset_command_queue_trace(sli_wifi_command_queue_t *queue)
   queue->event_mask        = 0;
 }
 
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+static void sli_wifi_command_queue_store_trace(const sli_wifi_command_queue_t *queue, sli_wifi_command_trace_t *trace)
+{
+  trace->frame_type        = queue->frame_type;
+  trace->packet_id         = queue->packet_id;
+  trace->firmware_queue_id = queue->firmware_queue_id;
+  trace->flags             = queue->flags;
+  trace->command_tickcount = queue->command_tickcount;
+  trace->command_timeout   = queue->command_timeout;
+  trace->sdk_context       = queue->sdk_context;
+  trace->event_mask        = queue->event_mask;
+}
+
+static void sli_wifi_command_queue_load_trace(sli_wifi_command_queue_t *queue, const sli_wifi_command_trace_t *trace)
+{
+  queue->frame_type        = trace->frame_type;
+  queue->packet_id         = trace->packet_id;
+  queue->firmware_queue_id = trace->firmware_queue_id;
+  queue->flags             = trace->flags;
+  queue->command_tickcount = trace->command_tickcount;
+  queue->command_timeout   = trace->command_timeout;
+  queue->sdk_context       = trace->sdk_context;
+  queue->event_mask        = trace->event_mask;
+}
+
+static bool sli_wifi_command_queue_is_in_flight(const sli_wifi_command_queue_t *queue, uint16_t frame_type)
+{
+  if (queue->command_in_flight && (queue->frame_type == frame_type)) {
+    return true;
+  }
+  for (uint8_t i = 0; i < queue->pipelined_command_count; i++) {
+    if (queue->pipelined_commands[i].frame_type == frame_type) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool sli_wifi_command_queue_can_pipeline(const sli_wifi_command_queue_t *queue)
+{
+  const sli_si91x_queue_packet_t *node  = NULL;
+  const sl_wifi_system_packet_t *packet = NULL;
+
+  if (queue->sequential || (queue->pipelined_command_count >= (SLI_WIFI_COMMAND_PIPELINE_DEPTH - 1))
+      || (queue->flags & SLI_WIFI_PACKET_GLOBAL_QUEUE_BLOCK) || (queue->tx_queue.head == NULL)) {
+    return false;
+  }
+
+  node = sli_wifi_host_get_buffer_data(queue->tx_queue.head, 0, NULL);
+  if ((node == NULL) || (node->host_packet == NULL) || (node->flags & SLI_WIFI_PACKET_GLOBAL_QUEUE_BLOCK)) {
+    return false;
+  }
+  packet = sli_wifi_host_get_buffer_data(node->host_packet, 0, NULL);
+
+  // IPv6 configuration is answered with a different frame type, so it cannot be matched out of order
+  if ((packet->command == SLI_WLAN_REQ_IPCONFV6) || (queue->frame_type == SLI_WLAN_REQ_IPCONFV6)) {
+    return false;
+  }
+
+  return !sli_wifi_command_queue_is_in_flight(queue, packet->command);
+}
+
+void sli_wifi_command_queue_save_trace(sli_wifi_command_queue_t *queue)
+{
+  if (!queue->command_in_flight || (queue->frame_type == 0)
+      || (queue->pipelined_command_count >= (SLI_WIFI_COMMAND_PIPELINE_DEPTH - 1))) {
+    return;
+  }
+  sli_wifi_command_queue_store_trace(queue, &queue->pipelined_commands[queue->pipelined_command_count]);
+  queue->pipelined_command_count++;
+}
+
+void sli_wifi_command_queue_select_trace(sli_wifi_command_queue_t *queue, uint16_t frame_type)
+{
+  sli_wifi_command_trace_t current;
+
+  if (queue->command_in_flight && (queue->frame_type == frame_type)) {
+    return;
+  }
+
+  for (uint8_t i = 0; i < queue->pipelined_command_count; i++) {
+    if (queue->pipelined_commands[i].frame_type == frame_type) {
+      // Swap the traced command with the matching one, the traced command stays pipelined if still in flight
+      sli_wifi_command_queue_store_trace(queue, &current);
+      sli_wifi_command_queue_load_trace(queue, &queue->pipelined_commands[i]);
+      if (queue->command_in_flight && (current.frame_type != 0)) {
+        queue->pipelined_commands[i] = current;
+      } else {
+        queue->pipelined_command_count--;
+        queue->pipelined_commands[i] = queue->pipelined_commands[queue->pipelined_command_count];
+      }
+      queue->command_in_flight = true;
+      return;
+    }
+  }
+}
+
+void sli_wifi_command_queue_expire_traces(sli_wifi_command_queue_t *queue)
+{
+  // Like a late response to the traced command, a response that did not arrive in time is no longer awaited
+  for (uint8_t i = queue->pipelined_command_count; i > 0; i--) {
+    const sli_wifi_command_trace_t *trace = &queue->pipelined_commands[i - 1];
+    if (sl_si91x_host_elapsed_time(trace->command_tickcount) > trace->command_timeout) {
+      queue->pipelined_command_count--;
+      queue->pipelined_commands[i - 1] = queue->pipelined_commands[queue->pipelined_command_count];
+    }
+  }
+}
+
+bool sli_wifi_command_queue_restore_trace(sli_wifi_command_queue_t *queue)
+{
+  if ((queue->command_in_flight && (queue->frame_type != 0)) || (queue->pipelined_command_count == 0)) {
+    return false;
+  }
+  queue->pipelined_command_count--;
+  sli_wifi_command_queue_load_trace(queue, &queue->pipelined_commands[queue->pipelined_command_count]);
+  queue->command_in_flight = true;
+  return true;
+}
+#endif
+
 void sli_flush_tx_packet(sli_wifi_command_queue_t *queue,
                          sl_wifi_buffer_t *current_packet,
                          sli_si91x_queue_packet_t *queue_node,
@@ -1372,6 +1407,34 @@ sl_status_t sli_si91x_flush_queue_based_on_type(sli_wifi_command_queue_t *queue,
     }
   }
 
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+  // Flush the pipelined commands, each one is made the traced command in turn
+  for (uint8_t i = queue->pipelined_command_count; i > 0; i--) {
+    sli_wifi_command_trace_t current;
+    bool current_in_flight = queue->command_in_flight;
+
+    sli_wifi_command_queue_store_trace(queue, &current);
+    sli_wifi_command_queue_load_trace(queue, &queue->pipelined_commands[i - 1]);
+    queue->command_in_flight = true;
+
+    status = sli_handle_command_in_flight_packet(queue, event_mask, frame_status, compare_function, user_data);
+    if (queue->command_in_flight) {
+      sli_wifi_command_queue_store_trace(queue, &queue->pipelined_commands[i - 1]);
+    } else {
+      queue->pipelined_command_count--;
+      queue->pipelined_commands[i - 1] = queue->pipelined_commands[queue->pipelined_command_count];
+    }
+
+    sli_wifi_command_queue_load_trace(queue, &current);
+    queue->command_in_flight = current_in_flight;
+    if (status != SL_STATUS_OK) {
+      CORE_ExitAtomic(state);
+      return status;
+    }
+  }
+  sli_wifi_command_queue_restore_trace(queue);
+#endif
+
   status = sli_flush_tx_queue(queue, event_mask, frame_status, compare_function, user_data);
 
   CORE_ExitAtomic(state);
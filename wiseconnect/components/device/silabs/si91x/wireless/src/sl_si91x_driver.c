@@ -1051,35 +1051,36 @@ sl_status_t sl_si91x_driver_raw_send_command(uint8_t command,
   return sl_si91x_driver_send_data_packet(buffer, wait_time);
 }
 
-sl_status_t sli_si91x_driver_send_socket_data(const sli_si91x_socket_send_request_t *request,
-                                              const void *data,
-                                              uint32_t wait_time)
+sl_status_t sli_si91x_driver_allocate_socket_data(const sli_si91x_socket_send_request_t *request,
+                                                  sl_wifi_buffer_t **buffer,
+                                                  void **payload)
 {
-  UNUSED_PARAMETER(wait_time);
-  sl_wifi_buffer_t *buffer        = NULL;
   sl_wifi_system_packet_t *packet = NULL;
   sli_si91x_socket_send_request_t *send;
 
-  sl_status_t status     = SL_STATUS_OK;
-  uint16_t header_length = (request->data_offset - sizeof(sli_si91x_socket_send_request_t));
-  uint32_t data_length   = request->length;
+  sl_status_t status = SL_STATUS_OK;
 
-  if (data == NULL) {
+  if ((request == NULL) || (buffer == NULL) || (payload == NULL)) {
     return SL_STATUS_NULL_POINTER;
   }
 
+  uint16_t header_length = (request->data_offset - sizeof(sli_si91x_socket_send_request_t));
+  uint32_t data_length   = request->length;
+
   // Allocate a buffer for the socket data with appropriate size
   status = sli_si91x_host_allocate_buffer(
-    &buffer,
+    buffer,
     SL_WIFI_TX_FRAME_BUFFER,
     sizeof(sl_wifi_system_packet_t) + sizeof(sli_si91x_socket_send_request_t) + header_length + data_length,
     SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
 
   VERIFY_STATUS_AND_RETURN(status);
-  packet = sli_wifi_host_get_buffer_data(buffer, 0, NULL);
+  packet = sli_wifi_host_get_buffer_data(*buffer, 0, NULL);
 
   // If the packet is not allocated successfully, return an allocation failed error
   if (packet == NULL) {
+    sli_si91x_host_free_buffer(*buffer);
+    *buffer = NULL;
     return SL_STATUS_WIFI_BUFFER_ALLOC_FAIL;
   }
 
@@ -1087,14 +1088,44 @@ sl_status_t sli_si91x_driver_send_socket_data(const sli_si91x_socket_send_reques
 
   send = (sli_si91x_socket_send_request_t *)packet->data;
   memcpy(send, request, sizeof(sli_si91x_socket_send_request_t));
-  memcpy((send->send_buffer + header_length), data, data_length);
 
   // Fill frame type
   packet->length = (sizeof(sli_si91x_socket_send_request_t) + header_length + data_length) & 0xFFF;
 
+  *payload = send->send_buffer + header_length;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sli_si91x_driver_send_socket_buffer(sl_wifi_buffer_t *buffer, uint32_t wait_time)
+{
+  if (buffer == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
   return sl_si91x_driver_send_data_packet(buffer, wait_time);
 }
 
+sl_status_t sli_si91x_driver_send_socket_data(const sli_si91x_socket_send_request_t *request,
+                                              const void *data,
+                                              uint32_t wait_time)
+{
+  sl_wifi_buffer_t *buffer = NULL;
+  void *payload            = NULL;
+  sl_status_t status;
+
+  if ((request == NULL) || (data == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  status = sli_si91x_driver_allocate_socket_data(request, &buffer, &payload);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  // Write the payload straight into the frame
+  memcpy(payload, data, request->length);
+
+  return sli_si91x_driver_send_socket_buffer(buffer, wait_time);
+}
+
 sl_status_t sl_si91x_custom_driver_send_command(uint32_t command,
                                                 sli_wifi_command_type_t command_type,
                                                 const void *data,
@@ -55,6 +55,8 @@
 #endif
 
 #include "sli_wifi_utility.h"
+#include "sli_wifi_event_handler.h"
+#include "sl_common.h"
 #ifdef SLI_SI91X_MCU_INTERFACE
 #include "rsi_m4.h"
 #endif
@@ -107,6 +109,21 @@ extern osMessageQueueId_t sli_network_manager_request_queue;
 // Indicates asynchronous RX response received for BLE command type
 #define NCP_HOST_BLE_NOTIFICATION_EVENT SL_SI91X_NOTIFICATION_FLAG(SLI_SI91X_BT_CMD)
 
+// Number of notification events, indexed by their bit position
+#define SLI_SI91X_NOTIFICATION_EVENT_COUNT (SI91X_CMD_MAX + 2)
+
+// Notification events processed before the others, so that received socket data is not delayed by management traffic
+#define SLI_SI91X_HIGH_PRIORITY_NOTIFICATION_EVENTS \
+  (NCP_HOST_SOCKET_DATA_NOTIFICATION_EVENT | SLI_SI91X_NCP_HOST_COMMAND_ENGINE_STATUS_NOTIFICATION_EVENT)
+
+// Notification events processed after the high priority ones
+#define SLI_SI91X_MEDIUM_PRIORITY_NOTIFICATION_EVENTS \
+  (NCP_HOST_SOCKET_NOTIFICATION_EVENT | NCP_HOST_BLE_NOTIFICATION_EVENT)
+
+// Management notification events, processed last
+#define SLI_SI91X_LOW_PRIORITY_NOTIFICATION_EVENTS \
+  (NCP_HOST_WLAN_NOTIFICATION_EVENT | NCP_HOST_NETWORK_NOTIFICATION_EVENT | NCP_HOST_COMMON_NOTIFICATION_EVENT)
+
 // Define a constant for identifying a Wi-Fi packet type
 #define SLI_WIFI_PACKET 1
 
@@ -263,6 +280,32 @@ void sli_si91x_process_command_engine_status_events();
 void sli_si91x_process_ble_events();
 #endif
 
+typedef void (*sli_si91x_notification_handler_t)(void);
+
+// Notification handlers, indexed by the bit position of their event
+static const sli_si91x_notification_handler_t notification_handlers[SLI_SI91X_NOTIFICATION_EVENT_COUNT] = {
+  [SLI_WIFI_COMMON_CMD]   = sli_si91x_process_common_events,
+  [SLI_WIFI_WLAN_CMD]     = sli_si91x_process_wifi_events,
+  [SLI_SI91X_NETWORK_CMD] = sli_si91x_process_network_events,
+  [SLI_SI91X_SOCKET_CMD]  = sli_si91x_process_socket_events,
+#ifdef SLI_SI91X_ENABLE_BLE
+  [SLI_SI91X_BT_CMD] = sli_si91x_process_ble_events,
+#endif
+#ifdef SLI_SI91X_OFFLOAD_NETWORK_STACK
+  [SI91X_CMD_MAX] = sli_si91x_process_socket_data_events,
+#endif
+  [SI91X_CMD_MAX + 1] = sli_si91x_process_command_engine_status_events,
+};
+
+// Notification event priority classes, in processing order
+static const uint32_t notification_priority_classes[] = { SLI_SI91X_HIGH_PRIORITY_NOTIFICATION_EVENTS,
+                                                          SLI_SI91X_MEDIUM_PRIORITY_NOTIFICATION_EVENTS,
+                                                          SLI_SI91X_LOW_PRIORITY_NOTIFICATION_EVENTS };
+
+#if SLI_WIFI_EVENT_HANDLER_STATISTICS_ENABLE
+static sli_wifi_event_handler_statistics_t notification_handler_statistics[SLI_SI91X_NOTIFICATION_EVENT_COUNT];
+#endif
+
 /******************************************************
  *             Static Function Definitions
  ******************************************************/
@@ -300,6 +343,13 @@ static sl_status_t bus_write_frame(sli_wifi_command_queue_t *queue,
   // Modify the packet's descriptor to include the firmware queue ID in the length field
   packet->desc[1] |= (node->firmware_queue_id << 4);
 
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+  // Keep track of the command in flight, its trace is overwritten by this command
+  if (packet->command && (SLI_WIFI_PACKET_WITH_ASYNC_RESPONSE != (node->flags & SLI_WIFI_PACKET_WITH_ASYNC_RESPONSE))) {
+    sli_wifi_command_queue_save_trace(queue);
+  }
+#endif
+
   if (packet->command) {
     // Set the global_queue_block flag if it is present in the packet's flags
     if (SLI_WIFI_PACKET_GLOBAL_QUEUE_BLOCK & node->flags) {
@@ -663,6 +713,14 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
     SL_PRINT_STRING_DEBUG("><<<< Rx -> queueId : %u, frameId : 0x%x, ", queue_id, frame_type);
     SL_PRINT_STRING_DEBUG("frameStatus: 0x%x, length : %u\n", frame_status, (response->length & (~(0xF000))));
 
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+    // Responses of pipelined commands can arrive in any order, trace the command matching this one
+    if (queue_id == SLI_WLAN_MGMT_Q) {
+      sli_wifi_command_queue_select_trace(&cmd_queues[SLI_WIFI_WLAN_CMD], frame_type);
+      sli_wifi_command_queue_select_trace(&cmd_queues[SLI_SI91X_NETWORK_CMD], frame_type);
+    }
+#endif
+
     switch (queue_id) {
       case SLI_WLAN_MGMT_Q: {
         // Erase queue ID as it overlays with the length field which is only 24-bit
@@ -1600,6 +1658,12 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
         break;
       }
     }
+
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+    // Trace the next pipelined command once the traced one completed
+    sli_wifi_command_queue_restore_trace(&cmd_queues[SLI_WIFI_WLAN_CMD]);
+    sli_wifi_command_queue_restore_trace(&cmd_queues[SLI_SI91X_NETWORK_CMD]);
+#endif
     status = sli_submit_rx_buffer();
     if (status == SL_STATUS_ALLOCATION_FAILED) {
       sli_command_engine_status_queue_enqueue_and_set_event(SL_STATUS_ALLOCATION_FAILED);
@@ -1619,7 +1683,15 @@ static inline void sli_si91x_wifi_handle_tx_event(uint32_t *event)
       if (!(*event & (SL_SI91X_TX_PENDING_FLAG(i)))) {
         continue;
       }
-      if (cmd_queues[i].command_in_flight == true) {
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+      // Free the entries of pipelined commands that will never get their response
+      sli_wifi_command_queue_expire_traces(&cmd_queues[i]);
+#endif
+      if ((cmd_queues[i].command_in_flight == true)
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+          && !sli_wifi_command_queue_can_pipeline(&cmd_queues[i])
+#endif
+      ) {
         tx_command_queues_command_in_flight_status |= SL_SI91X_TX_PENDING_FLAG(i);
         continue;
       } else {
@@ -1724,8 +1796,8 @@ void sli_wifi_event_handler_init(void)
   // Array to track the status of commands in flight
 
   cmd_queues[SLI_WIFI_COMMON_CMD].sequential   = true;
-  cmd_queues[SLI_WIFI_WLAN_CMD].sequential     = true;
-  cmd_queues[SLI_SI91X_NETWORK_CMD].sequential = true;
+  cmd_queues[SLI_WIFI_WLAN_CMD].sequential     = (SLI_WIFI_COMMAND_PIPELINE_DEPTH <= 1);
+  cmd_queues[SLI_SI91X_NETWORK_CMD].sequential = (SLI_WIFI_COMMAND_PIPELINE_DEPTH <= 1);
   cmd_queues[SLI_SI91X_BT_CMD].sequential      = true;
   cmd_queues[SLI_SI91X_SOCKET_CMD].sequential  = true;
 }
@@ -1804,6 +1876,56 @@ extern inline uint32_t sli_wifi_event_handler_get_wait_time(uint32_t *event)
   return sli_get_wait_time(wifi_buffer_full, wifi_tx_queues_pending, ble_buffer_full, ble_tx_queues_pending);
 }
 
+// Run the handlers of a set of notification events, lowest bit first.
+static void sli_si91x_dispatch_notification_events(uint32_t events)
+{
+  while (events != 0) {
+    uint32_t index = SL_CTZ(events);
+    events &= events - 1;
+
+    if ((index >= SLI_SI91X_NOTIFICATION_EVENT_COUNT) || (notification_handlers[index] == NULL)) {
+      continue;
+    }
+#if SLI_WIFI_EVENT_HANDLER_STATISTICS_ENABLE
+    uint32_t start = osKernelGetSysTimerCount();
+    notification_handlers[index]();
+    uint32_t duration = osKernelGetSysTimerCount() - start;
+
+    notification_handler_statistics[index].call_count++;
+    notification_handler_statistics[index].total_duration += duration;
+    if (duration > notification_handler_statistics[index].max_duration) {
+      notification_handler_statistics[index].max_duration = duration;
+    }
+#else
+    notification_handlers[index]();
+#endif
+  }
+}
+
+#if SLI_WIFI_EVENT_HANDLER_STATISTICS_ENABLE
+sl_status_t sli_wifi_event_handler_get_statistics(uint8_t event_index, sli_wifi_event_handler_statistics_t *statistics)
+{
+  if (statistics == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if ((event_index >= SLI_SI91X_NOTIFICATION_EVENT_COUNT) || (notification_handlers[event_index] == NULL)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_irqState_t state = CORE_EnterAtomic();
+  *statistics           = notification_handler_statistics[event_index];
+  CORE_ExitAtomic(state);
+  return SL_STATUS_OK;
+}
+
+void sli_wifi_event_handler_reset_statistics(void)
+{
+  CORE_irqState_t state = CORE_EnterAtomic();
+  memset(notification_handler_statistics, 0, sizeof(notification_handler_statistics));
+  CORE_ExitAtomic(state);
+}
+#endif
+
 /// Thread which handles the notification events.
 void sli_si91x_async_rx_event_handler_thread(const void *args)
 {
@@ -1823,40 +1945,17 @@ void sli_si91x_async_rx_event_handler_thread(const void *args)
       continue;
     }
 
-    // Check and process common notification events
-    if (event & NCP_HOST_COMMON_NOTIFICATION_EVENT) {
-      sli_si91x_process_common_events();
-    }
-
-    // Check and process WLAN notification events
-    if (event & NCP_HOST_WLAN_NOTIFICATION_EVENT) {
-      sli_si91x_process_wifi_events();
-    }
-    // Check and process Network notification events
-    if (event & NCP_HOST_NETWORK_NOTIFICATION_EVENT) {
-      sli_si91x_process_network_events();
-    }
-    // Check and process Socket notification events
-    if (event & NCP_HOST_SOCKET_NOTIFICATION_EVENT) {
-      sli_si91x_process_socket_events();
-    }
-    // Check and process command engine status notifications
-    if (event & SLI_SI91X_NCP_HOST_COMMAND_ENGINE_STATUS_NOTIFICATION_EVENT) {
-      sli_si91x_process_command_engine_status_events();
-    }
-#ifdef SLI_SI91X_OFFLOAD_NETWORK_STACK
-    // Check and process Socket Data notification events, if network stack offload is enabled
-    if (event & NCP_HOST_SOCKET_DATA_NOTIFICATION_EVENT) {
-      sli_si91x_process_socket_data_events();
-    }
-#endif
-
-#ifdef SLI_SI91X_ENABLE_BLE
-    // Check and process BLE notification events, if BLE is enabled
-    if (event & NCP_HOST_BLE_NOTIFICATION_EVENT) {
-      sli_si91x_process_ble_events();
+    // Process the received events class by class, only visiting the handlers whose event bit is set
+    for (uint8_t i = 0; i < (sizeof(notification_priority_classes) / sizeof(notification_priority_classes[0])); i++) {
+      if (i != 0) {
+        // Pick up the high priority events raised meanwhile before moving to a lower priority class
+        uint32_t urgent_event = osEventFlagsClear(si91x_async_events, SLI_SI91X_HIGH_PRIORITY_NOTIFICATION_EVENTS);
+        if (!(urgent_event & osFlagsError)) {
+          sli_si91x_dispatch_notification_events(urgent_event & SLI_SI91X_HIGH_PRIORITY_NOTIFICATION_EVENTS);
+        }
+      }
+      sli_si91x_dispatch_notification_events(event & notification_priority_classes[i]);
     }
-#endif
   }
 }
 
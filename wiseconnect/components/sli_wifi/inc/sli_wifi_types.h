@@ -65,6 +65,12 @@
 #define SLI_WIFI_COUNTRY_CODE_LENGTH  3
 #define SLI_WIFI_MAX_POSSIBLE_CHANNEL 24
 
+/// Maximum number of commands awaiting their response at once on a non sequential command queue.
+/// 1 keeps every command queue sequential.
+#ifndef SLI_WIFI_COMMAND_PIPELINE_DEPTH
+#define SLI_WIFI_COMMAND_PIPELINE_DEPTH 1
+#endif
+
 /// Efuse data information
 typedef union {
   uint8_t mfg_sw_version; ///< Manufacturing PTE software version
@@ -403,6 +409,20 @@ typedef struct {
   uint32_t event_mask;        ///< Bitmask to notify handler threads when a packet is added to the rx_queue.
 } sli_si91x_queue_packet_t;
 
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+/// Structure to represent a command awaiting its response on a pipelined command queue
+typedef struct {
+  uint16_t frame_type;        ///< Type of the frame associated with the command, 0 if the entry is unused
+  uint16_t packet_id;         ///< ID of the packet associated with the command
+  uint8_t firmware_queue_id;  ///< ID of the firmware queue for the command
+  uint8_t flags;              ///< Flags associated with the command
+  uint32_t command_tickcount; ///< Command tick count
+  uint32_t command_timeout;   ///< Command timeout
+  void *sdk_context;          ///< Context data associated with the command
+  uint32_t event_mask;        ///< Bitmask to notify handler threads when a packet is added to the rx_queue.
+} sli_wifi_command_trace_t;
+#endif
+
 /// Structure to represent a command queue
 typedef struct {
   sli_wifi_buffer_queue_t tx_queue;    ///< TX queue
@@ -423,6 +443,10 @@ typedef struct {
   void *sdk_context;                   ///< Context data associated with the command
   bool is_queue_initialized;           ///< indicates queue is initialiazed or not.
   uint32_t event_mask;                 ///< Bitmask to notify handler threads when a packet is added to the rx_queue.
+#if SLI_WIFI_COMMAND_PIPELINE_DEPTH > 1
+  sli_wifi_command_trace_t pipelined_commands[SLI_WIFI_COMMAND_PIPELINE_DEPTH - 1]; ///< Other commands in flight
+  uint8_t pipelined_command_count; ///< Number of entries used in pipelined_commands
+#endif
 } sli_wifi_command_queue_t;
 
 // Scan Information
@@ -436,6 +460,8 @@ typedef struct sli_scan_info_s {
   uint8_t bssid[SLI_WIFI_HARDWARE_ADDRESS_LENGTH]; ///< BSSID of the AP
   bool wpa_vendor_ie_seen;                         ///< Transient: WPA vendor IE seen while parsing this frame
   uint16_t seen_count;                             ///< Number of times the same AP was observed in the received frames
+  uint16_t lru_prev;                               ///< Index of the next more recently seen entry in the scan results arena
+  uint16_t lru_next;                               ///< Index of the next less recently seen entry in the scan results arena
 } sli_scan_info_t;
 
 /// Si91x specific station information
@@ -255,8 +255,11 @@ sli_wifi_feature_frame_config_t sli_wifi_get_feature_frame_config(void);
 void sli_wifi_save_pll_mode(const sl_wifi_pll_mode_t pll_mode);
 void sli_wifi_save_power_chain(const sl_wifi_power_chain_t power_chain);
 
-// Accessor for the scan results database head pointer
+// Accessor for the scan results database head pointer. The list is sorted by RSSI.
 sli_scan_info_t **sli_get_scan_info_database(void);
+
+// Function used to add or update an AP in the scan results database
+void sli_wifi_update_scan_info_database(const sli_scan_info_t *info);
 bool sli_wifi_packet_identification_function(const sl_wifi_buffer_t *buffer, const void *user_data);
 uint32_t sli_wifi_host_queue_status(const sli_wifi_buffer_queue_t *queue);
 uint32_t sl_wifi_host_elapsed_time(uint32_t starting_timestamp);
@@ -75,6 +75,29 @@ static sl_wifi_ap_configuration_t ap_configuration;
 sli_wifi_performance_profile_t performance_profile;
 static sli_scan_info_t *scan_info_database = NULL;
 
+// Maximum number of APs kept in the scan results database. The least recently seen AP is evicted when full.
+#ifndef SLI_WIFI_SCAN_RESULTS_DATABASE_SIZE
+#define SLI_WIFI_SCAN_RESULTS_DATABASE_SIZE 64
+#endif
+
+#define SLI_SCAN_INFO_INVALID_INDEX 0xFFFF
+
+// Scan results database storage. Entries are allocated once in a single block and indexed by BSSID.
+typedef struct {
+  sli_scan_info_t *entries; // Arena of SLI_WIFI_SCAN_RESULTS_DATABASE_SIZE entries
+  uint16_t *hash_table;     // Open addressing BSSID table holding entry indexes
+  uint16_t hash_mask;       // Hash table size minus one, size is a power of two
+  uint16_t count;           // Number of entries in use
+  uint16_t lru_head;        // Most recently seen entry
+  uint16_t lru_tail;        // Least recently seen entry
+  bool is_sorted;           // scan_info_database reflects the latest RSSI values
+} sli_scan_info_arena_t;
+
+static sli_scan_info_arena_t scan_info_arena = { .entries   = NULL,
+                                                 .lru_head  = SLI_SCAN_INFO_INVALID_INDEX,
+                                                 .lru_tail  = SLI_SCAN_INFO_INVALID_INDEX,
+                                                 .is_sorted = true };
+
 extern osEventFlagsId_t sli_wifi_events;
 
 void sli_wifi_set_opermode(sl_wifi_operation_mode_t mode)
@@ -199,6 +222,204 @@ static bool sli_filter_scan_info(const sli_scan_info_t *scan_info,
   return true;
 }
 
+// Function to hash a BSSID into the scan results hash table
+static uint16_t sli_scan_info_hash(const uint8_t *bssid)
+{
+  // FNV-1a, the vendor specific lower bytes of the BSSID carry most of the entropy
+  uint32_t hash = 2166136261UL;
+  for (uint8_t i = 0; i < SLI_WIFI_HARDWARE_ADDRESS_LENGTH; i++) {
+    hash ^= bssid[i];
+    hash *= 16777619UL;
+  }
+  return (uint16_t)((hash ^ (hash >> 16)) & scan_info_arena.hash_mask);
+}
+
+// Function to find the hash table slot holding a BSSID, or the empty slot where it would be inserted
+static uint16_t sli_scan_info_find_slot(const uint8_t *bssid)
+{
+  uint16_t slot = sli_scan_info_hash(bssid);
+
+  while (SLI_SCAN_INFO_INVALID_INDEX != scan_info_arena.hash_table[slot]) {
+    const sli_scan_info_t *entry = &scan_info_arena.entries[scan_info_arena.hash_table[slot]];
+    if (0 == memcmp(bssid, entry->bssid, SLI_WIFI_HARDWARE_ADDRESS_LENGTH)) {
+      break;
+    }
+    slot = (slot + 1) & scan_info_arena.hash_mask;
+  }
+  return slot;
+}
+
+// Function to remove a slot from the hash table, shifting back the entries of the same probe sequence
+static void sli_scan_info_remove_slot(uint16_t slot)
+{
+  uint16_t next = (slot + 1) & scan_info_arena.hash_mask;
+
+  while (SLI_SCAN_INFO_INVALID_INDEX != scan_info_arena.hash_table[next]) {
+    uint16_t home = sli_scan_info_hash(scan_info_arena.entries[scan_info_arena.hash_table[next]].bssid);
+    // Move the entry only if the freed slot lies on its probe sequence
+    if (((next - home) & scan_info_arena.hash_mask) >= ((next - slot) & scan_info_arena.hash_mask)) {
+      scan_info_arena.hash_table[slot] = scan_info_arena.hash_table[next];
+      slot                             = next;
+    }
+    next = (next + 1) & scan_info_arena.hash_mask;
+  }
+  scan_info_arena.hash_table[slot] = SLI_SCAN_INFO_INVALID_INDEX;
+}
+
+// Function to unlink an entry from the LRU list
+static void sli_scan_info_lru_unlink(uint16_t index)
+{
+  sli_scan_info_t *entry = &scan_info_arena.entries[index];
+
+  if (SLI_SCAN_INFO_INVALID_INDEX == entry->lru_prev) {
+    scan_info_arena.lru_head = entry->lru_next;
+  } else {
+    scan_info_arena.entries[entry->lru_prev].lru_next = entry->lru_next;
+  }
+  if (SLI_SCAN_INFO_INVALID_INDEX == entry->lru_next) {
+    scan_info_arena.lru_tail = entry->lru_prev;
+  } else {
+    scan_info_arena.entries[entry->lru_next].lru_prev = entry->lru_prev;
+  }
+}
+
+// Function to link an entry as the most recently seen one in the LRU list
+static void sli_scan_info_lru_push(uint16_t index)
+{
+  sli_scan_info_t *entry = &scan_info_arena.entries[index];
+
+  entry->lru_prev = SLI_SCAN_INFO_INVALID_INDEX;
+  entry->lru_next = scan_info_arena.lru_head;
+  if (SLI_SCAN_INFO_INVALID_INDEX == scan_info_arena.lru_head) {
+    scan_info_arena.lru_tail = index;
+  } else {
+    scan_info_arena.entries[scan_info_arena.lru_head].lru_prev = index;
+  }
+  scan_info_arena.lru_head = index;
+}
+
+// Function to allocate the scan results arena and its hash table in a single block
+static sl_status_t sli_scan_info_arena_allocate(void)
+{
+  uint32_t hash_size = 1;
+
+  // Keep the load factor under 50% to bound the probe sequences
+  while (hash_size < (2UL * SLI_WIFI_SCAN_RESULTS_DATABASE_SIZE)) {
+    hash_size <<= 1;
+  }
+
+  scan_info_arena.entries = (sli_scan_info_t *)malloc((sizeof(sli_scan_info_t) * SLI_WIFI_SCAN_RESULTS_DATABASE_SIZE)
+                                                      + (sizeof(uint16_t) * hash_size));
+  if (NULL == scan_info_arena.entries) {
+    return SL_STATUS_ALLOCATION_FAILED;
+  }
+  scan_info_arena.hash_table = (uint16_t *)&scan_info_arena.entries[SLI_WIFI_SCAN_RESULTS_DATABASE_SIZE];
+  scan_info_arena.hash_mask  = (uint16_t)(hash_size - 1);
+  memset(scan_info_arena.hash_table, 0xFF, sizeof(uint16_t) * hash_size);
+  return SL_STATUS_OK;
+}
+
+// Function to merge two RSSI sorted lists, entries of the first list come first on equal RSSI
+static sli_scan_info_t *sli_scan_info_merge(sli_scan_info_t *first, sli_scan_info_t *second)
+{
+  sli_scan_info_t *head  = NULL;
+  sli_scan_info_t **tail = &head;
+
+  while ((NULL != first) && (NULL != second)) {
+    if (second->rssi < first->rssi) {
+      *tail  = second;
+      second = second->next;
+    } else {
+      *tail = first;
+      first = first->next;
+    }
+    tail = &(*tail)->next;
+  }
+  *tail = (NULL != first) ? first : second;
+  return head;
+}
+
+// Function to rebuild the scan results list sorted by RSSI, deferred until the results are read
+static void sli_scan_info_sort_database(void)
+{
+  // Bottom-up merge sort, one pending run per power of two
+  sli_scan_info_t *runs[16] = { NULL };
+  sli_scan_info_t *result   = NULL;
+  uint8_t level;
+
+  if (scan_info_arena.is_sorted) {
+    return;
+  }
+
+  // Walk from the least recently seen entry so that, on equal RSSI, the most recently updated AP comes last
+  for (uint16_t index = scan_info_arena.lru_tail; SLI_SCAN_INFO_INVALID_INDEX != index;
+       index          = scan_info_arena.entries[index].lru_prev) {
+    sli_scan_info_t *run = &scan_info_arena.entries[index];
+    run->next            = NULL;
+    for (level = 0; NULL != runs[level]; level++) {
+      run         = sli_scan_info_merge(runs[level], run);
+      runs[level] = NULL;
+    }
+    runs[level] = run;
+  }
+  for (level = 0; level < (sizeof(runs) / sizeof(runs[0])); level++) {
+    if (NULL != runs[level]) {
+      result = sli_scan_info_merge(runs[level], result);
+    }
+  }
+
+  scan_info_database        = result;
+  scan_info_arena.is_sorted = true;
+}
+
+// Function to add a new AP or update an existing AP in the scan results database
+void sli_wifi_update_scan_info_database(const sli_scan_info_t *info)
+{
+  sli_scan_info_t *element = NULL;
+  uint16_t slot;
+  uint16_t index;
+
+  if (NULL == info) {
+    return;
+  }
+
+  if ((NULL == scan_info_arena.entries) && (SL_STATUS_OK != sli_scan_info_arena_allocate())) {
+    return;
+  }
+
+  slot  = sli_scan_info_find_slot(info->bssid);
+  index = scan_info_arena.hash_table[slot];
+  if (SLI_SCAN_INFO_INVALID_INDEX != index) {
+    element = &scan_info_arena.entries[index];
+    element->seen_count++;
+    element->channel       = info->channel;
+    element->security_mode = info->security_mode;
+    element->rssi          = info->rssi;
+    element->network_type  = info->network_type;
+    memcpy(element->ssid, info->ssid, 34);
+    sli_scan_info_lru_unlink(index);
+  } else {
+    if (scan_info_arena.count < SLI_WIFI_SCAN_RESULTS_DATABASE_SIZE) {
+      index = scan_info_arena.count++;
+    } else {
+      // Database is full, recycle the least recently seen AP
+      index = scan_info_arena.lru_tail;
+      sli_scan_info_lru_unlink(index);
+      sli_scan_info_remove_slot(sli_scan_info_find_slot(scan_info_arena.entries[index].bssid));
+      slot = sli_scan_info_find_slot(info->bssid);
+    }
+    element = &scan_info_arena.entries[index];
+    memcpy(element, info, sizeof(sli_scan_info_t));
+    element->seen_count              = 1;
+    element->next                    = NULL;
+    scan_info_arena.hash_table[slot] = index;
+  }
+  sli_scan_info_lru_push(index);
+  scan_info_arena.is_sorted = false;
+
+  return;
+}
+
 // Function to get the total count of stored extended scan results (for callback data_length)
 sl_status_t sli_wifi_get_stored_scan_result_count(sl_wifi_interface_t interface, uint16_t *scan_count)
 {
@@ -208,10 +429,7 @@ sl_status_t sli_wifi_get_stored_scan_result_count(sl_wifi_interface_t interface,
     return SL_STATUS_INVALID_PARAMETER;
   }
 
-  *scan_count = 0;
-  for (sli_scan_info_t *scan_info = scan_info_database; scan_info != NULL; scan_info = scan_info->next) {
-    (*scan_count)++;
-  }
+  *scan_count = scan_info_arena.count;
   return SL_STATUS_OK;
 }
 
@@ -227,13 +445,16 @@ sl_status_t sli_wifi_get_stored_scan_results(sl_wifi_interface_t interface,
   sl_wifi_extended_scan_result_t *scan_results = extended_scan_parameters->scan_results;
   uint16_t *result_count                       = extended_scan_parameters->result_count;
   uint16_t length                              = extended_scan_parameters->array_length;
-  sli_scan_info_t *scan_info                   = scan_info_database;
+  sli_scan_info_t *scan_info                   = NULL;
 
   if ((NULL == scan_results) || (NULL == result_count) || (0 == length)) {
     return SL_STATUS_INVALID_PARAMETER;
   }
   *result_count = 0;
 
+  sli_scan_info_sort_database();
+  scan_info = scan_info_database;
+
   while ((0 != length) && (NULL != scan_info)) {
     if (true == sli_filter_scan_info(scan_info, extended_scan_parameters)) {
       scan_results[*result_count].rf_channel    = scan_info->channel;
@@ -255,15 +476,15 @@ sl_status_t sli_wifi_get_stored_scan_results(sl_wifi_interface_t interface,
 // Function to Clean up all the scan results in scan result database
 void sli_wifi_flush_scan_results_database(void)
 {
-  sli_scan_info_t *scan_info = scan_info_database;
-  sli_scan_info_t *node      = NULL;
-
-  while (NULL != scan_info) {
-    node      = scan_info;
-    scan_info = scan_info->next;
-    free(node);
-  }
-  scan_info_database = NULL;
+  // The hash table shares the arena allocation
+  free(scan_info_arena.entries);
+  scan_info_arena.entries    = NULL;
+  scan_info_arena.hash_table = NULL;
+  scan_info_arena.count      = 0;
+  scan_info_arena.lru_head   = SLI_SCAN_INFO_INVALID_INDEX;
+  scan_info_arena.lru_tail   = SLI_SCAN_INFO_INVALID_INDEX;
+  scan_info_arena.is_sorted  = true;
+  scan_info_database         = NULL;
 
   return;
 }
@@ -705,6 +926,7 @@ void sli_wifi_save_firmware_status(sl_status_t converted_firmware_status)
  ******************************************************************************/
 sli_scan_info_t **sli_get_scan_info_database(void)
 {
+  sli_scan_info_sort_database();
   return &scan_info_database;
 }
 
@@ -31,6 +31,23 @@
 #ifndef SLI_WIFI_EVENT_HANDLER_H
 #define SLI_WIFI_EVENT_HANDLER_H
 
+#include <stdint.h>
+#include "sl_status.h"
+
+// Enables the timing instrumentation of the notification handlers
+#ifndef SLI_WIFI_EVENT_HANDLER_STATISTICS_ENABLE
+#define SLI_WIFI_EVENT_HANDLER_STATISTICS_ENABLE 0
+#endif
+
+#if SLI_WIFI_EVENT_HANDLER_STATISTICS_ENABLE
+/// Timing statistics of a notification handler. Durations are in kernel system timer counts.
+typedef struct {
+  uint32_t call_count;     ///< Number of times the handler ran
+  uint32_t total_duration; ///< Accumulated run time of the handler
+  uint32_t max_duration;   ///< Longest run time of the handler
+} sli_wifi_event_handler_statistics_t;
+#endif
+
 /**
  * @brief
  *  Initialize the event handler.
@@ -77,4 +94,25 @@ uint32_t sli_wifi_event_handler_get_wait_time(uint32_t *event);
  */
 uint32_t sli_wifi_command_engine_set_event(uint32_t event_mask);
 
+#if SLI_WIFI_EVENT_HANDLER_STATISTICS_ENABLE
+/**
+ * @brief
+ *  Get the timing statistics of the handler of a notification event.
+ * @param[in] event_index
+ *  Bit index of the notification event.
+ * @param[out] statistics
+ *  Statistics of the handler.
+ * @return
+ *  SL_STATUS_OK on success, SL_STATUS_NULL_POINTER if statistics is NULL,
+ *  SL_STATUS_INVALID_PARAMETER if the event index has no handler.
+ */
+sl_status_t sli_wifi_event_handler_get_statistics(uint8_t event_index, sli_wifi_event_handler_statistics_t *statistics);
+
+/**
+ * @brief
+ *  Reset the timing statistics of all the notification handlers.
+ */
+void sli_wifi_event_handler_reset_statistics(void);
+#endif
+
 #endif